@@ -0,0 +1,225 @@
+/**
+ * Controller Arbitration Simulator (host)
+ *
+ * Two controllers drive the same robot with conflicting commands at
+ * 20 Hz each, on the virtual clock. Without arbitration the robot follows
+ * whichever packet came last and switches between the two all the time;
+ * with ControlArbiter it follows one owner. The script then walks through
+ * the lease rules (see "Control Arbitration" in protocol.h):
+ *   0 s   A and B both send; A was first and owns the robot
+ *   5 s   B claims at priority 2 and takes over; A is told REVOKED
+ *   8 s   A claims at priority 1 and is DENIED
+ *   10 s  B releases; A's next command takes control
+ *   12 s  A goes quiet; B takes control once A's lease has lapsed
+ *   15 s  a crowd of other senders fills the sender table
+ * Every phase is checked against the expected owner, the replies the
+ * robot broadcasts, and the rejected count. The time admit() takes for
+ * accepted and rejected packets is measured on the host.
+ *
+ * Usage:
+ *   arbiter_sim
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <Arduino.h>
+#include <esp_now.h>
+#include "constants.h"
+#include "control_arbiter.hpp"
+#include "protocol.h"
+#include "../sim/host_check.hpp"
+
+static constexpr uint64_t SEND_INTERVAL_US = 50000;
+static constexpr uint64_t END_US = 17000000;
+
+struct Controller {
+    uint8_t mac[ESP_NOW_ETH_ALEN];
+    uint64_t offsetUs;      // Send phase within the interval
+    Direction directions[2]; // Alternated every second
+    uint32_t sent = 0;
+    uint32_t admitted = 0;
+};
+
+/**
+ * One phase of the script
+ */
+struct Phase {
+    const char* label;
+    uint64_t startUs;
+    uint64_t endUs;
+    bool aSends;
+    bool bSends;
+    const char* expectedOwner; // Controller whose commands must all be admitted
+};
+
+static std::vector<ControlReply> replies;
+
+static void claim(ControlArbiter& arbiter, Controller& controller, uint8_t priority, uint16_t leaseMs) {
+    ControlClaim packet = {PacketType::CONTROL_CLAIM, priority, leaseMs};
+    arbiter.admit(controller.mac, (const uint8_t*)&packet, sizeof(packet));
+    arbiter.update();
+}
+
+static void release(ControlArbiter& arbiter, Controller& controller) {
+    ControlRelease packet = {PacketType::CONTROL_RELEASE, 0};
+    arbiter.admit(controller.mac, (const uint8_t*)&packet, sizeof(packet));
+    arbiter.update();
+}
+
+/**
+ * Check for a broadcast reply to a controller with a status
+ */
+static bool replied(const Controller& controller, ControlStatus status) {
+    for (const ControlReply& reply : replies) {
+        if (memcmp(reply.controller, controller.mac, ESP_NOW_ETH_ALEN) == 0 && reply.status == status) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Time admit() for one sender (nanoseconds per packet)
+ */
+static double admitNs(ControlArbiter& arbiter, const uint8_t* mac) {
+    const int calls = 1000000;
+    uint8_t packet = (uint8_t)Direction::FORWARD;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < calls; i++) {
+        asm volatile("" ::: "memory");
+        arbiter.admit(mac, &packet, 1);
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / calls;
+}
+
+int main() {
+    hosthal::serialEnabled = false;
+    hosthal::sendListener = [](const uint8_t*, const uint8_t* data, size_t len) {
+        if (len == sizeof(ControlReply) && data[0] == (uint8_t)PacketType::CONTROL_REPLY) {
+            ControlReply reply;
+            memcpy(&reply, data, sizeof(reply));
+            replies.push_back(reply);
+        }
+    };
+
+    Controller a = {{0x24, 0x6F, 0x28, 0x01, 0x00, 0x0A}, 0, {Direction::FORWARD, Direction::LEFT}};
+    Controller b = {{0x24, 0x6F, 0x28, 0x01, 0x00, 0x0B}, 3000, {Direction::BACKWARD, Direction::RIGHT}};
+
+    // Without arbitration: the robot follows the last packet
+    uint32_t freeChanges = 0;
+    uint8_t freeDirection = (uint8_t)Direction::STOP;
+    for (uint64_t tick = 0; tick < 5000000; tick += SEND_INTERVAL_US) {
+        for (Controller* controller : {&a, &b}) {
+            uint8_t direction = (uint8_t)controller->directions[(tick / 1000000) % 2];
+            freeChanges += direction != freeDirection;
+            freeDirection = direction;
+        }
+    }
+
+    ControlArbiter arbiter;
+    hosthal::clockMicros = 0;
+    arbiter.begin();
+
+    const Phase phases[] = {
+        {"both send, A first", 0, 5000000, true, true, "A"},
+        {"B claimed priority 2", 5000000, 10000000, true, true, "B"},
+        {"B released", 10000000, 12000000, true, true, "A"},
+        {"A quiet, lease lapsing", 12000000, 13000000, false, true, ""},
+        {"A quiet", 13000000, 15000000, false, true, "B"},
+        {"crowd of senders", 15000000, END_US, true, true, "B"},
+    };
+    uint64_t takeoverUs = 0;
+    uint32_t crowdRejected = 0;
+    uint32_t changes = 0;
+    uint8_t direction = (uint8_t)Direction::STOP;
+    for (const Phase& phase : phases) {
+        uint32_t aSent = a.sent, aAdmitted = a.admitted, bSent = b.sent, bAdmitted = b.admitted;
+        uint32_t rejectedBefore = arbiter.getStats().rejected;
+        for (uint64_t tick = phase.startUs; tick < phase.endUs; tick += SEND_INTERVAL_US) {
+            // Scripted claims and releases
+            hosthal::clockMicros = tick;
+            if (tick == 5000000) {
+                claim(arbiter, b, 2, 1000);
+                check(replied(b, ControlStatus::GRANTED) && replied(a, ControlStatus::REVOKED),
+                      "priority 2 claim granted to B, A told REVOKED");
+            } else if (tick == 8000000) {
+                replies.clear();
+                claim(arbiter, a, 1, 1000);
+                check(replies.size() == 1 && replied(a, ControlStatus::DENIED) && replies[0].ownerPriority == 2 &&
+                          replies[0].leaseMs > 900,
+                      "priority 1 claim from A denied with B's lease time left");
+                ControlClaim shortClaim = {PacketType::CONTROL_CLAIM, 9, 0};
+                replies.clear();
+                arbiter.admit(a.mac, (const uint8_t*)&shortClaim, sizeof(shortClaim) - 1);
+                arbiter.update();
+                check(replies.empty(), "claim of the wrong length ignored");
+            } else if (tick == 10000000) {
+                replies.clear();
+                release(arbiter, b);
+                check(replied(b, ControlStatus::RELEASED), "B released control");
+            } else if (tick == 15000000) {
+                // Twelve more senders, one packet each, with B owning the robot
+                uint32_t before = arbiter.getStats().rejected;
+                for (uint8_t n = 0; n < 12; n++) {
+                    uint8_t mac[ESP_NOW_ETH_ALEN] = {0x24, 0x6F, 0x28, 0x02, 0x00, n};
+                    uint8_t packet = (uint8_t)Direction::STOP;
+                    arbiter.admit(mac, &packet, 1);
+                }
+                crowdRejected = arbiter.getStats().rejected - before;
+            }
+            for (Controller* controller : {&a, &b}) {
+                if (!(controller == &a ? phase.aSends : phase.bSends)) {
+                    continue;
+                }
+                hosthal::clockMicros = tick + controller->offsetUs;
+                uint8_t packet = (uint8_t)controller->directions[(tick / 1000000) % 2];
+                controller->sent++;
+                if (arbiter.admit(controller->mac, &packet, 1)) {
+                    controller->admitted++;
+                    if (tick < 5000000) {
+                        changes += packet != direction;
+                        direction = packet;
+                    }
+                    if (controller == &b && tick >= 12000000 && takeoverUs == 0) {
+                        takeoverUs = hosthal::clockMicros;
+                    }
+                }
+            }
+        }
+        uint32_t aPhaseSent = a.sent - aSent, aPhaseAdmitted = a.admitted - aAdmitted;
+        uint32_t bPhaseSent = b.sent - bSent, bPhaseAdmitted = b.admitted - bAdmitted;
+        uint32_t phaseRejected = arbiter.getStats().rejected - rejectedBefore;
+        printf("%-24s A %3u/%3u  B %3u/%3u admitted, %3u rejected\n", phase.label, aPhaseAdmitted, aPhaseSent,
+               bPhaseAdmitted, bPhaseSent, phaseRejected);
+        if (phase.expectedOwner[0]) {
+            bool aOwns = phase.expectedOwner[0] == 'A';
+            bool ok = aOwns ? aPhaseAdmitted == aPhaseSent && bPhaseAdmitted == 0
+                            : bPhaseAdmitted == bPhaseSent && aPhaseAdmitted == 0;
+            char what[96];
+            snprintf(what, sizeof(what), "%s: only %s's commands admitted", phase.label, phase.expectedOwner);
+            check(ok, what);
+        }
+    }
+    printf("\n");
+
+    char what[128];
+    snprintf(what, sizeof(what), "first 5 s: %u direction changes with arbitration, %u without", changes,
+             freeChanges);
+    check(changes == 5, what);
+    // A's last command was at 11.95 s; its 1 s lease ends at 12.95 s
+    snprintf(what, sizeof(what), "B took over %.0f ms after A's last command (lease %u ms)",
+             (takeoverUs - 11950000) / 1000.0, CONTROL_LEASE_DEFAULT_MS);
+    check(takeoverUs >= 12950000 && takeoverUs < 12950000 + SEND_INTERVAL_US + 5000, what);
+    check(crowdRejected == 12, "packets from 12 more senders rejected with a full sender table");
+    ControlArbiter::Stats stats = arbiter.getStats();
+    snprintf(what, sizeof(what), "counts add up: %u sent = %u accepted + %u rejected", a.sent + b.sent + 12,
+             stats.accepted, stats.rejected - 1);
+    // One denied claim is counted as rejected as well
+    check(stats.accepted + stats.rejected - 1 == a.sent + b.sent + 12 && stats.takeovers == 1, what);
+
+    printf("\nadmit(): owner %.1f ns, rejected sender %.1f ns (sizeof(ControlArbiter) = %zu bytes, no heap)\n",
+           admitNs(arbiter, b.mac), admitNs(arbiter, a.mac), sizeof(ControlArbiter));
+    return checkResult();
+}
@@ -0,0 +1,260 @@
+/**
+ * Animation Asset Benchmark (host)
+ *
+ * For every animation in the generated asset registry, times decoding
+ * each frame into LED order with the firmware's FrameDecoder and reports
+ * the flash used by its encoding (format, compression, alignment as chosen
+ * in images/animations.json). As a baseline, the same frames are converted
+ * from the original asset layout (513-byte RGB565 frames at odd addresses,
+ * read byte by byte) and checked to give the same LED data.
+ *
+ * With --pack, the animations are read from an asset pack file (as written
+ * to the assets partition) through a memory mapping instead of the tables
+ * compiled in, and the pack is checked against the compiled-in tables.
+ *
+ * For RGB565 animations, in-between frames (FrameBlend) are timed as well,
+ * from source frames expanded into RAM as AnimationController does, and
+ * every step between neighbouring frames is checked to stay between the
+ * two frames' LED values.
+ *
+ * Usage:
+ *   asset_bench [--rounds N] [--pack assets.bin]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "assets.h"
+#include "asset_pack.hpp"
+#include "frame_blend.hpp"
+#include "frame_decoder.hpp"
+#include "led_layout.hpp"
+#include "mapped_file.hpp"
+
+static constexpr size_t PIXELS = ANIMATION_WIDTH * ANIMATION_HEIGHT;
+// Original layout: 512 bytes of pixels + string terminator per frame
+static constexpr size_t LEGACY_FRAME_BYTES = PIXELS * 2 + 1;
+
+static const char* const FORMAT_NAMES[] = {"rgb565", "rgb888"};
+static const char* const COMPRESSION_NAMES[] = {"none", "rle"};
+
+/**
+ * Conversion of the original layout: byte-wise reads from 513-byte frames
+ */
+static void convertLegacy(const uint8_t* frame, const uint16_t* ledIndex, uint8_t* rgb) {
+    for (size_t i = 0; i < PIXELS; i++, frame += 2) {
+        Rgb565::toRgb((uint16_t)(frame[0] | (frame[1] << 8)), rgb + ledIndex[i] * 3);
+    }
+}
+
+template <typename Convert>
+static double timeFrames(int rounds, uint16_t frames, Convert convert) {
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        for (uint16_t frame = 0; frame < frames; frame++) {
+            convert(frame);
+        }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / ((double)rounds * frames);
+}
+
+/**
+ * Check that every in-between frame of an animation lies between its two
+ * source frames, component by component (1 LSB for rounding)
+ */
+static bool checkInterpolation(const AnimationAsset& animation, const uint16_t* ledIndex) {
+    uint8_t from[PIXELS * 3];
+    uint8_t to[PIXELS * 3];
+    uint8_t blend[PIXELS * 3];
+    uint32_t sources[2][PIXELS / 2];
+    for (uint16_t frame = 0; frame < animation.frameCount; frame++) {
+        uint16_t next = (uint16_t)((frame + 1) % animation.frameCount);
+        FrameDecoder::decode(animation.frame(frame), ledIndex, from);
+        FrameDecoder::decode(animation.frame(next), ledIndex, to);
+        if (!FrameDecoder::unpack565(animation.frame(frame), sources[0]) ||
+            !FrameDecoder::unpack565(animation.frame(next), sources[1])) {
+            printf("%s frame %u: cannot be expanded\n", animation.name, frame);
+            return false;
+        }
+        AssetFrame first = {sources[0], (uint16_t)PIXELS, PixelFormat::RGB565, Compression::NONE};
+        AssetFrame second = {sources[1], (uint16_t)PIXELS, PixelFormat::RGB565, Compression::NONE};
+        for (uint8_t step = 0; step <= FrameBlend::STEPS; step++) {
+            if (!FrameBlend::interpolate(first, second, step, ledIndex, blend)) {
+                return false;
+            }
+            for (size_t i = 0; i < sizeof(blend); i++) {
+                int low = from[i] < to[i] ? from[i] : to[i];
+                int high = from[i] < to[i] ? to[i] : from[i];
+                bool exact = step == 0 ? blend[i] == from[i] : step == FrameBlend::STEPS ? blend[i] == to[i] : true;
+                if (!exact || blend[i] < low - 1 || blend[i] > high + 1) {
+                    printf("%s frame %u step %u: in-between frame out of range\n", animation.name, frame, step);
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Flash used by an animation's frames (distinct frames only)
+ *
+ * @param animation Animation to measure
+ * @param all All animations sharing the word array
+ * @param endWord Size of the word array
+ */
+static size_t flashBytes(const AnimationAsset& animation, const std::vector<AnimationAsset>& all, uint32_t endWord) {
+    std::vector<uint32_t> offsets(animation.frameOffsets, animation.frameOffsets + animation.frameCount);
+    size_t bytes = 0;
+    for (uint16_t i = 0; i < animation.frameCount; i++) {
+        bool repeated = false;
+        for (uint16_t j = 0; j < i; j++) {
+            repeated = repeated || offsets[j] == offsets[i];
+        }
+        if (repeated) {
+            continue;
+        }
+        // A frame ends where the next one in the word array starts
+        uint32_t end = endWord;
+        for (const auto& other : all) {
+            for (uint16_t k = 0; k < other.frameCount; k++) {
+                if (other.frameOffsets[k] > offsets[i] && other.frameOffsets[k] < end) {
+                    end = other.frameOffsets[k];
+                }
+            }
+        }
+        bytes += (end - offsets[i]) * 4;
+    }
+    return bytes;
+}
+
+int main(int argc, char** argv) {
+    int rounds = 20000;
+    const char* packPath = nullptr;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "--rounds")) {
+            rounds = atoi(argv[i + 1]);
+        } else if (!strcmp(argv[i], "--pack")) {
+            packPath = argv[i + 1];
+        }
+    }
+
+    // Animations from the compiled-in tables or from a mapped pack
+    std::vector<AnimationAsset> animations(animationAssets, animationAssets + ANIMATION_COUNT);
+    uint32_t endWord = sizeof(assetWords) / 4;
+    MappedFile file;
+    AssetPack pack;
+    if (packPath) {
+        if (!file.open(packPath) || !pack.open(file.data(), file.size())) {
+            printf("%s: not a valid asset pack\n", packPath);
+            return 1;
+        }
+        animations.clear();
+        for (uint16_t i = 0; i < pack.getAnimationCount(); i++) {
+            AnimationAsset animation;
+            pack.getAnimation(i, animation);
+            animations.push_back(animation);
+        }
+        endWord = (uint32_t)(file.size() / 4);
+        printf("%s: %u animations, %zu bytes\n", packPath, pack.getAnimationCount(), file.size());
+    }
+
+    const uint16_t* ledIndex = layoutTable<RobotPanelLayout>.data();
+    uint8_t decoded[PIXELS * 3];
+    uint8_t reference[PIXELS * 3];
+    volatile uint8_t sink = 0;
+    bool ok = true;
+    size_t totalBytes = 0;
+
+    // A pack must hold the same animations as the compiled-in tables
+    if (packPath) {
+        uint8_t expected[PIXELS * 3];
+        for (const auto& animation : animations) {
+            const AnimationAsset* compiled = findAnimation(animation.name);
+            bool same = compiled && compiled->frameCount == animation.frameCount && compiled->loop == animation.loop &&
+                        !memcmp(compiled->frameDurations, animation.frameDurations, animation.frameCount * 2);
+            for (uint16_t frame = 0; same && frame < animation.frameCount; frame++) {
+                same = FrameDecoder::decode(animation.frame(frame), ledIndex, decoded) &&
+                       FrameDecoder::decode(compiled->frame(frame), ledIndex, expected) &&
+                       !memcmp(decoded, expected, sizeof(decoded));
+            }
+            if (!same) {
+                printf("%s: differs from the compiled-in animation\n", animation.name);
+                ok = false;
+            }
+        }
+    }
+
+    size_t legacyBytes = 0;
+
+    printf("%-10s %-7s %-5s %9s %12s %12s %12s\n", "animation", "format", "comp", "flash", "decode", "legacy",
+           "blend");
+    for (const auto& animation : animations) {
+        // Rebuild the original layout from the decoded frames
+        std::vector<uint8_t> legacy(animation.frameCount * LEGACY_FRAME_BYTES);
+        for (uint16_t frame = 0; frame < animation.frameCount; frame++) {
+            const uint16_t* identity = layoutTable<PanelLayout<ANIMATION_WIDTH, ANIMATION_HEIGHT, Progressive>>.data();
+            ok = FrameDecoder::decode(animation.frame(frame), identity, decoded) && ok;
+            uint8_t* bytes = &legacy[frame * LEGACY_FRAME_BYTES];
+            for (size_t i = 0; i < PIXELS; i++) {
+                const uint8_t* rgb = &decoded[i * 3];
+                uint16_t pixel = (uint16_t)(((rgb[0] >> 3) << 11) | ((rgb[1] >> 2) << 5) | (rgb[2] >> 3));
+                bytes[i * 2] = (uint8_t)pixel;
+                bytes[i * 2 + 1] = (uint8_t)(pixel >> 8);
+            }
+        }
+
+        // Same LED data as the original layout (RGB565 animations)
+        for (uint16_t frame = 0; frame < animation.frameCount; frame++) {
+            ok = FrameDecoder::decode(animation.frame(frame), ledIndex, decoded) && ok;
+            convertLegacy(&legacy[frame * LEGACY_FRAME_BYTES], ledIndex, reference);
+            if (animation.format == PixelFormat::RGB565 && memcmp(decoded, reference, sizeof(decoded))) {
+                printf("%s frame %u: decoded data differs from the original layout\n", animation.name, frame);
+                ok = false;
+            }
+        }
+
+        double decodeNs = timeFrames(rounds, animation.frameCount, [&](uint16_t frame) {
+            FrameDecoder::decode(animation.frame(frame), ledIndex, decoded);
+            sink = sink + decoded[frame];
+        });
+        double legacyNs = timeFrames(rounds, animation.frameCount, [&](uint16_t frame) {
+            convertLegacy(&legacy[frame * LEGACY_FRAME_BYTES], ledIndex, reference);
+            sink = sink + reference[frame];
+        });
+
+        // Half-way in-between frames of expanded source frames (RGB565 only)
+        char blendText[16] = "-";
+        if (animation.format == PixelFormat::RGB565) {
+            ok = checkInterpolation(animation, ledIndex) && ok;
+            std::vector<uint32_t> expanded(animation.frameCount * PIXELS / 2);
+            for (uint16_t frame = 0; frame < animation.frameCount; frame++) {
+                FrameDecoder::unpack565(animation.frame(frame), &expanded[frame * PIXELS / 2]);
+            }
+            double blendNs = timeFrames(rounds, animation.frameCount, [&](uint16_t frame) {
+                uint16_t next = (uint16_t)((frame + 1) % animation.frameCount);
+                AssetFrame first = {&expanded[frame * PIXELS / 2], (uint16_t)PIXELS, PixelFormat::RGB565,
+                                    Compression::NONE};
+                AssetFrame second = {&expanded[next * PIXELS / 2], (uint16_t)PIXELS, PixelFormat::RGB565,
+                                     Compression::NONE};
+                FrameBlend::interpolate(first, second, FrameBlend::STEPS / 2, ledIndex, decoded);
+                sink = sink + decoded[frame];
+            });
+            snprintf(blendText, sizeof(blendText), "%.0f ns", blendNs);
+        }
+
+        size_t bytes = flashBytes(animation, animations, endWord);
+        totalBytes += bytes;
+        legacyBytes += animation.frameCount * LEGACY_FRAME_BYTES;
+        printf("%-10s %-7s %-5s %7zu B %9.0f ns %9.0f ns %12s\n", animation.name,
+               FORMAT_NAMES[(uint8_t)animation.format], COMPRESSION_NAMES[(uint8_t)animation.compression],
+               bytes, decodeNs, legacyNs, blendText);
+    }
+
+    printf("flash: %zu bytes of frames (original layout %zu)\n", totalBytes, legacyBytes);
+    printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
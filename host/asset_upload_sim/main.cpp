@@ -0,0 +1,524 @@
+/**
+ * Asset Upload Loopback Simulation (host)
+ *
+ * Uploads an asset pack through the firmware's AssetReceiver and
+ * AssetWriter over a simulated ESP-NOW link, to measure transfer time and
+ * loss recovery without hardware:
+ * - Link: one shared half-duplex channel at the ESP-NOW default rate
+ *   (1 Mbps), per-packet airtime including preamble, MAC ack and backoff,
+ *   random packet loss, and corruption of chunk packets that gets past the
+ *   frame check (caught by the chunk CRC)
+ * - Robot: receive path as in AssetUploader (bounded write queue, chunks
+ *   dropped when it is full) and a flash write task on a NOR flash model
+ *   with typical erase and program times
+ * - Controller: AssetSender (host/sim/asset_sender.hpp)
+ *
+ * Runs the upload at each loss rate, then checks that every upload was
+ * activated with the pack intact, that the slots alternate, that an
+ * interrupted upload leaves the previous pack active, that chunks of a
+ * refused pack are answered with its status and never stored, that an
+ * upload never erases the slot the animations fall back to, and that a
+ * pack with the right CRC that does not validate is not activated. Exits
+ * with status 1 if any check fails.
+ *
+ * Usage:
+ *   asset_upload_sim [--pack FILE] [--loss 0,0.05,0.2] [--corrupt P]
+ *                    [--window N] [--timeout-ms N] [--queue N] [--seed N]
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <random>
+#include <string>
+#include <vector>
+#include "asset_pack.hpp"
+#include "asset_receiver.hpp"
+#include "asset_slots.hpp"
+#include "asset_writer.hpp"
+#include "mapped_file.hpp"
+#include "../sim/asset_sender.hpp"
+#include "../sim/nor_flash.hpp"
+#include "../sim/host_check.hpp"
+
+// Assets partition size (partitions.csv)
+static constexpr size_t PARTITION_SIZE = 0x40000;
+// Simulation step (microseconds)
+static constexpr uint64_t TICK_US = 10;
+// Give up on a transfer after this much simulated time
+static constexpr uint64_t TRANSFER_LIMIT_US = 120000000;
+
+/**
+ * Airtime of one ESP-NOW packet at 1 Mbps (802.11b, long preamble):
+ * 192 us preamble + 42 bytes of MAC header, action frame header and FCS,
+ * then SIFS + MAC ack (314 us) and DIFS + average backoff (200 us)
+ */
+static uint64_t airtimeUs(size_t len) {
+    return 192 + (len + 42) * 8 + 314 + 200;
+}
+
+struct Options {
+    const char* pack = ".pio/build/generated/assets.bin";
+    std::vector<double> losses = {0.0, 0.01, 0.05, 0.1, 0.2};
+    double corrupt = 0.01;
+    uint8_t window = 16;
+    uint32_t timeoutUs = 50000;
+    size_t queueDepth = 16; // AssetUploader::QUEUE_DEPTH
+    uint32_t seed = 1;
+};
+
+/**
+ * Robot side: AssetUploader with its FreeRTOS queue and task replaced by a
+ * bounded deque and a writer that is busy for the flash operation time
+ */
+class Robot {
+public:
+    struct Stats {
+        uint32_t queueDrops; // New chunks dropped because the queue was full
+    };
+
+    Robot(NorFlash& flash, size_t queueDepth, uint8_t mappedSlot)
+        : flash(flash), writer(flash), queueDepth(queueDepth), mappedSlot(mappedSlot) {}
+
+    /**
+     * Receive callback (AssetUploader::handle)
+     */
+    void receive(const uint8_t* data, size_t len) {
+        while (!outcomes.empty()) {
+            receiver.finish(outcomes.front().transferId, outcomes.front().status, outcomes.front().generation);
+            outcomes.pop_front();
+        }
+        if (data[0] == (uint8_t)PacketType::ASSET_BEGIN) {
+            switch (receiver.begin(data, len, AssetSlots::capacity(flash.size()))) {
+            case AssetReceiver::Result::STARTED: {
+                Job job = {true, receiver.getTransferId(), receiver.getSize(), receiver.getCrc(), {}};
+                if (jobs.size() >= queueDepth) {
+                    receiver.cancel();
+                    return;
+                }
+                jobs.push_back(job);
+                sendAck();
+                break;
+            }
+            case AssetReceiver::Result::REPEATED:
+                sendReply();
+                break;
+            case AssetReceiver::Result::REJECTED:
+                sendStatus();
+                break;
+            default:
+                break;
+            }
+        } else if (data[0] == (uint8_t)PacketType::ASSET_CHUNK) {
+            AssetReceiver::Chunk chunk;
+            switch (receiver.chunk(data, len, chunk)) {
+            case AssetReceiver::Result::NEW_CHUNK:
+                if (jobs.size() >= queueDepth) {
+                    stats.queueDrops++;
+                    break;
+                }
+                jobs.push_back({false, receiver.getTransferId(), chunk.offset, 0,
+                                std::vector<uint8_t>(chunk.data, chunk.data + chunk.length)});
+                if (receiver.markReceived(chunk.index)) {
+                    sendAck();
+                }
+                break;
+            case AssetReceiver::Result::DUPLICATE:
+                sendReply();
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    /**
+     * Flash write task (AssetUploader::run)
+     */
+    void step(uint64_t now) {
+        if (now < busyUntil) {
+            return;
+        }
+        if (completing) {
+            // Report once the verify and header write have taken their time
+            completing = false;
+            AssetStatus status = {};
+            status.type = PacketType::ASSET_STATUS;
+            status.transferId = writingId;
+            status.status = result;
+            status.generation = result == AssetStatusCode::ACTIVATED ? writer.getGeneration()
+                                                                     : writer.getGeneration() - 1;
+            outcomes.push_back(status);
+            auto* bytes = reinterpret_cast<const uint8_t*>(&status);
+            replies.emplace_back(bytes, bytes + sizeof(status));
+        }
+        if (jobs.empty()) {
+            return;
+        }
+        Job job = std::move(jobs.front());
+        jobs.pop_front();
+        if (job.start) {
+            writingId = job.transferId;
+            chunksLeft = (uint16_t)((job.offset + ASSET_CHUNK_SIZE - 1) / ASSET_CHUNK_SIZE);
+            writer.start(job.offset, job.crc, mappedSlot);
+        } else if (job.transferId == writingId && chunksLeft > 0) {
+            writer.write(job.offset, job.data.data(), (uint16_t)job.data.size());
+            if (--chunksLeft == 0) {
+                result = writer.finish();
+                completing = true;
+            }
+        }
+        busyUntil = now + flash.takeBusyMicros();
+    }
+
+    /**
+     * Take the next reply to transmit
+     */
+    bool popReply(std::vector<uint8_t>& packet) {
+        if (replies.empty()) {
+            return false;
+        }
+        packet = std::move(replies.front());
+        replies.pop_front();
+        return true;
+    }
+
+    const Stats& getStats() const {
+        return stats;
+    }
+
+    // No flash jobs waiting
+    bool isIdle() const {
+        return jobs.empty();
+    }
+
+private:
+    struct Job {
+        bool start;
+        uint16_t transferId;
+        uint32_t offset; // Chunk: pack offset; start: pack size
+        uint32_t crc;
+        std::vector<uint8_t> data;
+    };
+
+    NorFlash& flash;
+    AssetWriter<NorFlash> writer;
+    AssetReceiver receiver;
+    size_t queueDepth;
+    uint8_t mappedSlot;
+    std::deque<Job> jobs;
+    std::deque<std::vector<uint8_t>> replies;
+    // Outcomes handed back to the receiver (AssetUploader::outcomes)
+    std::deque<AssetStatus> outcomes;
+    uint64_t busyUntil = 0;
+    uint16_t writingId = 0;
+    uint16_t chunksLeft = 0;
+    bool completing = false;
+    AssetStatusCode result = AssetStatusCode::ACTIVATED;
+    Stats stats = {};
+
+    void sendReply() {
+        if (receiver.isFinished()) {
+            sendStatus();
+        } else {
+            sendAck();
+        }
+    }
+
+    void sendAck() {
+        AssetAck ack = receiver.makeAck();
+        auto* bytes = reinterpret_cast<const uint8_t*>(&ack);
+        replies.emplace_back(bytes, bytes + sizeof(ack));
+    }
+
+    void sendStatus() {
+        AssetStatus status = receiver.makeStatus();
+        auto* bytes = reinterpret_cast<const uint8_t*>(&status);
+        replies.emplace_back(bytes, bytes + sizeof(status));
+    }
+};
+
+struct TransferResult {
+    bool done;
+    AssetStatusCode status;
+    uint32_t generation;
+    uint64_t micros;
+    AssetSender::Stats sender;
+    Robot::Stats robot;
+    uint32_t lost;
+    uint32_t corrupted;
+};
+
+/**
+ * Find the slot AssetPartition maps: the newest one whose pack validates
+ */
+static uint8_t mappedSlot(NorFlash& flash) {
+    AssetSlots::Header headers[AssetSlots::SLOT_COUNT];
+    uint8_t order[AssetSlots::SLOT_COUNT];
+    uint8_t count = AssetSlots::scan(flash, headers, order);
+    for (uint8_t i = 0; i < count; i++) {
+        AssetPack pack;
+        if (pack.open(flash.bytes() + AssetSlots::packOffset(flash.size(), order[i]), headers[order[i]].size)) {
+            return order[i];
+        }
+    }
+    return AssetSlots::NO_SLOT;
+}
+
+/**
+ * Run one upload over the simulated link (the robot has mapped the active
+ * pack, as the main loop does after every activation)
+ *
+ * @param stopAfter Abandon the upload once this many chunks are acknowledged (0 = never)
+ */
+static TransferResult transfer(NorFlash& flash, const std::vector<uint8_t>& pack, uint16_t transferId,
+                               const Options& options, double loss, std::mt19937& rng, uint16_t stopAfter = 0) {
+    Robot robot(flash, options.queueDepth, mappedSlot(flash));
+    AssetSender sender(pack.data(), (uint32_t)pack.size(), transferId, options.window, options.timeoutUs);
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+
+    TransferResult result = {};
+    std::vector<uint8_t> inFlight;
+    bool toRobot = false;
+    uint64_t busyUntil = 0;
+    uint8_t buffer[ESPNOW_MAX_PAYLOAD];
+
+    uint64_t now = 0;
+    for (; now < TRANSFER_LIMIT_US && !sender.isDone(); now += TICK_US) {
+        if (stopAfter && sender.getAcked() >= stopAfter) {
+            break;
+        }
+        // Deliver the packet on the air
+        if (!inFlight.empty() && now >= busyUntil) {
+            if (chance(rng) < loss) {
+                result.lost++;
+            } else if (toRobot) {
+                if (inFlight[0] == (uint8_t)PacketType::ASSET_CHUNK && chance(rng) < options.corrupt) {
+                    inFlight[rng() % inFlight.size()] ^= (uint8_t)(1u << (rng() % 8));
+                    result.corrupted++;
+                }
+                robot.receive(inFlight.data(), inFlight.size());
+            } else {
+                sender.receive(inFlight.data(), inFlight.size(), now);
+            }
+            inFlight.clear();
+        }
+
+        robot.step(now);
+
+        // Start the next transmission; the robot's replies go first
+        if (inFlight.empty()) {
+            if (robot.popReply(inFlight)) {
+                toRobot = false;
+            } else if (size_t len = sender.poll(now, buffer)) {
+                inFlight.assign(buffer, buffer + len);
+                toRobot = true;
+            }
+            if (!inFlight.empty()) {
+                busyUntil = now + airtimeUs(inFlight.size());
+            }
+        }
+    }
+
+    result.done = sender.isDone();
+    result.status = sender.getStatus();
+    result.generation = sender.getGeneration();
+    result.micros = now;
+    result.sender = sender.getStats();
+    result.robot = robot.getStats();
+    return result;
+}
+
+/**
+ * Announce a pack that is refused, then send one of its chunks: both must
+ * be answered with the TOO_LARGE status, and nothing queued for writing
+ */
+static bool rejectedChunkAnswered(NorFlash& flash, uint32_t size, uint16_t transferId, uint16_t index) {
+    std::vector<uint8_t> pack(size, 0xA5);
+    Robot robot(flash, 16, mappedSlot(flash));
+    AssetSender sender(pack.data(), size, transferId, ASSET_WINDOW, 50000);
+    uint8_t buffer[ESPNOW_MAX_PAYLOAD];
+    std::vector<uint8_t> reply;
+    auto tooLarge = [&] {
+        AssetStatus status;
+        if (!robot.popReply(reply) || reply.size() != sizeof(status) ||
+            reply[0] != (uint8_t)PacketType::ASSET_STATUS) {
+            return false;
+        }
+        memcpy(&status, reply.data(), sizeof(status));
+        return status.transferId == transferId && status.status == AssetStatusCode::TOO_LARGE;
+    };
+    robot.receive(buffer, sender.makeBegin(buffer));
+    bool ok = tooLarge();
+    robot.receive(buffer, sender.makeChunk(index, buffer));
+    return ok && tooLarge() && !robot.popReply(reply) && robot.isIdle();
+}
+
+/**
+ * Find the active pack in the flash model, as AssetPartition does
+ */
+static bool activePack(NorFlash& flash, uint32_t& generation, uint8_t& slot, const uint8_t*& data, uint32_t& size) {
+    AssetSlots::Header headers[AssetSlots::SLOT_COUNT];
+    uint8_t order[AssetSlots::SLOT_COUNT];
+    if (AssetSlots::scan(flash, headers, order) == 0) {
+        return false;
+    }
+    slot = order[0];
+    generation = headers[slot].generation;
+    data = flash.bytes() + AssetSlots::packOffset(flash.size(), slot);
+    size = headers[slot].size;
+    return true;
+}
+
+static std::vector<double> parseList(const char* text) {
+    std::vector<double> values;
+    for (const char* p = text; *p;) {
+        char* end = nullptr;
+        double value = strtod(p, &end);
+        if (end == p) {
+            break;
+        }
+        values.push_back(value);
+        p = *end == ',' ? end + 1 : end;
+    }
+    return values;
+}
+
+static const char* statusName(AssetStatusCode status) {
+    static const char* const NAMES[] = {"activated", "too large", "crc mismatch", "flash error", "invalid pack"};
+    return (uint8_t)status < 5 ? NAMES[(uint8_t)status] : "?";
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--pack") && i + 1 < argc) {
+            options.pack = argv[++i];
+        } else if (!strcmp(argv[i], "--loss") && i + 1 < argc) {
+            options.losses = parseList(argv[++i]);
+        } else if (!strcmp(argv[i], "--corrupt") && i + 1 < argc) {
+            options.corrupt = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--window") && i + 1 < argc) {
+            options.window = (uint8_t)atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--timeout-ms") && i + 1 < argc) {
+            options.timeoutUs = (uint32_t)atoi(argv[++i]) * 1000;
+        } else if (!strcmp(argv[i], "--queue") && i + 1 < argc) {
+            options.queueDepth = (size_t)atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--seed") && i + 1 < argc) {
+            options.seed = (uint32_t)atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "Usage: %s [--pack FILE] [--loss 0,0.05,0.2] [--corrupt P] [--window N] "
+                            "[--timeout-ms N] [--queue N] [--seed N]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (options.window < 1 || options.window > ASSET_WINDOW || options.queueDepth < 1) {
+        fprintf(stderr, "--window must be 1-%u and --queue at least 1\n", ASSET_WINDOW);
+        return 2;
+    }
+
+    MappedFile file;
+    if (!file.open(options.pack)) {
+        fprintf(stderr, "Cannot read %s (build any native env to generate it)\n", options.pack);
+        return 2;
+    }
+    auto* packBytes = static_cast<const uint8_t*>(file.data());
+    std::vector<uint8_t> pack(packBytes, packBytes + file.size());
+    printf("Pack: %zu bytes, %zu chunks of %u bytes, window %u, queue %zu, corrupt %.1f %%\n\n", pack.size(),
+           (pack.size() + ASSET_CHUNK_SIZE - 1) / ASSET_CHUNK_SIZE, ASSET_CHUNK_SIZE, options.window,
+           options.queueDepth, options.corrupt * 100.0);
+
+    NorFlash flash(PARTITION_SIZE);
+    std::mt19937 rng(options.seed);
+    uint16_t transferId = 1;
+    uint32_t expectedGeneration = 0;
+    uint8_t previousSlot = 0xFF;
+    bool allActivated = true;
+    bool allIntact = true;
+    bool slotsAlternate = true;
+
+    printf("  loss   time ms     KB/s  packets  resent  timeouts  queue drops  lost  corrupt  result\n");
+    for (double loss : options.losses) {
+        TransferResult result = transfer(flash, pack, transferId++, options, loss, rng);
+        double seconds = result.micros / 1e6;
+        printf("%5.1f %% %9.1f %8.1f %8u %7u %9u %12u %5u %8u  %s\n", loss * 100.0, result.micros / 1000.0,
+               seconds > 0 ? pack.size() / 1024.0 / seconds : 0.0, result.sender.packets, result.sender.resent,
+               result.sender.timeouts, result.robot.queueDrops, result.lost, result.corrupted,
+               result.done ? statusName(result.status) : "timed out");
+
+        uint32_t generation = 0;
+        uint8_t slot = 0;
+        const uint8_t* data = nullptr;
+        uint32_t size = 0;
+        AssetPack stored;
+        bool activated = result.done && result.status == AssetStatusCode::ACTIVATED &&
+                         activePack(flash, generation, slot, data, size) &&
+                         generation == ++expectedGeneration && result.generation == generation;
+        allActivated = allActivated && activated;
+        allIntact = allIntact && activated && size == pack.size() && !memcmp(data, pack.data(), size) &&
+                    stored.open(data, size);
+        slotsAlternate = slotsAlternate && activated && slot != previousSlot;
+        previousSlot = slot;
+    }
+    printf("\n");
+    check(allActivated, "every upload activated with the next generation");
+    check(allIntact, "active pack matches the uploaded pack and validates");
+    check(slotsAlternate, "uploads alternate between the two slots");
+
+    // Interrupted upload: the slot being written must never become active
+    uint16_t chunks = (uint16_t)((pack.size() + ASSET_CHUNK_SIZE - 1) / ASSET_CHUNK_SIZE);
+    transfer(flash, pack, transferId++, options, 0.05, rng, (uint16_t)(chunks / 2));
+    uint32_t generation = 0;
+    uint8_t slot = 0;
+    const uint8_t* data = nullptr;
+    uint32_t size = 0;
+    check(activePack(flash, generation, slot, data, size) && generation == expectedGeneration &&
+              slot == previousSlot && size == pack.size() && !memcmp(data, pack.data(), size),
+          "interrupted upload leaves the previous pack active");
+
+    TransferResult resumed = transfer(flash, pack, transferId++, options, 0.05, rng);
+    check(resumed.done && resumed.status == AssetStatusCode::ACTIVATED && activePack(flash, generation, slot, data, size) &&
+              generation == expectedGeneration + 1,
+          "next upload after an interruption activates");
+
+    // Oversized pack is refused up front
+    std::vector<uint8_t> huge(AssetSlots::capacity(PARTITION_SIZE) + 1, 0x5A);
+    TransferResult refused = transfer(flash, huge, transferId++, options, 0.0, rng);
+    check(refused.done && refused.status == AssetStatusCode::TOO_LARGE, "pack larger than a slot is rejected");
+    uint32_t untracked = (AssetReceiver::MAX_CHUNKS + 200) * ASSET_CHUNK_SIZE;
+    check(rejectedChunkAnswered(flash, (uint32_t)huge.size(), transferId++, 0) &&
+              rejectedChunkAnswered(flash, untracked, transferId++, AssetReceiver::MAX_CHUNKS + 176),
+          "chunks of a rejected pack are answered with its status, not stored");
+
+    // Newest pack damaged after activation: the animations fall back to the
+    // older slot, so the next upload must go to the damaged one
+    activePack(flash, generation, slot, data, size);
+    size_t damaged = sizeof(AssetPack::Header);
+    while (damaged < size && data[damaged] == 0) {
+        damaged++;
+    }
+    uint8_t zero = 0;
+    flash.write(AssetSlots::packOffset(PARTITION_SIZE, slot) + damaged, &zero, 1);
+    uint8_t damagedSlot = slot;
+    uint8_t fallbackSlot = mappedSlot(flash);
+    TransferResult replaced = transfer(flash, pack, transferId++, options, 0.05, rng);
+    check(fallbackSlot == 1 - damagedSlot && replaced.done && replaced.status == AssetStatusCode::ACTIVATED &&
+              mappedSlot(flash) == damagedSlot && activePack(flash, generation, slot, data, size) &&
+              slot == damagedSlot,
+          "upload replaces the damaged pack, not the mapped fallback");
+
+    // Right CRC, but a pack version the firmware cannot read
+    std::vector<uint8_t> future = pack;
+    future[offsetof(AssetPack::Header, version)]++;
+    uint32_t activeGeneration = generation;
+    TransferResult invalid = transfer(flash, future, transferId++, options, 0.0, rng);
+    check(invalid.done && invalid.status == AssetStatusCode::INVALID_PACK &&
+              activePack(flash, generation, slot, data, size) && generation == activeGeneration &&
+              slot == damagedSlot && invalid.generation == activeGeneration,
+          "pack that does not validate is not activated");
+
+    check(flash.getUnerasedWrites() == 0, "flash is only programmed after erasing");
+
+    return checkResult();
+}
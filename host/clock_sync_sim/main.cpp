@@ -0,0 +1,359 @@
+/**
+ * Fleet Clock Sync Simulator (host)
+ *
+ * Runs the firmware's ClockSync on a fleet of simulated robots whose
+ * clocks are offset and skewed (crystal tolerance plus a slow temperature
+ * wander), fed with TIME_BEACON broadcasts from a beacon source that has
+ * its own skewed clock. Beacons reach all robots with a common delay
+ * (channel access, occasionally long) plus a per-robot delay (WiFi task),
+ * and each robot misses some of them.
+ *
+ * At every render tick (16 ms), all robots are compared at the same true
+ * instant:
+ *   spread      Largest difference between the robots' fleet times
+ *   error       Difference from the source's clock
+ *   same frame  Robots showing the same arrow frame, each playing the
+ *               "forward" animation in phase with its fleet clock
+ *               (AnimationTimeline::startInPhase, as AnimationController)
+ * Every 10 s a MOVE_AT command is broadcast 300 ms ahead; each robot
+ * converts the start to its local clock, and the spread of the true start
+ * times is reported.
+ *
+ * The script includes a 30 s beacon outage (holdover on the estimated
+ * drift) and a restart of the beacon source (its clock starts over, the
+ * robots must lock again). For comparison, the same robots without sync
+ * play from a command sent to each robot in turn, on their own clocks.
+ *
+ * Usage:
+ *   clock_sync_sim [--robots 8] [--ppm 30] [--loss 5] [--seed 1]
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "assets.h"
+#include "animation_timeline.hpp"
+#include "clock_sync.hpp"
+#include "../sim/host_check.hpp"
+
+// Script (true time, seconds)
+static constexpr double DURATION_S = 300;
+static constexpr double OUTAGE_START_S = 120;
+static constexpr double OUTAGE_END_S = 150;
+static constexpr double RESTART_S = 215;
+// Ticks this long after the start and after the source restart are not counted
+static constexpr double SETTLE_S = 5;
+static constexpr double BEACON_INTERVAL_S = 0.1;
+static constexpr double RENDER_INTERVAL_S = 0.016;
+static constexpr double MOVE_INTERVAL_S = 10;
+static constexpr double MOVE_LEAD_S = 0.3;
+// Slow clock rate change (temperature), amplitude and period
+static constexpr double WANDER_PPM = 2;
+static constexpr double WANDER_PERIOD_S = 300;
+
+// Limits checked (microseconds)
+static constexpr double SPREAD_P99_LIMIT_US = 1000;
+static constexpr double SPREAD_MAX_LIMIT_US = 3000;
+static constexpr double HOLDOVER_LIMIT_US = 2000;
+static constexpr double MOVE_LIMIT_US = 2000;
+static constexpr double RELOCK_LIMIT_S = 2;
+
+/**
+ * A clock running at its own rate: local(t) for true time t (seconds)
+ */
+struct SkewedClock {
+    double offsetUs;
+    double ppm;
+    double wanderPhase;
+
+    double at(double t) const {
+        double wander = WANDER_PPM * WANDER_PERIOD_S / (2 * M_PI) *
+                        (sin(2 * M_PI * t / WANDER_PERIOD_S + wanderPhase) - sin(wanderPhase));
+        return offsetUs + t * 1e6 + ppm * t + wander;
+    }
+
+    double ppmAt(double t) const {
+        return ppm + WANDER_PPM * cos(2 * M_PI * t / WANDER_PERIOD_S + wanderPhase);
+    }
+
+    /**
+     * True time at which the clock reads a value
+     */
+    double when(double localUs, double guessS) const {
+        double t = guessS;
+        for (int i = 0; i < 4; i++) {
+            t += (localUs - at(t)) / (1e6 + ppm);
+        }
+        return t;
+    }
+};
+
+struct Robot {
+    SkewedClock clock;
+    ClockSync sync;
+    // As FleetClock::nowMs(): fleet time never goes back, except on a step
+    uint64_t lastFleetUs = 0;
+    AnimationTimeline timeline;
+    bool restart = true;
+    // Without sync: animation started from a command, on the local clock
+    AnimationTimeline freeTimeline;
+    double freeStartUs = 0;
+};
+
+enum class EventType : uint8_t {
+    BEACON, // Beacon received by a robot
+    MOVE,   // MOVE_AT received by a robot
+    TICK,   // Render tick (all robots)
+};
+
+struct Event {
+    double t;
+    EventType type;
+    int robot;
+    uint64_t value; // Beacon time or move start (source clock)
+    double sent;
+};
+
+struct Stats {
+    std::vector<double> spreadUs;
+    std::vector<double> errorUs;
+    uint32_t ticks = 0;
+    uint32_t sameFrame = 0;
+
+    static double percentile(std::vector<double>& values, double p) {
+        if (values.empty()) {
+            return 0;
+        }
+        std::sort(values.begin(), values.end());
+        return values[std::min(values.size() - 1, (size_t)(p / 100 * values.size()))];
+    }
+
+    void print(const char* label) {
+        printf("%-26s %6u %8.0f %8.0f %8.0f", label, ticks, percentile(spreadUs, 50), percentile(spreadUs, 99),
+               percentile(spreadUs, 100));
+        if (errorUs.empty()) {
+            printf(" %8s %8s", "-", "-");
+        } else {
+            printf(" %8.0f %8.0f", percentile(errorUs, 99), percentile(errorUs, 100));
+        }
+        printf(" %8.2f%%\n", ticks ? 100.0 * sameFrame / ticks : 0.0);
+    }
+};
+
+int main(int argc, char** argv) {
+    int robotCount = 8;
+    double ppm = 30;
+    double lossPercent = 5;
+    unsigned seed = 1;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "--robots")) {
+            robotCount = std::max(2, atoi(argv[i + 1]));
+        } else if (!strcmp(argv[i], "--ppm")) {
+            ppm = atof(argv[i + 1]);
+        } else if (!strcmp(argv[i], "--loss")) {
+            lossPercent = atof(argv[i + 1]);
+        } else if (!strcmp(argv[i], "--seed")) {
+            seed = (unsigned)atoi(argv[i + 1]);
+        }
+    }
+    const AnimationAsset* animation = findAnimation("forward");
+    if (!animation) {
+        printf("animation 'forward' missing\n");
+        return 1;
+    }
+
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> uniform(0, 1);
+    auto exponential = [&](double mean) { return -mean * log(1 - uniform(rng)); };
+
+    // Source clock before and after its restart (starts over near 0)
+    SkewedClock source = {5e6 + uniform(rng) * 1e6, (uniform(rng) * 2 - 1) * ppm, uniform(rng) * 6.28};
+    SkewedClock restarted = source;
+    restarted.offsetUs = 250000 - RESTART_S * 1e6;
+    auto sourceAt = [&](double t) { return t < RESTART_S ? source.at(t) : restarted.at(t); };
+
+    std::vector<Robot> robots(robotCount);
+    for (int i = 0; i < robotCount; i++) {
+        robots[i].clock = {uniform(rng) * 60e6, (uniform(rng) * 2 - 1) * ppm, uniform(rng) * 6.28};
+    }
+
+    // Events: beacons, moves and render ticks
+    std::vector<Event> events;
+    for (double t = 0.05; t < DURATION_S; t += BEACON_INTERVAL_S) {
+        if (t >= OUTAGE_START_S && t < OUTAGE_END_S) {
+            continue;
+        }
+        uint64_t stamp = (uint64_t)sourceAt(t);
+        // Channel access: usually short, sometimes a busy channel
+        double common = 200e-6 + exponential(300e-6) + (uniform(rng) < 0.02 ? 5e-3 + uniform(rng) * 15e-3 : 0);
+        for (int i = 0; i < robotCount; i++) {
+            if (uniform(rng) * 100 < lossPercent) {
+                continue;
+            }
+            // WiFi task: usually quick, sometimes busy
+            double own = exponential(20e-6) + (uniform(rng) < 0.01 ? 1e-3 + uniform(rng) * 2e-3 : 0);
+            events.push_back({t + common + own, EventType::BEACON, i, stamp, t});
+        }
+    }
+    for (double t = MOVE_INTERVAL_S; t < DURATION_S - 1; t += MOVE_INTERVAL_S) {
+        uint64_t start = (uint64_t)(sourceAt(t) + MOVE_LEAD_S * 1e6);
+        double common = 200e-6 + exponential(300e-6);
+        for (int i = 0; i < robotCount; i++) {
+            events.push_back({t + common + exponential(20e-6), EventType::MOVE, i, start, t});
+        }
+    }
+    for (double t = 0; t < DURATION_S; t += RENDER_INTERVAL_S) {
+        events.push_back({t, EventType::TICK, -1, 0, t});
+    }
+    std::stable_sort(events.begin(), events.end(), [](const Event& a, const Event& b) { return a.t < b.t; });
+
+    // Without sync: a start command sent to each robot in turn, 1.1 ms apart
+    for (int i = 0; i < robotCount; i++) {
+        robots[i].freeStartUs = robots[i].clock.at(1.0 + i * 1.1e-3);
+        robots[i].freeTimeline.start(*animation, (uint32_t)(robots[i].freeStartUs / 1000));
+    }
+
+    Stats steady;
+    Stats holdover;
+    Stats freeRunning;
+    double lockedAt = -1;
+    double relockedAt = -1;
+    std::vector<double> moveSpreadUs;
+    double moveErrorMaxUs = 0;
+    std::vector<double> moveStarts(robotCount);
+    int moveReceived = 0;
+    std::vector<uint16_t> frames(robotCount);
+    std::vector<double> fleet(robotCount);
+
+    for (const Event& event : events) {
+        if (event.type == EventType::BEACON) {
+            Robot& robot = robots[event.robot];
+            if (robot.sync.addSample(event.value, (uint64_t)robot.clock.at(event.t))) {
+                robot.lastFleetUs = 0;
+                robot.restart = true;
+            }
+            continue;
+        }
+        if (event.type == EventType::MOVE) {
+            // FleetClock::update(): start time on the local clock, one-shot timer
+            Robot& robot = robots[event.robot];
+            double localStart = (double)robot.sync.toLocal(event.value);
+            double timerJitter = exponential(20e-6);
+            moveStarts[event.robot] = robot.clock.when(localStart, event.t) + timerJitter;
+            if (++moveReceived == robotCount) {
+                moveReceived = 0;
+                double first = *std::min_element(moveStarts.begin(), moveStarts.end());
+                double last = *std::max_element(moveStarts.begin(), moveStarts.end());
+                double target = event.sent + MOVE_LEAD_S;
+                double truth = event.sent < RESTART_S ? source.when((double)event.value, target)
+                                                      : restarted.when((double)event.value, target);
+                moveSpreadUs.push_back((last - first) * 1e6);
+                for (double start : moveStarts) {
+                    moveErrorMaxUs = std::max(moveErrorMaxUs, fabs(start - truth) * 1e6);
+                }
+            }
+            continue;
+        }
+
+        // Render tick: every robot at the same true instant
+        double sourceUs = sourceAt(event.t);
+        bool allLocked = true;
+        double errorMaxUs = 0;
+        for (int i = 0; i < robotCount; i++) {
+            Robot& robot = robots[i];
+            allLocked = allLocked && robot.sync.isLocked();
+            uint64_t fleetUs = robot.sync.toFleet((uint64_t)robot.clock.at(event.t));
+            fleetUs = std::max(fleetUs, robot.lastFleetUs);
+            robot.lastFleetUs = fleetUs;
+            uint32_t nowMs = (uint32_t)(fleetUs / 1000);
+            if (robot.restart) {
+                robot.timeline.startInPhase(*animation, nowMs);
+                robot.restart = false;
+            }
+            frames[i] = robot.timeline.update(nowMs);
+            fleet[i] = (double)fleetUs;
+            errorMaxUs = std::max(errorMaxUs, fabs(fleet[i] - sourceUs));
+        }
+        if (!allLocked) {
+            continue;
+        }
+        if (lockedAt < 0) {
+            lockedAt = event.t;
+        }
+        double spreadUs = *std::max_element(fleet.begin(), fleet.end()) - *std::min_element(fleet.begin(), fleet.end());
+        bool sameFrame = std::all_of(frames.begin(), frames.end(), [&](uint16_t frame) { return frame == frames[0]; });
+        if (event.t >= RESTART_S && relockedAt < 0 && errorMaxUs < SPREAD_P99_LIMIT_US) {
+            relockedAt = event.t;
+        }
+
+        bool settling = event.t < SETTLE_S || (event.t >= RESTART_S && event.t < RESTART_S + SETTLE_S);
+        Stats* stats = event.t >= OUTAGE_START_S && event.t < OUTAGE_END_S ? &holdover : settling ? nullptr : &steady;
+        if (stats) {
+            stats->ticks++;
+            stats->sameFrame += sameFrame;
+            stats->spreadUs.push_back(spreadUs);
+            stats->errorUs.push_back(errorMaxUs);
+        }
+
+        if (event.t >= SETTLE_S) {
+            // Without sync: animation time since the command, on each local clock
+            std::vector<double> phase(robotCount);
+            for (int i = 0; i < robotCount; i++) {
+                double localUs = robots[i].clock.at(event.t);
+                phase[i] = localUs - robots[i].freeStartUs;
+                frames[i] = robots[i].freeTimeline.update((uint32_t)(localUs / 1000));
+            }
+            freeRunning.ticks++;
+            freeRunning.sameFrame +=
+                std::all_of(frames.begin(), frames.end(), [&](uint16_t frame) { return frame == frames[0]; });
+            freeRunning.spreadUs.push_back(*std::max_element(phase.begin(), phase.end()) -
+                                           *std::min_element(phase.begin(), phase.end()));
+        }
+    }
+
+    printf("%d robots, clocks within +-%.0f ppm (+-%.0f ppm wander), beacons every %.0f ms, %.0f%% lost\n\n",
+           robotCount, ppm, WANDER_PPM, BEACON_INTERVAL_S * 1000, lossPercent);
+    printf("%-26s %6s %8s %8s %8s %8s %8s %9s\n", "", "ticks", "spread", "p99", "max", "error", "max",
+           "same");
+    printf("%-26s %6s %8s %8s %8s %8s %8s %9s\n", "", "", "p50 us", "us", "us", "p99 us", "us", "frame");
+    steady.print("synced");
+    holdover.print("synced, 30 s no beacons");
+    freeRunning.print("no sync");
+    printf("\n");
+    printf("locked after %.0f ms; relocked %.0f ms after the source restarted\n", lockedAt * 1000,
+           relockedAt >= 0 ? (relockedAt - RESTART_S) * 1000 : -1.0);
+    printf("%zu MOVE_AT commands: start spread p50 %.0f us, max %.0f us; largest error %.0f us\n",
+           moveSpreadUs.size(), Stats::percentile(moveSpreadUs, 50), Stats::percentile(moveSpreadUs, 100),
+           moveErrorMaxUs);
+    printf("drift at the end (source against each robot, ppm): true -> estimated\n");
+    for (int i = 0; i < robotCount; i++) {
+        double robotPpm = robots[i].clock.ppmAt(DURATION_S);
+        double truePpm = (restarted.ppmAt(DURATION_S) - robotPpm) / (1 + robotPpm * 1e-6);
+        printf("  robot %d: %+7.2f -> %+7.2f\n", i, truePpm, robots[i].sync.getDriftPpb() / 1000.0);
+    }
+    printf("\n");
+
+    char what[128];
+    check(lockedAt >= 0 && lockedAt < 1, "all robots locked within 1 s");
+    snprintf(what, sizeof(what), "spread p99 %.0f us <= %.0f us, max %.0f us <= %.0f us",
+             Stats::percentile(steady.spreadUs, 99), SPREAD_P99_LIMIT_US, Stats::percentile(steady.spreadUs, 100),
+             SPREAD_MAX_LIMIT_US);
+    check(Stats::percentile(steady.spreadUs, 99) <= SPREAD_P99_LIMIT_US &&
+              Stats::percentile(steady.spreadUs, 100) <= SPREAD_MAX_LIMIT_US,
+          what);
+    snprintf(what, sizeof(what), "holdover spread max %.0f us <= %.0f us", Stats::percentile(holdover.spreadUs, 100),
+             HOLDOVER_LIMIT_US);
+    check(Stats::percentile(holdover.spreadUs, 100) <= HOLDOVER_LIMIT_US, what);
+    snprintf(what, sizeof(what), "same frame on all robots %.2f%% of ticks >= 99%%",
+             100.0 * steady.sameFrame / std::max(1u, steady.ticks));
+    check(steady.sameFrame >= 0.99 * steady.ticks, what);
+    snprintf(what, sizeof(what), "moves start within %.0f us <= %.0f us", Stats::percentile(moveSpreadUs, 100),
+             MOVE_LIMIT_US);
+    check(!moveSpreadUs.empty() && Stats::percentile(moveSpreadUs, 100) <= MOVE_LIMIT_US, what);
+    check(relockedAt >= 0 && relockedAt - RESTART_S <= RELOCK_LIMIT_S, "relocked within 2 s after a source restart");
+    return checkResult();
+}
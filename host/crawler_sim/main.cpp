@@ -0,0 +1,141 @@
+/**
+ * Crawler Simulator (host)
+ *
+ * Drives the firmware's MotorController with a scripted command sequence
+ * and integrates the resulting motion with CrawlerSim, far faster than real
+ * time. Used to check what a Direction or speed change does to the robot's
+ * motion and to regress control and latency changes automatically.
+ *
+ * Usage:
+ *   crawler_sim [--csv] [--dt SECONDS] [--soc FRACTION] COMMAND...
+ *
+ * Each COMMAND is DIRECTION:SECONDS where DIRECTION is one of
+ * S (stop), F (forward), B (backward), L (left), R (right).
+ * Example: crawler_sim F:2 L:0.5 F:1 S:0.5
+ *
+ * The firmware's Odometry (PWM model) runs alongside at its 50 Hz rate, and
+ * its estimate is printed next to the simulated ground truth.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "constants.h"
+#include "motor_controller.hpp"
+#include "odometry.hpp"
+#include "../sim/crawler_sim.hpp"
+
+struct Command {
+    Direction direction;
+    float seconds;
+};
+
+static bool parseCommand(const char* text, Command& command) {
+    const char* colon = strchr(text, ':');
+    if (!colon || colon == text) {
+        return false;
+    }
+    switch (text[0]) {
+    case 'S': command.direction = Direction::STOP; break;
+    case 'F': command.direction = Direction::FORWARD; break;
+    case 'B': command.direction = Direction::BACKWARD; break;
+    case 'L': command.direction = Direction::LEFT; break;
+    case 'R': command.direction = Direction::RIGHT; break;
+    default: return false;
+    }
+    command.seconds = (float)atof(colon + 1);
+    return command.seconds > 0.0f;
+}
+
+int main(int argc, char** argv) {
+    bool csv = false;
+    float dt = 0.001f;
+    float stateOfCharge = 0.8f;
+    std::vector<Command> commands;
+
+    for (int i = 1; i < argc; i++) {
+        Command command;
+        if (!strcmp(argv[i], "--csv")) {
+            csv = true;
+        } else if (!strcmp(argv[i], "--dt") && i + 1 < argc) {
+            dt = (float)atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--soc") && i + 1 < argc) {
+            stateOfCharge = (float)atof(argv[++i]);
+        } else if (parseCommand(argv[i], command)) {
+            commands.push_back(command);
+        } else {
+            fprintf(stderr, "Invalid argument %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (commands.empty()) {
+        commands = {{Direction::FORWARD, 2.0f}, {Direction::LEFT, 1.0f},
+                    {Direction::FORWARD, 2.0f}, {Direction::STOP, 1.0f}};
+    }
+
+    CrawlerSim::Params params = CrawlerSim::defaultParams();
+    CrawlerSim sim(params);
+    sim.getBattery() = Battery(params.battery, stateOfCharge);
+
+    MotorController motorController;
+    motorController.begin();
+
+    // Odometry update period of the firmware (PoseEstimator)
+    constexpr uint32_t ODOMETRY_PERIOD_US = 20000;
+    Odometry odometry;
+    float sinceOdometry = 0.0f;
+
+    if (csv) {
+        printf("time,x,y,heading,speed_a,speed_b,battery_v\n");
+    }
+
+    // CSV rows every 10 ms regardless of the physics step
+    int rowInterval = dt < 0.01f ? (int)(0.01f / dt + 0.5f) : 1;
+    float simulated = 0.0f;
+    auto start = std::chrono::steady_clock::now();
+
+    for (const auto& command : commands) {
+        motorController.executeCommand(command.direction);
+        int steps = (int)(command.seconds / dt + 0.5f);
+        for (int i = 0; i < steps; i++) {
+            sim.step(dt);
+            sinceOdometry += dt;
+            if (sinceOdometry >= ODOMETRY_PERIOD_US * 1e-6f) {
+                sinceOdometry -= ODOMETRY_PERIOD_US * 1e-6f;
+                int8_t signLeft;
+                int8_t signRight;
+                TrackModel::trackSigns(motorController.getActiveDirection(), signLeft, signRight);
+                auto duty = motorController.getAppliedDuty();
+                odometry.update(
+                    TrackModel::fromDuty(duty.motorA, TrackModel::DEADBAND_A, TrackModel::UM_PER_S_PER_DUTY_A,
+                                         signLeft, ODOMETRY_PERIOD_US),
+                    TrackModel::fromDuty(duty.motorB, TrackModel::DEADBAND_B, TrackModel::UM_PER_S_PER_DUTY_B,
+                                         signRight, ODOMETRY_PERIOD_US));
+            }
+            if (csv && i % rowInterval == 0) {
+                const auto& pose = sim.getPose();
+                printf("%.3f,%.4f,%.4f,%.4f,%.3f,%.3f,%.3f\n", sim.getTime(), pose.x, pose.y,
+                       pose.heading, sim.getMotorA().getSpeed(), sim.getMotorB().getSpeed(),
+                       sim.getBattery().getVoltage());
+            }
+        }
+        simulated += command.seconds;
+
+        if (!csv) {
+            const auto& pose = sim.getPose();
+            auto estimate = odometry.getPose();
+            printf("t=%6.2f s  direction %d  x %+.3f m  y %+.3f m  heading %+7.1f deg  battery %.2f V"
+                   "  | odometry x %+.3f m  y %+.3f m  heading %+7.1f deg\n",
+                   sim.getTime(), (int)command.direction, pose.x, pose.y,
+                   pose.heading * 180.0f / (float)M_PI, sim.getBattery().getVoltage(),
+                   estimate.x / 1000.0f, estimate.y / 1000.0f, (int16_t)estimate.heading * 180.0f / 32768.0f);
+        }
+    }
+
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    fprintf(stderr, "simulated %.1f s in %.3f ms (%.0fx real time)\n", simulated, elapsed * 1000.0,
+            elapsed > 0.0 ? simulated / elapsed : 0.0);
+    return 0;
+}
@@ -0,0 +1,484 @@
+/**
+ * ESP-NOW Receive Path Load Generator (host)
+ *
+ * Drives the firmware's receive callback (src/main.cpp, built against the
+ * stand-in HALs in host/hal) with packets from several simulated senders
+ * and reports how many are accepted or dropped and how long each takes
+ * from being sent to the end of OnDataRecv, so controller update rates can
+ * be sized for the fleet.
+ *
+ * The robot's receive path is simulated on the virtual clock:
+ *
+ *   senders -> radio channel -> RX buffers -> receive callback
+ *
+ *   senders    Each keeps up to --tx-queue packets waiting for the air;
+ *              esp_now_send fails for more (counted as send failures).
+ *   channel    One packet on the air at a time (1 Mbps ESP-NOW unicast:
+ *              preamble, frame, backoff and ACK); senders wait for it.
+ *   RX buffers --rx-queue packets wait for the WiFi task; a packet that
+ *              arrives when all are taken is dropped (after the hardware
+ *              ACK, so the sender does not notice).
+ *   callback   Runs the firmware's OnDataRecv for every packet, in order.
+ *              Its duration on the robot is the host time of each packet
+ *              kind (calibrated first, median) times --cpu-scale, plus
+ *              --overhead-us for the WiFi driver. With --serial-baud, the
+ *              callback's Serial output blocks while the 128-byte UART
+ *              FIFO is full (default: USB console, not modeled).
+ *
+ * The render loop runs at its 16 ms interval in between; it has a lower
+ * priority than the WiFi task, so it does not delay the callback.
+ *
+ * Senders send --rate packets per second in total, spread over --senders:
+ *   steady   Periodic, with a little jitter
+ *   poisson  Random (exponential) intervals
+ *   burst    --burst packets back to back, at the same average rate
+ * --malformed and --text percent of the packets are packets of invalid
+ * length and TEXT_SET packets; the rest are direction commands.
+ *
+ * Without --rate, a sweep over increasing rates is run and the highest
+ * rate with no send failures or drops and a 99th percentile latency within
+ * --budget-ms is reported.
+ *
+ * The radio, driver and CPU figures are a model: calibrate --cpu-scale and
+ * --overhead-us against timings measured on the robot.
+ *
+ * Usage:
+ *   espnow_load [--rate 200] [--senders 4] [--pattern poisson] [--burst 5]
+ *               [--malformed 5] [--text 5] [--duration 10] [--tx-queue 8]
+ *               [--rx-queue 10] [--cpu-scale 40] [--overhead-us 30] [--serial-baud 0]
+ *               [--budget-ms 20]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <random>
+#include <string>
+#include <vector>
+#include <LovyanGFX.hpp>
+#include <esp_now.h>
+#include "constants.h"
+#include "protocol.h"
+#include "motor_controller.hpp"
+#include "led_display.hpp"
+#include "animation_controller.hpp"
+#include "../sim/host_check.hpp"
+
+// Firmware (src/main.cpp)
+void setup();
+extern LGFX_Sprite arrowSprite;
+extern MotorController motorController;
+extern RobotLedDisplay ledDisplay;
+extern AnimationController animationController;
+
+// Render interval of the firmware's loop()
+static constexpr uint32_t RENDER_INTERVAL_MS = 16;
+// UART hardware FIFO (Serial writes block while it is full)
+static constexpr size_t UART_FIFO_BYTES = 128;
+// Rates of the sweep (packets per second, all senders)
+static constexpr double SWEEP_RATES[] = {10, 20, 50, 100, 200, 300, 500, 700, 1000, 1500, 2000};
+
+/**
+ * Packet kinds sent by the generator
+ */
+enum class Kind : uint8_t {
+    DIRECTION,
+    TEXT,
+    MALFORMED,
+};
+static constexpr uint8_t KIND_COUNT = 3;
+static const char* const KIND_NAMES[] = {"direction", "text", "malformed"};
+
+struct Options {
+    double rate = 0; // 0: sweep
+    int senders = 4;
+    std::string pattern = "poisson";
+    int burst = 5;
+    double malformedPercent = 5;
+    double textPercent = 5;
+    double durationS = 10;
+    size_t txQueue = 8;
+    size_t rxQueue = 10;
+    double cpuScale = 40;
+    double overheadUs = 30;
+    uint32_t serialBaud = 0;
+    double budgetMs = 20;
+};
+
+struct Packet {
+    double sendUs;
+    Kind kind;
+    std::vector<uint8_t> data;
+};
+
+struct RunResult {
+    double rate;
+    uint32_t sent = 0;
+    uint32_t sendFailed = 0;
+    uint32_t dropped = 0;
+    uint32_t delivered[KIND_COUNT] = {};
+    uint32_t accepted = 0;
+    uint32_t rejected = 0;
+    uint32_t wrongMotor = 0;
+    std::vector<double> latencyMs;
+    double channelBusy = 0; // Fraction of the run
+    double cpuBusy = 0;     // Fraction of the run spent in the receive callback
+    double serialBlockedMs = 0;
+
+    double percentile(double p) const {
+        if (latencyMs.empty()) {
+            return 0;
+        }
+        size_t index = (size_t)std::min<double>(latencyMs.size() - 1, std::floor(p / 100 * latencyMs.size()));
+        return latencyMs[index];
+    }
+};
+
+/**
+ * Time on the air of one unicast packet at 1 Mbps (microseconds): long
+ * preamble, MAC frame with the ESP-NOW vendor element, DIFS, average
+ * backoff and the ACK
+ */
+static double airtimeUs(size_t len) {
+    const double preambleUs = 192;
+    const size_t frameOverhead = 43; // MAC header, action/vendor headers, FCS
+    const double difsUs = 50;
+    const double backoffUs = 7.5 * 20;
+    const double ackUs = 10 + preambleUs + 14 * 8;
+    return preambleUs + (len + frameOverhead) * 8 + difsUs + backoffUs + ackUs;
+}
+
+static Packet makePacket(std::mt19937& rng, const Options& options, double sendUs) {
+    std::uniform_real_distribution<double> percent(0, 100);
+    double pick = percent(rng);
+    if (pick < options.malformedPercent) {
+        // Lengths the firmware must ignore, with a first byte of no packet type
+        static const size_t lengths[] = {0, 2, 3, 4, 8, 16, 64, ESP_NOW_MAX_DATA_LEN};
+        std::vector<uint8_t> data(lengths[rng() % (sizeof(lengths) / sizeof(lengths[0]))], 0);
+        for (uint8_t& byte : data) {
+            byte = (uint8_t)rng();
+        }
+        if (!data.empty()) {
+            data[0] = 0xEE;
+        }
+        return {sendUs, Kind::MALFORMED, data};
+    }
+    if (pick < options.malformedPercent + options.textPercent) {
+        std::vector<uint8_t> data = {(uint8_t)PacketType::TEXT_SET, 255, 160, 0, 0};
+        for (const char* c = "ROBOT 07"; *c; c++) {
+            data.push_back((uint8_t)*c);
+        }
+        return {sendUs, Kind::TEXT, data};
+    }
+    return {sendUs, Kind::DIRECTION, {(uint8_t)(rng() % 5)}};
+}
+
+/**
+ * Send times of all senders, merged in time order
+ */
+static std::vector<std::pair<Packet, int>> generate(const Options& options, double rate, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::vector<std::pair<Packet, int>> packets;
+    double endUs = options.durationS * 1e6;
+    double senderRate = rate / options.senders;
+    double periodUs = 1e6 / senderRate;
+    for (int sender = 0; sender < options.senders; sender++) {
+        std::uniform_real_distribution<double> phase(0, periodUs);
+        std::uniform_real_distribution<double> jitter(-0.02 * periodUs, 0.02 * periodUs);
+        std::exponential_distribution<double> interval(senderRate / 1e6);
+        double t = phase(rng);
+        while (t < endUs) {
+            if (options.pattern == "burst") {
+                for (int i = 0; i < options.burst; i++) {
+                    packets.push_back({makePacket(rng, options, t), sender});
+                }
+                t += periodUs * options.burst;
+            } else if (options.pattern == "steady") {
+                packets.push_back({makePacket(rng, options, std::max(0.0, t + jitter(rng))), sender});
+                t += periodUs;
+            } else {
+                packets.push_back({makePacket(rng, options, t), sender});
+                t += interval(rng);
+            }
+        }
+    }
+    std::stable_sort(packets.begin(), packets.end(),
+                     [](const auto& a, const auto& b) { return a.first.sendUs < b.first.sendUs; });
+    return packets;
+}
+
+/**
+ * Host time of one callback per packet kind (median of several samples)
+ */
+static void calibrate(double hostNs[KIND_COUNT]) {
+    std::mt19937 rng(1);
+    Options options;
+    for (uint8_t k = 0; k < KIND_COUNT; k++) {
+        options.malformedPercent = k == (uint8_t)Kind::MALFORMED ? 100 : 0;
+        options.textPercent = k == (uint8_t)Kind::TEXT ? 100 : 0;
+        std::vector<Packet> packets;
+        for (int i = 0; i < 64; i++) {
+            packets.push_back(makePacket(rng, options, 0));
+        }
+        std::vector<double> samples;
+        for (int s = 0; s < 7; s++) {
+            const int calls = 4096;
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < calls; i++) {
+                const Packet& packet = packets[i % packets.size()];
+                receive(packet.data.data(), (int)packet.data.size(), 0);
+            }
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            samples.push_back(std::chrono::duration<double, std::nano>(elapsed).count() / calls);
+        }
+        std::sort(samples.begin(), samples.end());
+        hostNs[k] = samples[samples.size() / 2];
+    }
+    // Back to the arrows
+    uint8_t clearText[sizeof(TextSet)] = {(uint8_t)PacketType::TEXT_SET, 255, 160, 0, 0};
+    receive(clearText, sizeof(clearText), 0);
+}
+
+static RunResult run(const Options& options, double rate, const double hostNs[KIND_COUNT]) {
+    RunResult result;
+    result.rate = rate;
+    std::vector<std::pair<Packet, int>> packets = generate(options, rate, (uint32_t)rate + 1);
+    // The run starts at the current virtual time
+    double baseUs = (double)hosthal::clockMicros;
+    double nextRenderUs = baseUs;
+
+    // Serial output during the callback and the UART FIFO level
+    size_t serialBytes = 0;
+    double fifoBytes = 0;
+    double fifoTimeUs = baseUs;
+    double uartBytesPerUs = options.serialBaud / 10.0 / 1e6;
+    hosthal::serialListener = [&](size_t bytes) { serialBytes += bytes; };
+
+    double channelFreeUs = baseUs;
+    double cpuFreeUs = baseUs;
+    double channelBusyUs = 0;
+    double cpuBusyUs = 0;
+    // End of transmission of the packets each sender still has queued, and
+    // finish times of the packets holding an RX buffer
+    std::vector<std::deque<double>> queued(options.senders);
+    std::deque<double> held;
+    for (auto& entry : packets) {
+        const Packet& packet = entry.first;
+        result.sent++;
+        double sendUs = baseUs + packet.sendUs;
+        std::deque<double>& txQueue = queued[entry.second];
+        while (!txQueue.empty() && txQueue.front() <= sendUs) {
+            txQueue.pop_front();
+        }
+        if (txQueue.size() >= options.txQueue) {
+            result.sendFailed++;
+            continue;
+        }
+        double airUs = airtimeUs(packet.data.size());
+        double arrivalUs = std::max(sendUs, channelFreeUs) + airUs;
+        channelFreeUs = arrivalUs;
+        channelBusyUs += airUs;
+        txQueue.push_back(arrivalUs);
+
+        while (!held.empty() && held.front() <= arrivalUs) {
+            held.pop_front();
+        }
+        if (held.size() >= options.rxQueue) {
+            result.dropped++;
+            continue;
+        }
+        double startUs = std::max(arrivalUs, cpuFreeUs);
+
+        // Render loop steps due before the callback runs
+        while (nextRenderUs <= startUs) {
+            hosthal::clockMicros = (uint64_t)nextRenderUs;
+            animationController.update(ledDisplay, arrowSprite, motorController.getActiveDirection(), millis());
+            nextRenderUs += RENDER_INTERVAL_MS * 1000.0;
+        }
+
+        hosthal::clockMicros = std::max(hosthal::clockMicros, (uint64_t)startUs);
+        Direction before = motorController.getActiveDirection();
+        serialBytes = 0;
+        receive(packet.data.data(), (int)packet.data.size(), (uint8_t)entry.second);
+        result.delivered[(uint8_t)packet.kind]++;
+
+        double serviceUs = options.overheadUs + hostNs[(uint8_t)packet.kind] / 1000 * options.cpuScale;
+        if (options.serialBaud > 0 && serialBytes > 0) {
+            fifoBytes = std::max(0.0, fifoBytes - (startUs - fifoTimeUs) * uartBytesPerUs);
+            double overflow = fifoBytes + serialBytes - UART_FIFO_BYTES;
+            double blockedUs = overflow > 0 ? overflow / uartBytesPerUs : 0;
+            fifoBytes = std::min<double>(UART_FIFO_BYTES, fifoBytes + serialBytes);
+            fifoTimeUs = startUs + blockedUs;
+            serviceUs += blockedUs;
+            result.serialBlockedMs += blockedUs / 1000;
+        }
+        double finishUs = startUs + serviceUs;
+        cpuFreeUs = finishUs;
+        cpuBusyUs += serviceUs;
+        held.push_back(finishUs);
+        result.latencyMs.push_back((finishUs - sendUs) / 1000);
+
+        switch (packet.kind) {
+        case Kind::DIRECTION:
+            if (motorController.getActiveDirection() == (Direction)packet.data[0]) {
+                result.accepted++;
+            } else {
+                result.wrongMotor++;
+            }
+            break;
+        case Kind::TEXT:
+            result.accepted++;
+            break;
+        case Kind::MALFORMED:
+            result.rejected++;
+            if (motorController.getActiveDirection() != before) {
+                result.wrongMotor++;
+            }
+            break;
+        }
+    }
+    hosthal::serialListener = nullptr;
+
+    double endUs = std::max({baseUs + options.durationS * 1e6, channelFreeUs, cpuFreeUs});
+    hosthal::clockMicros = std::max(hosthal::clockMicros, (uint64_t)endUs);
+    double spanUs = endUs - baseUs;
+    result.channelBusy = channelBusyUs / spanUs;
+    result.cpuBusy = cpuBusyUs / spanUs;
+    std::sort(result.latencyMs.begin(), result.latencyMs.end());
+    return result;
+}
+
+static uint32_t totalDelivered(const RunResult& result) {
+    uint32_t total = 0;
+    for (uint32_t count : result.delivered) {
+        total += count;
+    }
+    return total;
+}
+
+/**
+ * Check that every packet was handled as it should be
+ */
+static void checkRuns(const std::vector<RunResult>& results) {
+    bool accounted = true;
+    bool handled = true;
+    for (const RunResult& result : results) {
+        accounted = accounted && result.sent == result.sendFailed + result.dropped + totalDelivered(result);
+        handled = handled && result.wrongMotor == 0 && result.rejected == result.delivered[(uint8_t)Kind::MALFORMED];
+    }
+    check(accounted, "every packet was delivered, dropped or failed to send");
+    check(handled, "direction packets applied, malformed packets ignored");
+}
+
+static void printRun(const Options& options, const RunResult& result, const double hostNs[KIND_COUNT]) {
+    printf("offered %.0f pkt/s from %d senders (%s", result.rate, options.senders, options.pattern.c_str());
+    if (options.pattern == "burst") {
+        printf(" of %d", options.burst);
+    }
+    printf("), %.0f%% malformed, %.0f%% text, %.0f s\n", options.malformedPercent, options.textPercent,
+           options.durationS);
+    printf("callback on the robot (host x %.0f + %.0f us):", options.cpuScale, options.overheadUs);
+    for (uint8_t k = 0; k < KIND_COUNT; k++) {
+        printf(" %s %.1f us", KIND_NAMES[k], options.overheadUs + hostNs[k] / 1000 * options.cpuScale);
+    }
+    printf("\n\n");
+    printf("sent        %8u\n", result.sent);
+    printf("send failed %8u  (%.2f%%, sender queue full)\n", result.sendFailed,
+           result.sent ? 100.0 * result.sendFailed / result.sent : 0.0);
+    printf("dropped     %8u  (%.2f%%, RX buffers full)\n", result.dropped,
+           result.sent ? 100.0 * result.dropped / result.sent : 0.0);
+    printf("delivered   %8u  (direction %u, text %u, malformed %u)\n", totalDelivered(result),
+           result.delivered[(uint8_t)Kind::DIRECTION], result.delivered[(uint8_t)Kind::TEXT],
+           result.delivered[(uint8_t)Kind::MALFORMED]);
+    printf("accepted    %8u\n", result.accepted);
+    printf("rejected    %8u  (invalid length)\n", result.rejected);
+    printf("latency     p50 %.2f ms, p90 %.2f ms, p99 %.2f ms, max %.2f ms\n", result.percentile(50),
+           result.percentile(90), result.percentile(99), result.latencyMs.empty() ? 0.0 : result.latencyMs.back());
+    printf("channel     %5.1f%% busy\n", result.channelBusy * 100);
+    printf("callback    %5.1f%% of the CPU\n", result.cpuBusy * 100);
+    if (options.serialBaud > 0) {
+        printf("serial      %.1f ms blocked on the UART FIFO\n", result.serialBlockedMs);
+    }
+    printf("\n");
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "--rate")) {
+            options.rate = atof(argv[i + 1]);
+        } else if (!strcmp(argv[i], "--senders")) {
+            options.senders = std::max(1, atoi(argv[i + 1]));
+        } else if (!strcmp(argv[i], "--pattern")) {
+            options.pattern = argv[i + 1];
+        } else if (!strcmp(argv[i], "--burst")) {
+            options.burst = std::max(1, atoi(argv[i + 1]));
+        } else if (!strcmp(argv[i], "--malformed")) {
+            options.malformedPercent = atof(argv[i + 1]);
+        } else if (!strcmp(argv[i], "--text")) {
+            options.textPercent = atof(argv[i + 1]);
+        } else if (!strcmp(argv[i], "--duration")) {
+            options.durationS = atof(argv[i + 1]) > 0 ? atof(argv[i + 1]) : 1;
+        } else if (!strcmp(argv[i], "--tx-queue")) {
+            options.txQueue = (size_t)std::max(1, atoi(argv[i + 1]));
+        } else if (!strcmp(argv[i], "--rx-queue")) {
+            options.rxQueue = (size_t)std::max(1, atoi(argv[i + 1]));
+        } else if (!strcmp(argv[i], "--cpu-scale")) {
+            options.cpuScale = atof(argv[i + 1]);
+        } else if (!strcmp(argv[i], "--overhead-us")) {
+            options.overheadUs = atof(argv[i + 1]);
+        } else if (!strcmp(argv[i], "--serial-baud")) {
+            options.serialBaud = (uint32_t)atol(argv[i + 1]);
+        } else if (!strcmp(argv[i], "--budget-ms")) {
+            options.budgetMs = atof(argv[i + 1]);
+        }
+    }
+    if (options.pattern != "steady" && options.pattern != "poisson" && options.pattern != "burst") {
+        printf("unknown pattern '%s' (steady, poisson, burst)\n", options.pattern.c_str());
+        return 1;
+    }
+
+    hosthal::serialEnabled = false;
+    setup();
+    check(hosthal::receiveCallback != nullptr, "firmware registered an ESP-NOW receive callback");
+    double hostNs[KIND_COUNT];
+    calibrate(hostNs);
+
+    if (options.rate > 0) {
+        RunResult result = run(options, options.rate, hostNs);
+        printRun(options, result, hostNs);
+        checkRuns({result});
+    } else {
+        printf("%8s %8s %8s %8s %9s %9s %9s %8s %8s\n", "pkt/s", "sent", "failed", "dropped", "p50 ms", "p99 ms",
+               "max ms", "channel", "cpu");
+        std::vector<RunResult> results;
+        for (double rate : SWEEP_RATES) {
+            RunResult result = run(options, rate, hostNs);
+            printf("%8.0f %8u %7.2f%% %7.2f%% %9.2f %9.2f %9.2f %7.1f%% %7.1f%%\n", rate, result.sent,
+                   result.sent ? 100.0 * result.sendFailed / result.sent : 0.0,
+                   result.sent ? 100.0 * result.dropped / result.sent : 0.0, result.percentile(50),
+                   result.percentile(99), result.latencyMs.empty() ? 0.0 : result.latencyMs.back(),
+                   result.channelBusy * 100, result.cpuBusy * 100);
+            results.push_back(std::move(result));
+        }
+        printf("\n");
+        const RunResult* sustainable = nullptr;
+        for (const RunResult& result : results) {
+            if (result.sendFailed == 0 && result.dropped == 0 && result.percentile(99) <= options.budgetMs) {
+                sustainable = &result;
+            }
+        }
+        if (sustainable) {
+            printf("sustainable: %.0f pkt/s in total (%.0f per sender) with no losses and p99 <= %.0f ms\n",
+                   sustainable->rate, sustainable->rate / options.senders, options.budgetMs);
+        } else {
+            printf("no swept rate stays within p99 <= %.0f ms without losses\n", options.budgetMs);
+        }
+        checkRuns(results);
+    }
+    return checkResult();
+}
@@ -0,0 +1,267 @@
+/**
+ * Firmware Hot Path Benchmark (host)
+ *
+ * Runs the firmware itself (src/main.cpp, built against the stand-in HALs
+ * in host/hal) and times the paths that run on every frame or packet:
+ *
+ *   animation.update.<DIRECTION>  AnimationController::update at the 16 ms
+ *                                 render interval, per direction
+ *   led.show.sprite               LedDisplay::show from the sprite
+ *   led.show.frame                LedDisplay::showFrame from an arrow frame
+ *   espnow.recv.<packet>          OnDataRecv parsing and dispatch, through
+ *                                 the registered receive callback
+ *   motor.execute.<DIRECTION>     MotorController::executeCommand
+ *
+ * LED output completes at once (the RMT stand-in has no wire time), so the
+ * LED paths measure the CPU work of decoding, blending and encoding only.
+ * Each path is sampled several times and the median time per call is
+ * reported; with --output the results are written as JSON.
+ *
+ * With --compare, the results are checked against a baseline written
+ * earlier with --output, and the program fails if a path got slower by
+ * more than --threshold percent (or is missing). Baselines are only
+ * comparable on the same machine and build flags.
+ *
+ * Usage:
+ *   firmware_bench [--output results.json] [--compare baseline.json]
+ *                  [--threshold 10] [--samples 7] [--filter prefix]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <FastLED.h>
+#include <LovyanGFX.hpp>
+#include <esp_now.h>
+#include "constants.h"
+#include "motor_controller.hpp"
+#include "led_display.hpp"
+#include "animation_controller.hpp"
+#include "../sim/host_check.hpp"
+
+// Firmware (src/main.cpp)
+void setup();
+extern LGFX_Sprite arrowSprite;
+extern MotorController motorController;
+extern RobotLedDisplay ledDisplay;
+extern AnimationController animationController;
+
+static const char* const DIRECTION_NAMES[] = {"STOP", "FORWARD", "BACKWARD", "LEFT", "RIGHT"};
+static constexpr uint8_t DIRECTION_COUNT = 5;
+
+// Render interval of the firmware's loop()
+static constexpr uint32_t RENDER_INTERVAL_MS = 16;
+// Minimum duration of one sample
+static constexpr double SAMPLE_NS = 10e6;
+
+struct Result {
+    std::string name;
+    double nsPerOp;
+    long iterations;
+};
+
+template <typename Body>
+static double timeCalls(long iterations, Body& body) {
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < iterations; i++) {
+        body();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count();
+}
+
+/**
+ * Time a path: calibrate the calls per sample, then report the median of
+ * the samples
+ */
+template <typename Body>
+static Result measure(const char* name, int samples, Body body) {
+    long iterations = 1;
+    while (timeCalls(iterations, body) < SAMPLE_NS && iterations < (1L << 30)) {
+        iterations *= 2;
+    }
+    std::vector<double> perCall;
+    for (int i = 0; i < samples; i++) {
+        perCall.push_back(timeCalls(iterations, body) / iterations);
+    }
+    std::sort(perCall.begin(), perCall.end());
+    return {name, perCall[perCall.size() / 2], iterations};
+}
+
+static void writeJson(const char* path, const std::vector<Result>& results) {
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        printf("%s: cannot write\n", path);
+        failures++;
+        return;
+    }
+    fprintf(file, "{\n  \"tool\": \"firmware_bench\",\n");
+    fprintf(file, "  \"led_async_output\": %d,\n", LED_ASYNC_OUTPUT_ENABLED);
+    fprintf(file, "  \"benchmarks\": [\n");
+    for (size_t i = 0; i < results.size(); i++) {
+        // One benchmark per line (read back by readJson)
+        fprintf(file, "    {\"name\": \"%s\", \"ns_per_op\": %.1f, \"iterations\": %ld}%s\n", results[i].name.c_str(),
+                results[i].nsPerOp, results[i].iterations, i + 1 < results.size() ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+    fclose(file);
+}
+
+/**
+ * Read the results from a file written by writeJson
+ */
+static bool readJson(const char* path, std::vector<Result>& results) {
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        return false;
+    }
+    char line[512];
+    while (fgets(line, sizeof(line), file)) {
+        const char* name = strstr(line, "\"name\": \"");
+        const char* time = strstr(line, "\"ns_per_op\": ");
+        if (!name || !time) {
+            continue;
+        }
+        name += strlen("\"name\": \"");
+        const char* end = strchr(name, '"');
+        if (!end) {
+            continue;
+        }
+        results.push_back({std::string(name, end), atof(time + strlen("\"ns_per_op\": ")), 0});
+    }
+    fclose(file);
+    return true;
+}
+
+/**
+ * Check the results against a baseline
+ */
+static void compare(const char* path, const std::vector<Result>& results, double threshold, const char* filter) {
+    std::vector<Result> baseline;
+    if (!readJson(path, baseline) || baseline.empty()) {
+        printf("%s: no baseline results\n", path);
+        failures++;
+        return;
+    }
+    printf("\ncompared with %s (threshold %+.1f%%):\n", path, threshold);
+    for (const Result& base : baseline) {
+        if (strncmp(base.name.c_str(), filter, strlen(filter)) != 0) {
+            continue;
+        }
+        auto current = std::find_if(results.begin(), results.end(),
+                                    [&](const Result& result) { return result.name == base.name; });
+        char what[160];
+        if (current == results.end()) {
+            snprintf(what, sizeof(what), "%s: missing", base.name.c_str());
+            check(false, what);
+            continue;
+        }
+        double change = (current->nsPerOp / base.nsPerOp - 1) * 100;
+        snprintf(what, sizeof(what), "%-26s %10.1f -> %10.1f ns (%+6.1f%%)", base.name.c_str(), base.nsPerOp,
+                 current->nsPerOp, change);
+        check(change <= threshold, what);
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* outputPath = nullptr;
+    const char* baselinePath = nullptr;
+    const char* filter = "";
+    double threshold = 10;
+    int samples = 7;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "--output")) {
+            outputPath = argv[i + 1];
+        } else if (!strcmp(argv[i], "--compare")) {
+            baselinePath = argv[i + 1];
+        } else if (!strcmp(argv[i], "--threshold")) {
+            threshold = atof(argv[i + 1]);
+        } else if (!strcmp(argv[i], "--samples")) {
+            samples = std::max(1, atoi(argv[i + 1]));
+        } else if (!strcmp(argv[i], "--filter")) {
+            filter = argv[i + 1];
+        }
+    }
+
+    hosthal::serialEnabled = false;
+    setup();
+    check(hosthal::receiveCallback != nullptr, "firmware registered an ESP-NOW receive callback");
+
+    std::vector<Result> results;
+    auto run = [&](const std::string& name, auto body) {
+        if (strncmp(name.c_str(), filter, strlen(filter)) == 0) {
+            results.push_back(measure(name.c_str(), samples, body));
+        }
+    };
+
+    // Render loop: one call per render interval on the virtual clock, after
+    // the crossfade from the previous direction has finished
+    uint32_t nowMs = 0;
+    for (uint8_t d = 0; d < DIRECTION_COUNT; d++) {
+        Direction direction = (Direction)d;
+        animationController.reset();
+        for (int i = 0; i < 100; i++) {
+            nowMs += RENDER_INTERVAL_MS;
+            animationController.update(ledDisplay, arrowSprite, direction, nowMs);
+        }
+        run(std::string("animation.update.") + DIRECTION_NAMES[d], [&] {
+            nowMs += RENDER_INTERVAL_MS;
+            animationController.update(ledDisplay, arrowSprite, direction, nowMs);
+        });
+    }
+
+    // LED output
+    for (uint8_t y = 0; y < RobotLedDisplay::LED_MATRIX_HEIGHT; y++) {
+        for (uint8_t x = 0; x < RobotLedDisplay::LED_MATRIX_WIDTH; x++) {
+            arrowSprite.setColor(arrowSprite.color565(x * 16, y * 16, 128));
+            arrowSprite.drawPixel(x, y);
+        }
+    }
+    run("led.show.sprite", [&] { ledDisplay.show(arrowSprite); });
+    const AnimationAsset* forward = findAnimation("forward");
+    check(forward != nullptr, "arrow animation 'forward' available");
+    if (forward) {
+        uint16_t frame = 0;
+        run("led.show.frame", [&] {
+            ledDisplay.showFrame(forward->frame(frame));
+            frame = (uint16_t)((frame + 1) % forward->frameCount);
+        });
+    }
+
+    // ESP-NOW receive path
+    uint8_t direction = 0;
+    run("espnow.recv.direction", [&] {
+        direction = (uint8_t)((direction + 1) % DIRECTION_COUNT);
+        receive(&direction, 1);
+    });
+    uint8_t text[sizeof(TextSet) + 16] = {(uint8_t)PacketType::TEXT_SET, 255, 160, 0, 0};
+    memcpy(text + sizeof(TextSet), "ROBOT 07 BAT 87%", 16);
+    run("espnow.recv.text", [&] { receive(text, sizeof(text)); });
+    // Clear the text again so later paths show arrows
+    receive(text, sizeof(TextSet));
+    uint8_t unknown[2] = {0xFF, 0};
+    run("espnow.recv.unknown", [&] { receive(unknown, sizeof(unknown)); });
+
+    // Motor commands
+    for (uint8_t d = 0; d < DIRECTION_COUNT; d++) {
+        Direction command = (Direction)d;
+        run(std::string("motor.execute.") + DIRECTION_NAMES[d],
+            [&] { motorController.executeCommand(command); });
+    }
+
+    printf("%-26s %12s %12s\n", "path", "ns/call", "calls/sample");
+    for (const Result& result : results) {
+        printf("%-26s %12.1f %12ld\n", result.name.c_str(), result.nsPerOp, result.iterations);
+    }
+    if (outputPath) {
+        writeJson(outputPath, results);
+    }
+    if (baselinePath) {
+        compare(baselinePath, results, threshold, filter);
+    }
+    return checkResult();
+}
@@ -0,0 +1,230 @@
+/**
+ * Fleet Command Fan-out Check (host)
+ *
+ * Runs FleetAddress for a simulated fleet, each robot with its own NVS:
+ * - Assigns robot IDs and groups with IDENTITY_SET, checks that a
+ *   broadcast IDENTITY_SET is ignored, and that the assignment survives a
+ *   restart (FleetAddress loaded again from NVS)
+ * - Sends random FLEET_COMMAND packets in robot and group mode (plus
+ *   packets of the wrong length) and checks every robot's command against
+ *   a plain decode that scans all slots
+ * - Times the slot lookup for packets with 1 and with the most slots
+ * - Compares the airtime of one broadcast FLEET_COMMAND with unicasting a
+ *   1-byte command to each robot, and how long the last robot waits
+ *
+ * Usage:
+ *   fleet_fanout [--robots 24] [--packets 5000] [--seed 1]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include <esp_now.h>
+#include <Preferences.h>
+#include "fleet_address.hpp"
+#include "protocol.h"
+#include "../sim/host_check.hpp"
+
+/**
+ * A robot: its address and its own NVS contents
+ */
+struct Robot {
+    uint8_t mac[ESP_NOW_ETH_ALEN];
+    std::map<std::string, uint32_t> nvs;
+    FleetAddress address;
+
+    // Run FleetAddress calls against this robot's NVS
+    template <typename F>
+    void withNvs(F f) {
+        hosthal::nvs.swap(nvs);
+        f();
+        hosthal::nvs.swap(nvs);
+    }
+};
+
+static void deliver(Robot& robot, const uint8_t* destination, const std::vector<uint8_t>& packet) {
+    static uint8_t controller[ESP_NOW_ETH_ALEN] = {0x24, 0x6F, 0x28, 0x01, 0x02, 0x03};
+    static wifi_pkt_rx_ctrl_t rxCtrl = {-50};
+    esp_now_recv_info_t info = {controller, const_cast<uint8_t*>(destination), &rxCtrl};
+    robot.address.handleIdentity(&info, packet.data(), (int)packet.size());
+}
+
+static std::vector<uint8_t> identityPacket(uint8_t robotId, uint32_t groups) {
+    IdentitySet identity = {PacketType::IDENTITY_SET, robotId, groups};
+    const uint8_t* bytes = (const uint8_t*)&identity;
+    return std::vector<uint8_t>(bytes, bytes + sizeof(identity));
+}
+
+static std::vector<uint8_t> fleetPacket(FleetSlotMode mode, uint8_t first, const std::vector<uint8_t>& slots) {
+    FleetCommand command = {PacketType::FLEET_COMMAND, mode, first, (uint8_t)slots.size()};
+    const uint8_t* bytes = (const uint8_t*)&command;
+    std::vector<uint8_t> packet(bytes, bytes + sizeof(command));
+    for (uint8_t slot : slots) {
+        packet.push_back(slot);
+    }
+    return packet;
+}
+
+/**
+ * Plain decode: scan every slot for one this robot follows
+ */
+static bool expectedCommand(const std::vector<uint8_t>& packet, uint8_t robotId, uint32_t groups,
+                            uint8_t& direction) {
+    FleetCommand command;
+    memcpy(&command, packet.data(), sizeof(command));
+    for (int slot = 0; slot < command.count; slot++) {
+        int target = command.first + slot;
+        bool addressed = command.mode == FleetSlotMode::ROBOT
+                             ? robotId != ROBOT_ID_NONE && target == robotId
+                             : target < FLEET_GROUP_COUNT && (groups >> target & 1);
+        if (addressed) {
+            // Lowest-numbered addressed group wins, even if it has no command
+            uint8_t value = packet[sizeof(FleetCommand) + slot];
+            direction = value;
+            return value != FLEET_SLOT_SKIP;
+        }
+    }
+    return false;
+}
+
+/**
+ * Time on the air at 1 Mbps (microseconds), as in espnow_load: preamble,
+ * MAC frame with the ESP-NOW vendor element, DIFS, average backoff, and
+ * the ACK for unicast packets (broadcasts are not acknowledged)
+ */
+static double airtimeUs(size_t len, bool unicast) {
+    const double preambleUs = 192;
+    const size_t frameOverhead = 43;
+    const double difsUs = 50;
+    const double backoffUs = 7.5 * 20;
+    const double ackUs = 10 + preambleUs + 14 * 8;
+    return preambleUs + (len + frameOverhead) * 8 + difsUs + backoffUs + (unicast ? ackUs : 0);
+}
+
+/**
+ * Time one slot lookup (nanoseconds)
+ */
+static double lookupNs(const FleetAddress& address, const std::vector<uint8_t>& packet) {
+    const int calls = 2000000;
+    uint32_t found = 0;
+    Direction direction;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < calls; i++) {
+        // Keep the compiler from hoisting the lookup out of the loop
+        asm volatile("" ::: "memory");
+        found += address.commandFor(packet.data(), (int)packet.size(), direction);
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return found ? ns / calls : 0;
+}
+
+int main(int argc, char** argv) {
+    int robotCount = 24;
+    int packetCount = 5000;
+    unsigned seed = 1;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "--robots")) {
+            robotCount = std::max(1, std::min(atoi(argv[i + 1]), (int)ROBOT_ID_NONE));
+        } else if (!strcmp(argv[i], "--packets")) {
+            packetCount = atoi(argv[i + 1]);
+        } else if (!strcmp(argv[i], "--seed")) {
+            seed = (unsigned)atoi(argv[i + 1]);
+        }
+    }
+    std::mt19937 rng(seed);
+
+    // Identities: robot n in group n % 4 (team) and 4 + n / 8 (row)
+    std::vector<Robot> robots(robotCount);
+    std::vector<uint32_t> groupsOf(robotCount);
+    bool broadcastIgnored = true;
+    for (int i = 0; i < robotCount; i++) {
+        Robot& robot = robots[i];
+        uint8_t mac[ESP_NOW_ETH_ALEN] = {0x24, 0x6F, 0x28, 0x0A, 0x00, (uint8_t)i};
+        memcpy(robot.mac, mac, sizeof(mac));
+        groupsOf[i] = 1u << (i % 4) | 1u << std::min(4 + i / 8, FLEET_GROUP_COUNT - 1);
+        robot.withNvs([&] {
+            robot.address.begin();
+            deliver(robot, ESPNOW_BROADCAST_MAC, identityPacket(7, 0xFFFFFFFF));
+            broadcastIgnored = broadcastIgnored && robot.address.getRobotId() == ROBOT_ID_NONE;
+            deliver(robot, robot.mac, identityPacket((uint8_t)i, groupsOf[i]));
+            robot.address.update();
+        });
+    }
+    check(broadcastIgnored, "broadcast IDENTITY_SET ignored");
+
+    bool restored = true;
+    for (int i = 0; i < robotCount; i++) {
+        Robot& robot = robots[i];
+        robot.withNvs([&] {
+            FleetAddress reloaded;
+            reloaded.begin();
+            restored = restored && reloaded.getRobotId() == i && reloaded.getGroups() == groupsOf[i];
+        });
+    }
+    check(restored, "robot IDs and groups restored from NVS");
+
+    // Random fleet commands against the plain decode
+    uint32_t mismatches = 0;
+    uint32_t commands = 0;
+    uint32_t malformedAccepted = 0;
+    for (int n = 0; n < packetCount; n++) {
+        FleetSlotMode mode = rng() % 2 ? FleetSlotMode::GROUP : FleetSlotMode::ROBOT;
+        int limit = mode == FleetSlotMode::GROUP ? FLEET_GROUP_COUNT + 4 : robotCount + 8;
+        uint8_t first = (uint8_t)(rng() % limit);
+        std::vector<uint8_t> slots(rng() % (rng() % 8 ? 40 : FLEET_MAX_SLOTS + 1));
+        for (uint8_t& slot : slots) {
+            slot = rng() % 4 ? (uint8_t)(rng() % 5) : FLEET_SLOT_SKIP;
+        }
+        std::vector<uint8_t> packet = fleetPacket(mode, first, slots);
+        // One in ten: cut short or padded
+        bool malformed = rng() % 10 == 0;
+        if (malformed) {
+            packet.resize(rng() % 2 && !packet.empty() ? packet.size() - 1 - rng() % packet.size() : packet.size() + 1);
+        }
+        for (int i = 0; i < robotCount; i++) {
+            Direction direction = Direction::STOP;
+            bool got = robots[i].address.commandFor(packet.data(), (int)packet.size(), direction);
+            if (malformed) {
+                malformedAccepted += got;
+                continue;
+            }
+            uint8_t want = 0;
+            bool expected = expectedCommand(packet, (uint8_t)i, groupsOf[i], want);
+            commands += expected;
+            if (got != expected || (got && (uint8_t)direction != want)) {
+                mismatches++;
+            }
+        }
+    }
+    char what[128];
+    snprintf(what, sizeof(what), "%u robot commands from %d packets match the plain decode", commands, packetCount);
+    check(mismatches == 0, what);
+    check(malformedAccepted == 0, "packets of the wrong length ignored");
+
+    // Slot lookup cost for the smallest and the largest packet
+    std::vector<uint8_t> small = fleetPacket(FleetSlotMode::ROBOT, 0, {1});
+    std::vector<uint8_t> large = fleetPacket(FleetSlotMode::ROBOT, 0, std::vector<uint8_t>(FLEET_MAX_SLOTS, 1));
+    std::vector<uint8_t> groups = fleetPacket(FleetSlotMode::GROUP, 0, std::vector<uint8_t>(FLEET_GROUP_COUNT, 1));
+    printf("\nslot lookup: 1 slot %.1f ns, %d slots %.1f ns, %d groups %.1f ns\n", lookupNs(robots[0].address, small),
+           FLEET_MAX_SLOTS, lookupNs(robots[0].address, large), FLEET_GROUP_COUNT,
+           lookupNs(robots[0].address, groups));
+
+    // Airtime of one broadcast against unicasting every robot
+    printf("\n%6s %8s %12s %12s %8s\n", "robots", "packet", "broadcast", "unicast", "ratio");
+    printf("%6s %8s %12s %12s %8s\n", "", "bytes", "us", "us", "");
+    for (int robotsInFleet : {1, 2, 4, 8, 16, 32, 64, 128, (int)FLEET_MAX_SLOTS}) {
+        size_t len = sizeof(FleetCommand) + robotsInFleet;
+        double broadcastUs = airtimeUs(len, false);
+        double unicastUs = robotsInFleet * airtimeUs(1, true);
+        printf("%6d %8zu %12.0f %12.0f %7.1fx\n", robotsInFleet, len, broadcastUs, unicastUs, unicastUs / broadcastUs);
+    }
+    printf("(unicast: the last robot also gets its command that much later than the first)\n\n");
+
+    return checkResult();
+}
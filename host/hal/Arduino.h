@@ -0,0 +1,163 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+/**
+ * Arduino API Stand-in (host builds only)
+ *
+ * Provides the subset of the Arduino core used by the firmware headers so
+ * they can be compiled and run on Linux. GPIO and PWM writes are recorded
+ * and forwarded to an optional listener (e.g. the crawler simulator), and
+ * time is a virtual clock advanced by the host program, so simulations run
+ * as fast as the CPU allows.
+ */
+
+#include <functional>
+#include <math.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+
+// Seeed Studio XIAO ESP32-C6 pin mapping (Dx -> GPIO number)
+static constexpr uint8_t D0 = 0;
+static constexpr uint8_t D1 = 1;
+static constexpr uint8_t D2 = 2;
+static constexpr uint8_t D3 = 21;
+static constexpr uint8_t D4 = 22;
+static constexpr uint8_t D5 = 23;
+static constexpr uint8_t D6 = 16;
+static constexpr uint8_t D7 = 17;
+static constexpr uint8_t D8 = 19;
+static constexpr uint8_t D9 = 20;
+static constexpr uint8_t D10 = 18;
+
+// FreeRTOS critical sections (host programs are single-threaded)
+struct portMUX_TYPE {
+    uint32_t owner;
+};
+#define portMUX_INITIALIZER_UNLOCKED {0}
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+
+// FreeRTOS mutexes (never contended on the host)
+typedef void* SemaphoreHandle_t;
+#define portMAX_DELAY 0xFFFFFFFF
+inline SemaphoreHandle_t xSemaphoreCreateMutex() {
+    static int mutex;
+    return &mutex;
+}
+inline int xSemaphoreTake(SemaphoreHandle_t, uint32_t) {
+    return 1;
+}
+inline int xSemaphoreGive(SemaphoreHandle_t) {
+    return 1;
+}
+
+namespace hosthal {
+
+// Number of GPIOs on the ESP32-C6
+constexpr uint8_t GPIO_COUNT = 31;
+
+// Called on every digitalWrite / analogWrite
+using PinListener = std::function<void(uint8_t pin, int value, bool analog)>;
+
+inline PinListener pinListener;
+inline int pinLevel[GPIO_COUNT] = {};
+inline int pinDuty[GPIO_COUNT] = {};
+
+// Virtual time in microseconds
+inline uint64_t clockMicros = 0;
+
+// Print Serial output to stdout
+inline bool serialEnabled = true;
+
+// Called with the length of every Serial write (also when not printed)
+using SerialListener = std::function<void(size_t bytes)>;
+
+inline SerialListener serialListener;
+
+/**
+ * Advance the virtual clock
+ *
+ * @param us Microseconds to advance
+ */
+inline void advance(uint64_t us) {
+    clockMicros += us;
+}
+
+} // namespace hosthal
+
+inline void pinMode(uint8_t, uint8_t) {}
+
+inline void digitalWrite(uint8_t pin, uint8_t value) {
+    hosthal::pinLevel[pin] = value;
+    if (hosthal::pinListener) {
+        hosthal::pinListener(pin, value, false);
+    }
+}
+
+inline int digitalRead(uint8_t pin) {
+    return hosthal::pinLevel[pin];
+}
+
+inline void analogWrite(uint8_t pin, int value) {
+    hosthal::pinDuty[pin] = value;
+    if (hosthal::pinListener) {
+        hosthal::pinListener(pin, value, true);
+    }
+}
+
+inline unsigned long millis() {
+    return (unsigned long)(hosthal::clockMicros / 1000);
+}
+
+inline unsigned long micros() {
+    return (unsigned long)hosthal::clockMicros;
+}
+
+inline void delay(uint32_t ms) {
+    hosthal::advance((uint64_t)ms * 1000);
+}
+
+/**
+ * Serial port stand-in writing to stdout
+ */
+class HostSerial {
+public:
+    void begin(unsigned long) {}
+
+    int printf(const char* format, ...) {
+        va_list args;
+        if (hosthal::serialListener) {
+            va_start(args, format);
+            int length = vsnprintf(nullptr, 0, format, args);
+            va_end(args);
+            hosthal::serialListener(length > 0 ? (size_t)length : 0);
+        }
+        if (!hosthal::serialEnabled) {
+            return 0;
+        }
+        va_start(args, format);
+        int written = vprintf(format, args);
+        va_end(args);
+        return written;
+    }
+
+    void print(const char* text) {
+        printf("%s", text);
+    }
+
+    void println(const char* text = "") {
+        printf("%s\n", text);
+    }
+};
+
+inline HostSerial Serial;
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,92 @@
+#ifndef HOST_FASTLED_H
+#define HOST_FASTLED_H
+
+/**
+ * FastLED Stand-in (host builds only)
+ *
+ * Covers the blocking output path of LedDisplay
+ * (LED_ASYNC_OUTPUT_ENABLED=0): controllers are recorded, and show() hands
+ * each controller's LED data to an optional listener.
+ */
+
+#include <Arduino.h>
+#include <functional>
+#include <vector>
+
+struct CRGB {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+
+    CRGB() = default;
+    constexpr CRGB(uint8_t r, uint8_t g, uint8_t b) : r(r), g(g), b(b) {}
+};
+
+enum EOrder {
+    RGB,
+    GRB,
+};
+
+struct WS2812B {
+};
+
+#define DISABLE_DITHER 0
+#define BINARY_DITHER 1
+
+class CLEDController {
+public:
+    CLEDController(uint8_t pin, CRGB* leds, int count) : pin(pin), leds(leds), count(count) {}
+
+    CLEDController& setCorrection(CRGB) {
+        return *this;
+    }
+
+    uint8_t pin;
+    CRGB* leds;
+    int count;
+};
+
+namespace hosthal {
+
+// Called on show() for every controller
+using ShowListener = std::function<void(uint8_t pin, const CRGB* leds, int count)>;
+
+inline ShowListener showListener;
+
+} // namespace hosthal
+
+class HostFastLED {
+public:
+    template <typename Chipset, uint8_t Pin, EOrder Order>
+    CLEDController& addLeds(CRGB* leds, int count) {
+        controllers.push_back(new CLEDController(Pin, leds, count));
+        return *controllers.back();
+    }
+
+    void setBrightness(uint8_t scale) {
+        brightness = scale;
+    }
+
+    void setDither(uint8_t mode) {
+        dither = mode;
+    }
+
+    void show() {
+        if (!hosthal::showListener) {
+            return;
+        }
+        for (CLEDController* controller : controllers) {
+            hosthal::showListener(controller->pin, controller->leds, controller->count);
+        }
+    }
+
+    uint8_t brightness = 255;
+    uint8_t dither = BINARY_DITHER;
+
+private:
+    std::vector<CLEDController*> controllers;
+};
+
+inline HostFastLED FastLED;
+
+#endif // HOST_FASTLED_H
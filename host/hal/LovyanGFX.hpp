@@ -0,0 +1,80 @@
+#ifndef HOST_LOVYANGFX_HPP
+#define HOST_LOVYANGFX_HPP
+
+/**
+ * LovyanGFX Stand-in (host builds only)
+ *
+ * An RGB565 sprite with the drawing calls the firmware uses. Components
+ * are read back with bit replication, like LovyanGFX's readPixelRGB.
+ */
+
+#include <stdint.h>
+#include <vector>
+
+namespace lgfx {
+
+struct rgb888_t {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+};
+
+} // namespace lgfx
+
+class LGFX_Sprite {
+public:
+    void setColorDepth(int) {}
+
+    void* createSprite(int w, int h) {
+        width = w;
+        height = h;
+        pixels.assign((size_t)w * h, 0);
+        return pixels.data();
+    }
+
+    int getWidth() const {
+        return width;
+    }
+
+    int getHeight() const {
+        return height;
+    }
+
+    void clear() {
+        pixels.assign(pixels.size(), 0);
+    }
+
+    static constexpr uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+        return (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+    }
+
+    void setColor(uint16_t color) {
+        current = color;
+    }
+
+    void drawPixel(int x, int y) {
+        if (x >= 0 && y >= 0 && x < width && y < height) {
+            pixels[(size_t)y * width + x] = current;
+        }
+    }
+
+    uint16_t readPixel(int x, int y) const {
+        return pixels[(size_t)y * width + x];
+    }
+
+    lgfx::rgb888_t readPixelRGB(int x, int y) const {
+        uint16_t pixel = readPixel(x, y);
+        uint8_t r = (pixel >> 11) & 0x1F;
+        uint8_t g = (pixel >> 5) & 0x3F;
+        uint8_t b = pixel & 0x1F;
+        return {(uint8_t)((r << 3) | (r >> 2)), (uint8_t)((g << 2) | (g >> 4)), (uint8_t)((b << 3) | (b >> 2))};
+    }
+
+private:
+    int width = 0;
+    int height = 0;
+    uint16_t current = 0;
+    std::vector<uint16_t> pixels;
+};
+
+#endif // HOST_LOVYANGFX_HPP
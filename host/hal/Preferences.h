@@ -0,0 +1,69 @@
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+/**
+ * Preferences (NVS) Stand-in (host builds only)
+ *
+ * Values live in memory for the life of the process, so a host program can
+ * check that settings survive re-creating the object that stores them.
+ * hosthal::nvs can be cleared or swapped to simulate several devices.
+ */
+
+#include <map>
+#include <stdint.h>
+#include <string>
+
+namespace hosthal {
+
+// Stored values, keyed by "namespace/key"
+inline std::map<std::string, uint32_t> nvs;
+
+} // namespace hosthal
+
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false) {
+        space = name;
+        this->readOnly = readOnly;
+        return true;
+    }
+
+    void end() {
+        space.clear();
+    }
+
+    uint8_t getUChar(const char* key, uint8_t defaultValue = 0) {
+        return (uint8_t)get(key, defaultValue);
+    }
+
+    size_t putUChar(const char* key, uint8_t value) {
+        return put(key, value) ? 1 : 0;
+    }
+
+    uint32_t getUInt(const char* key, uint32_t defaultValue = 0) {
+        return get(key, defaultValue);
+    }
+
+    size_t putUInt(const char* key, uint32_t value) {
+        return put(key, value) ? 4 : 0;
+    }
+
+private:
+    std::string space;
+    bool readOnly = false;
+
+    uint32_t get(const char* key, uint32_t defaultValue) {
+        auto entry = hosthal::nvs.find(space + "/" + key);
+        return entry == hosthal::nvs.end() ? defaultValue : entry->second;
+    }
+
+    bool put(const char* key, uint32_t value) {
+        if (space.empty() || readOnly) {
+            return false;
+        }
+        hosthal::nvs[space + "/" + key] = value;
+        return true;
+    }
+};
+
+#endif // HOST_PREFERENCES_H
@@ -0,0 +1,23 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+/**
+ * WiFi Stand-in (host builds only)
+ */
+
+typedef enum {
+    WIFI_OFF,
+    WIFI_STA,
+    WIFI_AP,
+} wifi_mode_t;
+
+class HostWiFi {
+public:
+    bool mode(wifi_mode_t) {
+        return true;
+    }
+};
+
+inline HostWiFi WiFi;
+
+#endif // HOST_WIFI_H
@@ -0,0 +1,117 @@
+#ifndef HOST_RMT_TX_H
+#define HOST_RMT_TX_H
+
+/**
+ * RMT TX Driver Stand-in (host builds only)
+ *
+ * A transfer completes as soon as it is started: the symbols are handed to
+ * an optional listener (e.g. to decode the LED data) and the done callback
+ * runs before rmt_transmit() returns, as if the wire were infinitely fast.
+ */
+
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+#include "../esp_err.h"
+
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+
+typedef int gpio_num_t;
+
+typedef enum {
+    RMT_CLK_SRC_DEFAULT,
+} rmt_clock_source_t;
+
+typedef struct {
+    gpio_num_t gpio_num;
+    rmt_clock_source_t clk_src;
+    uint32_t resolution_hz;
+    size_t mem_block_symbols;
+    size_t trans_queue_depth;
+} rmt_tx_channel_config_t;
+
+typedef struct {
+} rmt_copy_encoder_config_t;
+
+typedef struct {
+    int loop_count;
+} rmt_transmit_config_t;
+
+typedef struct {
+    size_t num_symbols;
+} rmt_tx_done_event_data_t;
+
+typedef struct rmt_channel_t* rmt_channel_handle_t;
+typedef struct rmt_encoder_t* rmt_encoder_handle_t;
+
+typedef bool (*rmt_tx_done_callback_t)(rmt_channel_handle_t channel, const rmt_tx_done_event_data_t* edata,
+                                       void* user_ctx);
+
+typedef struct {
+    rmt_tx_done_callback_t on_trans_done;
+} rmt_tx_event_callbacks_t;
+
+struct rmt_channel_t {
+    gpio_num_t gpio;
+    rmt_tx_done_callback_t onDone;
+    void* user;
+    bool enabled;
+};
+
+struct rmt_encoder_t {
+};
+
+namespace hosthal {
+
+// Called on every rmt_transmit with the symbols sent on a pin
+using RmtListener = std::function<void(uint8_t pin, const uint32_t* symbols, size_t count)>;
+
+inline RmtListener rmtListener;
+
+} // namespace hosthal
+
+inline esp_err_t rmt_new_tx_channel(const rmt_tx_channel_config_t* config, rmt_channel_handle_t* channel) {
+    *channel = new rmt_channel_t{config->gpio_num, nullptr, nullptr, false};
+    return ESP_OK;
+}
+
+inline esp_err_t rmt_new_copy_encoder(const rmt_copy_encoder_config_t*, rmt_encoder_handle_t* encoder) {
+    *encoder = new rmt_encoder_t{};
+    return ESP_OK;
+}
+
+inline esp_err_t rmt_tx_register_event_callbacks(rmt_channel_handle_t channel,
+                                                 const rmt_tx_event_callbacks_t* callbacks, void* user) {
+    channel->onDone = callbacks->on_trans_done;
+    channel->user = user;
+    return ESP_OK;
+}
+
+inline esp_err_t rmt_enable(rmt_channel_handle_t channel) {
+    channel->enabled = true;
+    return ESP_OK;
+}
+
+inline esp_err_t rmt_transmit(rmt_channel_handle_t channel, rmt_encoder_handle_t, const void* data, size_t bytes,
+                              const rmt_transmit_config_t*) {
+    if (!channel->enabled) {
+        return ESP_FAIL;
+    }
+    size_t count = bytes / sizeof(uint32_t);
+    if (hosthal::rmtListener) {
+        hosthal::rmtListener((uint8_t)channel->gpio, static_cast<const uint32_t*>(data), count);
+    }
+    if (channel->onDone) {
+        rmt_tx_done_event_data_t event = {count};
+        channel->onDone(channel, &event, channel->user);
+    }
+    return ESP_OK;
+}
+
+inline esp_err_t rmt_tx_wait_all_done(rmt_channel_handle_t, int) {
+    return ESP_OK;
+}
+
+#endif // HOST_RMT_TX_H
@@ -0,0 +1,109 @@
+#ifndef HOST_ESP_NOW_H
+#define HOST_ESP_NOW_H
+
+/**
+ * ESP-NOW Stand-in (host builds only)
+ *
+ * Keeps the peer list and the registered receive callback; sent packets go
+ * to an optional listener. Host programs deliver packets to the firmware by
+ * calling the receive callback (hosthal::receiveCallback) directly.
+ */
+
+#include <functional>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include "esp_err.h"
+
+#define ESP_NOW_ETH_ALEN 6
+#define ESP_NOW_MAX_DATA_LEN 250
+#define ESP_NOW_MAX_TOTAL_PEER_NUM 20
+
+typedef enum {
+    WIFI_IF_STA,
+    WIFI_IF_AP,
+} wifi_interface_t;
+
+typedef struct {
+    int rssi;
+} wifi_pkt_rx_ctrl_t;
+
+typedef struct {
+    uint8_t* src_addr;
+    uint8_t* des_addr;
+    wifi_pkt_rx_ctrl_t* rx_ctrl;
+} esp_now_recv_info_t;
+
+typedef struct {
+    uint8_t peer_addr[ESP_NOW_ETH_ALEN];
+    uint8_t lmk[16];
+    uint8_t channel;
+    wifi_interface_t ifidx;
+    bool encrypt;
+    void* priv;
+} esp_now_peer_info_t;
+
+typedef void (*esp_now_recv_cb_t)(const esp_now_recv_info_t* info, const uint8_t* data, int len);
+
+namespace hosthal {
+
+// Called on every esp_now_send
+using SendListener = std::function<void(const uint8_t* mac, const uint8_t* data, size_t len)>;
+
+inline SendListener sendListener;
+inline esp_now_recv_cb_t receiveCallback = nullptr;
+inline std::vector<esp_now_peer_info_t> peers;
+
+inline esp_now_peer_info_t* findPeer(const uint8_t* mac) {
+    for (auto& peer : peers) {
+        if (memcmp(peer.peer_addr, mac, ESP_NOW_ETH_ALEN) == 0) {
+            return &peer;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace hosthal
+
+inline esp_err_t esp_now_init() {
+    return ESP_OK;
+}
+
+inline esp_err_t esp_now_register_recv_cb(esp_now_recv_cb_t callback) {
+    hosthal::receiveCallback = callback;
+    return ESP_OK;
+}
+
+inline bool esp_now_is_peer_exist(const uint8_t* mac) {
+    return hosthal::findPeer(mac) != nullptr;
+}
+
+inline esp_err_t esp_now_add_peer(const esp_now_peer_info_t* peer) {
+    if (hosthal::findPeer(peer->peer_addr) || hosthal::peers.size() >= ESP_NOW_MAX_TOTAL_PEER_NUM) {
+        return ESP_FAIL;
+    }
+    hosthal::peers.push_back(*peer);
+    return ESP_OK;
+}
+
+inline esp_err_t esp_now_del_peer(const uint8_t* mac) {
+    for (size_t i = 0; i < hosthal::peers.size(); i++) {
+        if (memcmp(hosthal::peers[i].peer_addr, mac, ESP_NOW_ETH_ALEN) == 0) {
+            hosthal::peers.erase(hosthal::peers.begin() + i);
+            return ESP_OK;
+        }
+    }
+    return ESP_FAIL;
+}
+
+inline esp_err_t esp_now_send(const uint8_t* mac, const uint8_t* data, size_t len) {
+    if (len > ESP_NOW_MAX_DATA_LEN || !hosthal::findPeer(mac)) {
+        return ESP_FAIL;
+    }
+    if (hosthal::sendListener) {
+        hosthal::sendListener(mac, data, len);
+    }
+    return ESP_OK;
+}
+
+#endif // HOST_ESP_NOW_H
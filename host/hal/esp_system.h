@@ -0,0 +1,21 @@
+#ifndef HOST_ESP_SYSTEM_H
+#define HOST_ESP_SYSTEM_H
+
+/**
+ * ESP-IDF System Stand-in (host builds only)
+ */
+
+#include <stdint.h>
+
+namespace hosthal {
+
+// Reported by esp_get_free_heap_size()
+inline uint32_t freeHeap = 200000;
+
+} // namespace hosthal
+
+inline uint32_t esp_get_free_heap_size() {
+    return hosthal::freeHeap;
+}
+
+#endif // HOST_ESP_SYSTEM_H
@@ -0,0 +1,90 @@
+#ifndef HOST_ESP_TIMER_H
+#define HOST_ESP_TIMER_H
+
+/**
+ * ESP Timer Stand-in (host builds only)
+ *
+ * Timers are recorded but never fire on their own: host programs that want
+ * timer callbacks call hosthal::runTimers() as they advance the virtual
+ * clock, so a simulation stays deterministic.
+ */
+
+#include <Arduino.h>
+#include <vector>
+#include "esp_err.h"
+
+typedef void (*esp_timer_cb_t)(void* arg);
+
+typedef enum {
+    ESP_TIMER_TASK,
+    ESP_TIMER_ISR,
+} esp_timer_dispatch_t;
+
+typedef struct {
+    esp_timer_cb_t callback;
+    void* arg;
+    esp_timer_dispatch_t dispatch_method;
+    const char* name;
+    bool skip_unhandled_events;
+} esp_timer_create_args_t;
+
+struct esp_timer {
+    esp_timer_cb_t callback;
+    void* arg;
+    uint64_t period;
+    uint64_t due;
+    bool running;
+};
+
+typedef struct esp_timer* esp_timer_handle_t;
+
+namespace hosthal {
+
+inline std::vector<esp_timer*> timers;
+
+/**
+ * Fire all timers that are due on the virtual clock
+ */
+inline void runTimers() {
+    for (esp_timer* timer : timers) {
+        while (timer->running && timer->due <= clockMicros) {
+            // One-shot timers have no period
+            timer->running = timer->period > 0;
+            timer->due += timer->period;
+            timer->callback(timer->arg);
+        }
+    }
+}
+
+} // namespace hosthal
+
+inline esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* handle) {
+    *handle = new esp_timer{args->callback, args->arg, 0, 0, false};
+    hosthal::timers.push_back(*handle);
+    return ESP_OK;
+}
+
+inline esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period) {
+    timer->period = period;
+    timer->due = hosthal::clockMicros + period;
+    timer->running = true;
+    return ESP_OK;
+}
+
+inline esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout) {
+    timer->period = 0;
+    timer->due = hosthal::clockMicros + timeout;
+    timer->running = true;
+    return ESP_OK;
+}
+
+inline esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    timer->running = false;
+    return ESP_OK;
+}
+
+inline int64_t esp_timer_get_time() {
+    return (int64_t)hosthal::clockMicros;
+}
+
+#endif // HOST_ESP_TIMER_H
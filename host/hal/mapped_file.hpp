@@ -0,0 +1,75 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <fcntl.h>
+#include <stddef.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * MappedFile Class (host)
+ *
+ * Read-only memory mapping of a file: the host counterpart of
+ * esp_partition_mmap, so host tools read asset packs zero-copy exactly as
+ * the firmware reads the asset partition.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() {
+        close();
+    }
+
+    /**
+     * Map a file
+     *
+     * @param path File to map
+     * @return true if successful
+     */
+    bool open(const char* path) {
+        close();
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat info;
+        if (fstat(fd, &info) == 0 && info.st_size > 0) {
+            void* mapping = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED) {
+                address = mapping;
+                length = (size_t)info.st_size;
+            }
+        }
+        ::close(fd);
+        return address != nullptr;
+    }
+
+    /**
+     * Unmap the file
+     */
+    void close() {
+        if (address) {
+            munmap(address, length);
+            address = nullptr;
+            length = 0;
+        }
+    }
+
+    const void* data() const {
+        return address;
+    }
+
+    size_t size() const {
+        return length;
+    }
+
+private:
+    void* address = nullptr;
+    size_t length = 0;
+};
+
+#endif // MAPPED_FILE_HPP
@@ -0,0 +1,115 @@
+/**
+ * LED Layout Check (host)
+ *
+ * Builds layoutTable for panel layouts assembled from different policies
+ * (row order, rotations, mirrors, tilings) and checks that each table is a
+ * permutation of the LED chain and that known pixels (the display corners
+ * and the first pixels of a row or tile) land on the expected LEDs. The
+ * robot's own panel layout and the split of a tiled chain across outputs
+ * are checked the same way. Exits with status 1 if any check fails.
+ *
+ * Usage:
+ *   layout_check
+ */
+
+#include <cstdio>
+#include <vector>
+#include "led_layout.hpp"
+#include "../sim/host_check.hpp"
+
+/**
+ * Expected LED index of one display pixel
+ */
+struct Pixel {
+    uint16_t x;
+    uint16_t y;
+    uint16_t led;
+};
+
+/**
+ * Check that a layout maps every display pixel to a distinct LED
+ *
+ * @return true if layoutTable<Layout> is a permutation of 0 to LED_COUNT - 1
+ */
+template <typename Layout>
+static bool isPermutation() {
+    std::vector<bool> seen(Layout::LED_COUNT, false);
+    for (uint16_t led : layoutTable<Layout>) {
+        if (led >= Layout::LED_COUNT || seen[led]) {
+            return false;
+        }
+        seen[led] = true;
+    }
+    return true;
+}
+
+/**
+ * Check a layout: permutation and the LED index of known pixels
+ *
+ * @param name Layout name for the report
+ * @param pixels Expected LED indices
+ */
+template <typename Layout, size_t N>
+static void checkLayout(const char* name, const Pixel (&pixels)[N]) {
+    char what[96];
+    snprintf(what, sizeof(what), "%s: every pixel maps to a distinct LED", name);
+    check(isPermutation<Layout>(), what);
+
+    bool mapped = true;
+    for (const Pixel& pixel : pixels) {
+        uint16_t led = layoutTable<Layout>[pixel.y * Layout::WIDTH + pixel.x];
+        if (led != pixel.led) {
+            printf("  (%u,%u) -> LED %u, expected %u\n", pixel.x, pixel.y, led, pixel.led);
+            mapped = false;
+        }
+    }
+    snprintf(what, sizeof(what), "%s: known pixels map to the expected LEDs", name);
+    check(mapped, what);
+}
+
+int main() {
+    // 4 x 3 panel as wired; rotated by 90 or 270 degrees it is 3 x 4 on the display
+    using ProgressiveR0 = PanelLayout<4, 3, Progressive>;
+    checkLayout<ProgressiveR0>("progressive", {{0, 0, 0}, {3, 0, 3}, {0, 1, 4}, {0, 2, 8}, {3, 2, 11}});
+
+    using SerpentineR0 = PanelLayout<4, 3, Serpentine>;
+    checkLayout<SerpentineR0>("serpentine", {{0, 0, 0}, {3, 0, 3}, {3, 1, 4}, {0, 1, 7}, {0, 2, 8}, {3, 2, 11}});
+
+    using ProgressiveR90 = PanelLayout<4, 3, Progressive, Orientation<Rotation::R90>>;
+    check(ProgressiveR90::WIDTH == 3 && ProgressiveR90::HEIGHT == 4, "rotated 90: width and height swap");
+    checkLayout<ProgressiveR90>("rotated 90", {{2, 0, 0}, {2, 3, 3}, {0, 0, 8}, {0, 3, 11}});
+
+    using ProgressiveR180 = PanelLayout<4, 3, Progressive, Orientation<Rotation::R180>>;
+    checkLayout<ProgressiveR180>("rotated 180", {{3, 2, 0}, {0, 2, 3}, {3, 0, 8}, {0, 0, 11}});
+
+    using ProgressiveR270 = PanelLayout<4, 3, Progressive, Orientation<Rotation::R270>>;
+    checkLayout<ProgressiveR270>("rotated 270", {{0, 3, 0}, {0, 0, 3}, {2, 3, 8}, {2, 0, 11}});
+
+    using MirroredX = PanelLayout<4, 3, Progressive, Orientation<Rotation::R0, true, false>>;
+    checkLayout<MirroredX>("mirrored columns", {{3, 0, 0}, {0, 0, 3}, {3, 2, 8}, {0, 2, 11}});
+
+    using MirroredY = PanelLayout<4, 3, Progressive, Orientation<Rotation::R0, false, true>>;
+    checkLayout<MirroredY>("mirrored rows", {{0, 2, 0}, {3, 2, 3}, {0, 0, 8}, {3, 0, 11}});
+
+    // 2 x 2 panels of 4 x 3: 8 x 6 display, 12 LEDs per panel
+    using Tiled = PanelLayout<4, 3, Progressive, Orientation<>, Tiling<2, 2>>;
+    checkLayout<Tiled>("2x2 tiles", {{0, 0, 0}, {4, 0, 12}, {0, 3, 24}, {4, 3, 36}, {7, 5, 47}});
+
+    using TiledSerpentine = PanelLayout<4, 3, Progressive, Orientation<>, Tiling<2, 2, true>>;
+    checkLayout<TiledSerpentine>("2x2 tiles, serpentine chain", {{4, 0, 12}, {4, 3, 24}, {0, 3, 36}, {3, 5, 47}});
+
+    using TiledRotated = PanelLayout<4, 3, Serpentine, Orientation<Rotation::R90>, Tiling<2, 1>>;
+    checkLayout<TiledRotated>("2x1 tiles, rotated 90, serpentine", {{2, 0, 0}, {1, 0, 7}, {0, 3, 11}, {5, 0, 12}, {3, 3, 23}});
+
+    // Display columns run along the LED rows of the robot's panel
+    checkLayout<RobotPanelLayout>("robot panel", {{0, 0, 0}, {0, 1, 1}, {0, 15, 15}, {1, 15, 16}, {15, 0, 255}});
+
+    // Three panels on two outputs: the first output takes the extra panel
+    using SplitChain = PanelLayout<4, 3, Progressive, Orientation<>, Tiling<3, 1>, 2>;
+    LedSegment first = SplitChain::segment(0);
+    LedSegment second = SplitChain::segment(1);
+    check(first.first == 0 && first.count == 24 && second.first == 24 && second.count == 12,
+          "3 panels on 2 outputs: contiguous segments covering the chain");
+
+    return checkResult();
+}
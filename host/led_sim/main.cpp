@@ -0,0 +1,329 @@
+/**
+ * LED Matrix Simulator (host)
+ *
+ * Runs the firmware (src/main.cpp, built against the stand-in HALs in
+ * host/hal) through a fixed script of received packets on the virtual
+ * clock: stop, each direction for one full animation cycle (including the
+ * crossfade into it), and a scrolling text. Every frame sent to the LEDs is
+ * captured from the output, mapped back to display order (LedCapture) and
+ * hashed.
+ *
+ * With --golden, the frame hashes are checked against a golden file and
+ * the program fails at the first frame of each scene that differs, so a
+ * change to the rendering path can be proven to give bit-identical output.
+ * --write-golden records a new golden file after an intended change.
+ *
+ * Frames can be exported as an animated GIF and as PPM images, each LED
+ * drawn as a block of --scale pixels. LED levels on the wire are dim
+ * (brightness limit, gamma), so exported images are brightened to the
+ * brightest level of the capture and gamma encoded for viewing; hashes
+ * always cover the raw levels.
+ *
+ * Usage:
+ *   led_sim [--golden FILE] [--write-golden FILE] [--gif FILE]
+ *           [--ppm DIR] [--scale 8]
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+#include <esp_now.h>
+#include "constants.h"
+#include "assets.h"
+#include "led_display.hpp"
+#include "protocol.h"
+#include "../sim/gif_writer.hpp"
+#include "../sim/led_capture.hpp"
+#include "../sim/host_check.hpp"
+
+// Firmware (src/main.cpp)
+void setup();
+void loop();
+
+using Capture = LedCapture<RobotPanelLayout>;
+
+static constexpr uint16_t WIDTH = RobotPanelLayout::WIDTH;
+static constexpr uint16_t HEIGHT = RobotPanelLayout::HEIGHT;
+// Time shown while stopped and for the text
+static constexpr uint32_t STOP_MS = 1000;
+static constexpr uint32_t TEXT_MS = 3000;
+
+/**
+ * One step of the script: a received packet, then the firmware's loop()
+ * for a while
+ */
+struct Scene {
+    std::string label;
+    std::vector<uint8_t> packet;
+    uint32_t durationMs;
+};
+
+struct CapturedFrame {
+    std::string label;
+    size_t index;    // Frame number within the scene
+    uint32_t timeMs; // Since the start of the scene
+    uint64_t hash;
+    const Capture::Frame* frame;
+};
+
+/**
+ * Duration of one cycle of an animation
+ */
+static uint32_t cycleMs(const char* name) {
+    const AnimationAsset* animation = findAnimation(name);
+    uint32_t total = 0;
+    for (uint16_t frame = 0; animation && frame < animation->frameCount; frame++) {
+        total += animation->frameDurations[frame];
+    }
+    return total;
+}
+
+static std::vector<Scene> buildScript() {
+    std::vector<Scene> script;
+    script.push_back({"STOP", {(uint8_t)Direction::STOP}, STOP_MS});
+    script.push_back({"FORWARD", {(uint8_t)Direction::FORWARD}, cycleMs("forward")});
+    script.push_back({"BACKWARD", {(uint8_t)Direction::BACKWARD}, cycleMs("backward")});
+    script.push_back({"LEFT", {(uint8_t)Direction::LEFT}, cycleMs("left")});
+    script.push_back({"RIGHT", {(uint8_t)Direction::RIGHT}, cycleMs("right")});
+
+    const char* text = "ROBOT 07";
+    Scene scene = {"TEXT", {(uint8_t)PacketType::TEXT_SET, 255, 160, 0, 0}, TEXT_MS};
+    scene.packet.insert(scene.packet.end(), text, text + strlen(text));
+    script.push_back(scene);
+    return script;
+}
+
+/**
+ * Read a golden file: "label index time_ms hash" per line
+ */
+static bool readGolden(const char* path, std::map<std::string, std::vector<uint64_t>>& golden) {
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        return false;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), file)) {
+        char label[64];
+        size_t index;
+        unsigned timeMs;
+        unsigned long long hash;
+        if (line[0] == '#' || sscanf(line, "%63s %zu %u %llx", label, &index, &timeMs, &hash) != 4) {
+            continue;
+        }
+        std::vector<uint64_t>& hashes = golden[label];
+        if (hashes.size() <= index) {
+            hashes.resize(index + 1);
+        }
+        hashes[index] = hash;
+    }
+    fclose(file);
+    return true;
+}
+
+static bool writeGolden(const char* path, const std::vector<CapturedFrame>& frames) {
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        return false;
+    }
+    fprintf(file, "# led_sim golden frames: scene, frame, time since scene start (ms), FNV-1a hash of the LED levels\n");
+    for (const CapturedFrame& frame : frames) {
+        fprintf(file, "%s %zu %u %016llx\n", frame.label.c_str(), frame.index, frame.timeMs,
+                (unsigned long long)frame.hash);
+    }
+    return fclose(file) == 0;
+}
+
+/**
+ * Check every scene against the golden hashes, reporting the first frame
+ * that differs
+ */
+static void compareGolden(const char* path, const std::vector<Scene>& script,
+                          const std::vector<CapturedFrame>& frames) {
+    std::map<std::string, std::vector<uint64_t>> golden;
+    if (!readGolden(path, golden) || golden.empty()) {
+        printf("%s: no golden frames\n", path);
+        failures++;
+        return;
+    }
+    for (const Scene& scene : script) {
+        const std::vector<uint64_t>& expected = golden[scene.label];
+        size_t count = 0;
+        long firstDiff = -1;
+        for (const CapturedFrame& frame : frames) {
+            if (frame.label != scene.label) {
+                continue;
+            }
+            if (firstDiff < 0 && (frame.index >= expected.size() || expected[frame.index] != frame.hash)) {
+                firstDiff = (long)frame.index;
+            }
+            count++;
+        }
+        char what[128];
+        if (firstDiff >= 0) {
+            snprintf(what, sizeof(what), "%s: frame %ld differs from %s", scene.label.c_str(), firstDiff, path);
+        } else if (count != expected.size()) {
+            snprintf(what, sizeof(what), "%s: %zu frames, golden has %zu", scene.label.c_str(), count,
+                     expected.size());
+        } else {
+            snprintf(what, sizeof(what), "%s: %zu frames match %s", scene.label.c_str(), count, path);
+        }
+        check(firstDiff < 0 && count == expected.size(), what);
+    }
+}
+
+/**
+ * Draw a frame for export: each LED as a scale x scale block with a dark
+ * border, brightened through the exposure table
+ */
+static void renderImage(const Capture::Frame& frame, const uint8_t exposure[256], int scale,
+                        std::vector<uint8_t>& image) {
+    int imageWidth = WIDTH * scale;
+    image.assign((size_t)imageWidth * HEIGHT * scale * 3, 0);
+    bool border = scale >= 4;
+    for (int y = 0; y < HEIGHT * scale; y++) {
+        for (int x = 0; x < imageWidth; x++) {
+            if (border && (x % scale == scale - 1 || y % scale == scale - 1)) {
+                continue;
+            }
+            const uint8_t* led = frame.rgb + ((y / scale) * WIDTH + x / scale) * 3;
+            uint8_t* out = &image[((size_t)y * imageWidth + x) * 3];
+            out[0] = exposure[led[0]];
+            out[1] = exposure[led[1]];
+            out[2] = exposure[led[2]];
+        }
+    }
+}
+
+static void exportFrames(const std::vector<CapturedFrame>& frames, const char* gifPath, const char* ppmDir,
+                         int scale) {
+    // Exposure: brightest level of the capture -> 255, gamma encoded
+    uint8_t peak = 1;
+    for (const CapturedFrame& captured : frames) {
+        for (uint8_t value : captured.frame->rgb) {
+            peak = value > peak ? value : peak;
+        }
+    }
+    uint8_t exposure[256];
+    for (int level = 0; level < 256; level++) {
+        double light = level < peak ? (double)level / peak : 1.0;
+        exposure[level] = (uint8_t)lround(255 * pow(light, 1 / 2.2));
+    }
+
+    GifWriter gif;
+    if (gifPath) {
+        check(gif.open(gifPath, WIDTH * scale, HEIGHT * scale), "GIF file created");
+    }
+    std::vector<uint8_t> image;
+    for (size_t i = 0; i < frames.size(); i++) {
+        renderImage(*frames[i].frame, exposure, scale, image);
+        if (gifPath) {
+            // Delays in hundredths of a second, rounded on the running time
+            size_t next = i + 1 < frames.size() ? i + 1 : i;
+            uint64_t start = frames[i].frame->timeUs / 10000;
+            uint64_t end = next != i ? frames[next].frame->timeUs / 10000 : start + 2;
+            gif.addFrame(image.data(), (uint16_t)(end > start ? end - start : 1));
+        }
+        if (ppmDir) {
+            char path[512];
+            snprintf(path, sizeof(path), "%s/%s_%03zu.ppm", ppmDir, frames[i].label.c_str(), frames[i].index);
+            FILE* file = fopen(path, "wb");
+            if (!file) {
+                printf("%s: cannot write\n", path);
+                failures++;
+                return;
+            }
+            fprintf(file, "P6\n%d %d\n255\n", WIDTH * scale, HEIGHT * scale);
+            fwrite(image.data(), 1, image.size(), file);
+            fclose(file);
+        }
+    }
+    if (gifPath) {
+        check(gif.close(), "GIF file written");
+        printf("wrote %s (%zu frames)\n", gifPath, frames.size());
+    }
+    if (ppmDir) {
+        printf("wrote %zu PPM images to %s\n", frames.size(), ppmDir);
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* goldenPath = nullptr;
+    const char* writePath = nullptr;
+    const char* gifPath = nullptr;
+    const char* ppmDir = nullptr;
+    int scale = 8;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "--golden")) {
+            goldenPath = argv[i + 1];
+        } else if (!strcmp(argv[i], "--write-golden")) {
+            writePath = argv[i + 1];
+        } else if (!strcmp(argv[i], "--gif")) {
+            gifPath = argv[i + 1];
+        } else if (!strcmp(argv[i], "--ppm")) {
+            ppmDir = argv[i + 1];
+        } else if (!strcmp(argv[i], "--scale")) {
+            scale = atoi(argv[i + 1]) > 0 ? atoi(argv[i + 1]) : 1;
+        }
+    }
+
+    // Same sparkle pattern on every run
+    srand(1);
+    hosthal::serialEnabled = false;
+    Capture capture;
+    capture.attach();
+    setup();
+
+    // Run the script; frames are tagged with the scene they belong to
+    std::vector<Scene> script = buildScript();
+    std::vector<std::pair<size_t, size_t>> sceneFrames;
+    for (const Scene& scene : script) {
+        size_t first = capture.getFrames().size();
+        uint64_t end = hosthal::clockMicros + (uint64_t)scene.durationMs * 1000;
+        receive(scene.packet.data(), (int)scene.packet.size());
+        while (hosthal::clockMicros < end) {
+            loop();
+        }
+        sceneFrames.push_back({first, capture.getFrames().size()});
+    }
+    capture.detach();
+
+    std::vector<CapturedFrame> frames;
+    for (size_t s = 0; s < script.size(); s++) {
+        const auto& all = capture.getFrames();
+        size_t first = sceneFrames[s].first;
+        for (size_t i = first; i < sceneFrames[s].second; i++) {
+            uint32_t timeMs = (uint32_t)((all[i].timeUs - all[first].timeUs) / 1000);
+            frames.push_back({script[s].label, i - first, timeMs, Capture::hash(all[i]), &all[i]});
+        }
+    }
+
+    printf("%-10s %8s %8s %8s\n", "scene", "time", "frames", "unique");
+    for (size_t s = 0; s < script.size(); s++) {
+        std::map<uint64_t, int> unique;
+        for (const CapturedFrame& frame : frames) {
+            if (frame.label == script[s].label) {
+                unique[frame.hash]++;
+            }
+        }
+        size_t count = sceneFrames[s].second - sceneFrames[s].first;
+        printf("%-10s %6u ms %8zu %8zu\n", script[s].label.c_str(), script[s].durationMs, count, unique.size());
+        char what[64];
+        snprintf(what, sizeof(what), "%s: frames captured", script[s].label.c_str());
+        check(count > 0 && unique.size() > 1, what);
+    }
+
+    if (writePath) {
+        check(writeGolden(writePath, frames), "golden file written");
+    }
+    if (goldenPath) {
+        compareGolden(goldenPath, script, frames);
+    }
+    if (gifPath || ppmDir) {
+        exportFrames(frames, gifPath, ppmDir, scale);
+    }
+    return checkResult();
+}
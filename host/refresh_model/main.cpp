@@ -0,0 +1,92 @@
+/**
+ * LED Refresh Time Model (host)
+ *
+ * Projects the refresh time of a chain of WS2812B panels when it is split
+ * across parallel data outputs, using the firmware's panel split
+ * (outputSegment) and RMT bit timing (Ws2812Encoder). All outputs send at
+ * the same time, so a frame takes as long as the largest segment plus the
+ * latch period. A 1 bit takes longer than a 0 bit, so times are for the
+ * worst case (all bits 1).
+ *
+ * Usage:
+ *   refresh_model [--panels N] [--panel-leds N] [--outputs N]
+ *
+ * Without --outputs, every output count the robot can drive is listed, from
+ * 1 to LED_MAX_OUTPUTS (the ESP32-C6 has two RMT TX channels) or the number
+ * of panels if smaller.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "led_layout.hpp"
+#include "ws2812_encoder.hpp"
+
+static constexpr double NS_PER_TICK = 1e9 / Ws2812Encoder::RESOLUTION_HZ;
+
+/**
+ * Wire time of one LED segment including the latch, with every bit a 1
+ * (microseconds)
+ */
+static double segmentUs(uint16_t ledCount) {
+    // The 1 bit has the longer period
+    static_assert(Ws2812Encoder::T1H + Ws2812Encoder::T1L >= Ws2812Encoder::T0H + Ws2812Encoder::T0L,
+                  "1 bit must be the longer one");
+    double bitNs = (Ws2812Encoder::T1H + Ws2812Encoder::T1L) * NS_PER_TICK;
+    double latchNs = 2 * Ws2812Encoder::RESET_HALF * NS_PER_TICK;
+    return (ledCount * Ws2812Encoder::SYMBOLS_PER_LED * bitNs + latchNs) / 1000.0;
+}
+
+/**
+ * Print the projection for one output count
+ *
+ * @return Refresh time (microseconds)
+ */
+static double report(uint16_t panels, uint16_t panelLeds, uint8_t outputs, double singleUs) {
+    double refreshUs = 0.0;
+    printf("%u output%s:\n", outputs, outputs > 1 ? "s" : "");
+    for (uint8_t i = 0; i < outputs; i++) {
+        LedSegment segment = outputSegment(panels, panelLeds, outputs, i);
+        double us = segmentUs(segment.count);
+        printf("  output %u: LEDs %u-%u (%u), %.0f us\n", i, segment.first,
+               segment.first + segment.count - 1, segment.count, us);
+        if (us > refreshUs) {
+            refreshUs = us;
+        }
+    }
+    printf("  refresh %.0f us, max %.1f FPS, %.2fx faster than one output\n",
+           refreshUs, 1e6 / refreshUs, singleUs / refreshUs);
+    return refreshUs;
+}
+
+int main(int argc, char** argv) {
+    uint16_t panels = 4;
+    uint16_t panelLeds = 256;
+    uint8_t outputs = 0;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "--panels")) {
+            panels = (uint16_t)atoi(argv[i + 1]);
+        } else if (!strcmp(argv[i], "--panel-leds")) {
+            panelLeds = (uint16_t)atoi(argv[i + 1]);
+        } else if (!strcmp(argv[i], "--outputs")) {
+            outputs = (uint8_t)atoi(argv[i + 1]);
+        }
+    }
+    if (panels == 0 || panelLeds == 0 || (uint32_t)panels * panelLeds > 0xFFFF || outputs > panels) {
+        fprintf(stderr, "invalid configuration\n");
+        return 1;
+    }
+
+    printf("%u panels x %u LEDs = %u LEDs\n", panels, panelLeds, panels * panelLeds);
+    double singleUs = segmentUs(panels * panelLeds);
+    if (outputs) {
+        report(panels, panelLeds, outputs, singleUs);
+    } else {
+        uint16_t maxOutputs = panels < LED_MAX_OUTPUTS ? panels : LED_MAX_OUTPUTS;
+        for (uint16_t n = 1; n <= maxOutputs; n++) {
+            report(panels, panelLeds, (uint8_t)n, singleUs);
+        }
+    }
+    return 0;
+}
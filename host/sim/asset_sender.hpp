@@ -0,0 +1,253 @@
+#ifndef ASSET_SENDER_HPP
+#define ASSET_SENDER_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include "crc32.hpp"
+#include "protocol.h"
+
+/**
+ * AssetSender Class (host simulation)
+ *
+ * Controller side of the asset upload protocol (see protocol.h), as a
+ * reference for the remote controller firmware:
+ * - ASSET_BEGIN is repeated until the robot acknowledges it
+ * - up to `window` chunks past the first unacknowledged one are in flight
+ * - a chunk that an ack reports missing while a later chunk has arrived is
+ *   sent again at once (packets arrive in order, so it was lost)
+ * - if no ack arrives for `timeout`, the first unacknowledged chunk is sent
+ *   again, which makes the robot repeat its ack
+ * - after the last chunk, the sender waits for ASSET_STATUS, prompting the
+ *   robot with the last chunk on every timeout
+ */
+class AssetSender {
+public:
+    struct Stats {
+        uint32_t packets;     // Packets sent, including retransmissions
+        uint32_t resent;      // Chunks sent again
+        uint32_t timeouts;    // Retransmissions caused by a timeout
+    };
+
+    /**
+     * @param pack Pack to upload (must stay valid)
+     * @param size Pack size in bytes
+     * @param transferId Transfer identifier
+     * @param window Maximum chunks in flight (up to ASSET_WINDOW)
+     * @param timeoutUs Retransmission timeout (microseconds)
+     */
+    AssetSender(const uint8_t* pack, uint32_t size, uint16_t transferId, uint8_t window, uint32_t timeoutUs)
+        : pack(pack), size(size), transferId(transferId), window(window), timeoutUs(timeoutUs),
+          chunkCount((uint16_t)((size + ASSET_CHUNK_SIZE - 1) / ASSET_CHUNK_SIZE)),
+          acked(chunkCount, false), resend(chunkCount, false), sequence(chunkCount, 0) {}
+
+    /**
+     * Get the next packet to send
+     *
+     * @param now Current time (microseconds)
+     * @param packet Buffer of ESPNOW_MAX_PAYLOAD bytes
+     * @return Packet length, or 0 if there is nothing to send now
+     */
+    size_t poll(uint64_t now, uint8_t* packet) {
+        switch (state) {
+        case BEGIN:
+            if (stats.packets > 0 && now - lastProgress < timeoutUs) {
+                return 0;
+            }
+            lastProgress = now;
+            return makeBegin(packet);
+
+        case SENDING: {
+            uint16_t end = base + window < chunkCount ? base + window : chunkCount;
+            for (uint16_t i = base; i < next; i++) {
+                if (resend[i]) {
+                    resend[i] = false;
+                    stats.resent++;
+                    return makeChunk(i, packet);
+                }
+            }
+            if (next < end) {
+                return makeChunk(next++, packet);
+            }
+            if (now - lastProgress >= timeoutUs) {
+                lastProgress = now;
+                stats.resent++;
+                stats.timeouts++;
+                return makeChunk(base, packet);
+            }
+            return 0;
+        }
+
+        case WAITING:
+            if (now - lastProgress >= timeoutUs) {
+                lastProgress = now;
+                stats.timeouts++;
+                return makeChunk(chunkCount - 1, packet);
+            }
+            return 0;
+
+        default:
+            return 0;
+        }
+    }
+
+    /**
+     * Handle a packet from the robot
+     *
+     * @param packet Packet data
+     * @param len Packet length
+     * @param now Current time (microseconds)
+     */
+    void receive(const uint8_t* packet, size_t len, uint64_t now) {
+        if (len == sizeof(AssetAck) && packet[0] == (uint8_t)PacketType::ASSET_ACK) {
+            AssetAck ack;
+            memcpy(&ack, packet, sizeof(ack));
+            if (ack.transferId == transferId && state != DONE) {
+                handleAck(ack, now);
+            }
+        } else if (len == sizeof(AssetStatus) && packet[0] == (uint8_t)PacketType::ASSET_STATUS) {
+            AssetStatus msg;
+            memcpy(&msg, packet, sizeof(msg));
+            if (msg.transferId == transferId) {
+                status = msg.status;
+                generation = msg.generation;
+                state = DONE;
+            }
+        }
+    }
+
+    bool isDone() const {
+        return state == DONE;
+    }
+
+    AssetStatusCode getStatus() const {
+        return status;
+    }
+
+    uint32_t getGeneration() const {
+        return generation;
+    }
+
+    uint16_t getChunkCount() const {
+        return chunkCount;
+    }
+
+    // Chunks acknowledged so far
+    uint16_t getAcked() const {
+        return ackedCount;
+    }
+
+    const Stats& getStats() const {
+        return stats;
+    }
+
+    /**
+     * Build the ASSET_BEGIN packet (counted as sent)
+     *
+     * @param packet Buffer of ESPNOW_MAX_PAYLOAD bytes
+     * @return Packet length
+     */
+    size_t makeBegin(uint8_t* packet) {
+        AssetBegin msg = {};
+        msg.type = PacketType::ASSET_BEGIN;
+        msg.transferId = transferId;
+        msg.size = size;
+        msg.crc = crc32(pack, size);
+        msg.window = window;
+        memcpy(packet, &msg, sizeof(msg));
+        stats.packets++;
+        return sizeof(msg);
+    }
+
+    /**
+     * Build the ASSET_CHUNK packet of a chunk (counted as sent)
+     *
+     * @param index Chunk number
+     * @param packet Buffer of ESPNOW_MAX_PAYLOAD bytes
+     * @return Packet length
+     */
+    size_t makeChunk(uint16_t index, uint8_t* packet) {
+        uint32_t offset = (uint32_t)index * ASSET_CHUNK_SIZE;
+        uint16_t length = (uint16_t)(size - offset < ASSET_CHUNK_SIZE ? size - offset : ASSET_CHUNK_SIZE);
+        AssetChunk header = {};
+        header.type = PacketType::ASSET_CHUNK;
+        header.transferId = transferId;
+        header.index = index;
+        memcpy(packet, &header, sizeof(header));
+        // CRC over transferId, index and data
+        uint32_t crc = crc32(packet + offsetof(AssetChunk, transferId), 4);
+        header.crc = crc32(pack + offset, length, crc);
+        memcpy(packet, &header, sizeof(header));
+        memcpy(packet + sizeof(header), pack + offset, length);
+        sequence[index] = nextSequence++;
+        stats.packets++;
+        return sizeof(header) + length;
+    }
+
+private:
+    enum State : uint8_t { BEGIN, SENDING, WAITING, DONE };
+
+    const uint8_t* pack;
+    uint32_t size;
+    uint16_t transferId;
+    uint8_t window;
+    uint32_t timeoutUs;
+    uint16_t chunkCount;
+    std::vector<bool> acked;
+    std::vector<bool> resend;
+    // Transmission number of the latest copy of each chunk
+    std::vector<uint32_t> sequence;
+    uint32_t nextSequence = 1;
+    State state = BEGIN;
+    uint16_t base = 0;       // First unacknowledged chunk
+    uint16_t next = 0;       // First chunk never sent
+    uint16_t ackedCount = 0;
+    uint64_t lastProgress = 0;
+    AssetStatusCode status = AssetStatusCode::ACTIVATED;
+    uint32_t generation = 0;
+    Stats stats = {};
+
+    void handleAck(const AssetAck& ack, uint64_t now) {
+        if (state == BEGIN) {
+            state = SENDING;
+        }
+        lastProgress = now;
+        // Latest transmission known to have arrived
+        uint32_t newest = 0;
+        for (uint16_t i = base; i < ack.base && i < chunkCount; i++) {
+            markAcked(i, newest);
+        }
+        for (uint8_t n = 0; n < 32; n++) {
+            uint32_t index = (uint32_t)ack.base + 1 + n;
+            if ((ack.received & (1u << n)) && index < chunkCount) {
+                markAcked((uint16_t)index, newest);
+            }
+        }
+        while (base < chunkCount && acked[base]) {
+            base++;
+        }
+        // Sent before a chunk that arrived, but not received: lost
+        for (uint16_t i = base; i < next; i++) {
+            if (!acked[i] && sequence[i] < newest) {
+                resend[i] = true;
+            }
+        }
+        if (ackedCount == chunkCount && state == SENDING) {
+            state = WAITING;
+        }
+    }
+
+    void markAcked(uint16_t index, uint32_t& newest) {
+        if (sequence[index] > newest) {
+            newest = sequence[index];
+        }
+        if (!acked[index]) {
+            acked[index] = true;
+            resend[index] = false;
+            ackedCount++;
+        }
+    }
+};
+
+#endif // ASSET_SENDER_HPP
@@ -0,0 +1,68 @@
+#ifndef BATTERY_HPP
+#define BATTERY_HPP
+
+/**
+ * Battery Class (host simulation)
+ *
+ * Pack of four Ni-MH AA cells (4.8 V nominal) with a piecewise-linear
+ * open-circuit voltage curve and series resistance, so motor start-up
+ * currents produce the voltage sag seen on the robot.
+ */
+class Battery {
+public:
+    struct Params {
+        float capacityAh;     // Rated capacity (Ah)
+        float resistance;     // Cells + holder + wiring (ohm)
+        int cells;            // Cells in series
+    };
+
+    static constexpr Params NIMH_4AA = {2.0f, 0.25f, 4};
+
+    explicit Battery(Params params = NIMH_4AA, float stateOfCharge = 1.0f)
+        : params(params), charge(stateOfCharge) {}
+
+    /**
+     * Draw current for one time step
+     *
+     * @param amps Total load current (A)
+     * @param dt Time step (seconds)
+     * @return Terminal voltage under this load (V)
+     */
+    float draw(float amps, float dt) {
+        charge -= amps * dt / (params.capacityAh * 3600.0f);
+        if (charge < 0.0f) {
+            charge = 0.0f;
+        }
+        voltage = openCircuitVoltage() - amps * params.resistance;
+        if (voltage < 0.0f) {
+            voltage = 0.0f;
+        }
+        return voltage;
+    }
+
+    /**
+     * Open-circuit pack voltage at the current state of charge
+     * (flat Ni-MH plateau around 1.25 V/cell with steep ends)
+     */
+    float openCircuitVoltage() const {
+        float cell;
+        if (charge > 0.9f) {
+            cell = 1.30f + (charge - 0.9f) * 1.5f;   // 1.30 - 1.45 V
+        } else if (charge > 0.1f) {
+            cell = 1.18f + (charge - 0.1f) * 0.15f;  // 1.18 - 1.30 V
+        } else {
+            cell = 1.00f + charge * 1.8f;            // 1.00 - 1.18 V
+        }
+        return cell * params.cells;
+    }
+
+    float getVoltage() const { return voltage; }
+    float getStateOfCharge() const { return charge; }
+
+private:
+    Params params;
+    float charge;              // State of charge (0.0 - 1.0)
+    float voltage = 0.0f;      // Terminal voltage at the last step (V)
+};
+
+#endif // BATTERY_HPP
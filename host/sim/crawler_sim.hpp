@@ -0,0 +1,173 @@
+#ifndef CRAWLER_SIM_HPP
+#define CRAWLER_SIM_HPP
+
+#include <Arduino.h>
+#include <cmath>
+#include "battery.hpp"
+#include "dc_motor.hpp"
+
+/**
+ * CrawlerSim Class (host simulation)
+ *
+ * Physics model of the TP101 crawler driven by the TB6612FNG.
+ * The simulator listens to the GPIO/PWM writes made by the firmware (through
+ * the host Arduino stand-in), decodes them like the motor driver does, and
+ * integrates both tracks, the battery and the chassis pose at a fixed step.
+ *
+ * Wiring (same as the robot):
+ * - Motor A = left track:  PWMA=D0, AIN2=D1, AIN1=D2
+ * - Motor B = right track: PWMB=D5, BIN1=D3, BIN2=D4 (mounted mirrored)
+ * - STBY=D10
+ *
+ * Skid-steer Kinematics:
+ * Forward speed is the mean track speed. Yaw rate is the track speed
+ * difference over the track gauge, scaled by a slip efficiency because
+ * the tracks skid sideways while turning. Skidding also loads both motors.
+ */
+class CrawlerSim {
+public:
+    struct Params {
+        DcMotor::Params motorA;
+        DcMotor::Params motorB;
+        Battery::Params battery;
+        float sprocketRadius;  // Effective track drive radius (m)
+        float trackGauge;      // Distance between track centers (m)
+        float turnEfficiency;  // Fraction of differential speed that becomes yaw
+        float skidTorque;      // Turning resistance per track (N*m)
+        float auxCurrent;      // MCU + LED panel load (A)
+    };
+
+    struct Pose {
+        float x;       // Forward of start position (m)
+        float y;       // Left of start position (m)
+        float heading; // Counter-clockwise from start (rad)
+    };
+
+    /**
+     * Default parameters; motor B has more friction, matching the
+     * {130, 255} asymmetry of MotorController::SPEED_FORWARD
+     */
+    static Params defaultParams() {
+        return {DcMotor::TP101, DcMotor::TP101_STIFF, Battery::NIMH_4AA, 0.018f, 0.085f, 0.7f, 0.03f, 0.12f};
+    }
+
+    explicit CrawlerSim(Params params = defaultParams())
+        : params(params), motorA(params.motorA), motorB(params.motorB), battery(params.battery) {
+        hosthal::pinListener = [this](uint8_t pin, int value, bool analog) {
+            onPinWrite(pin, value, analog);
+        };
+    }
+
+    ~CrawlerSim() {
+        hosthal::pinListener = nullptr;
+    }
+
+    CrawlerSim(const CrawlerSim&) = delete;
+    CrawlerSim& operator=(const CrawlerSim&) = delete;
+
+    /**
+     * Advance the simulation by one fixed step
+     *
+     * @param dt Time step (seconds)
+     */
+    void step(float dt) {
+        float supply = battery.draw(std::fabs(motorA.getCurrent()) + std::fabs(motorB.getCurrent()) +
+                                    params.auxCurrent, dt);
+
+        // Skid resistance opposes the differential motion of the tracks
+        float differential = motorB.getSpeed() - motorA.getSpeed();
+        float skid = std::fabs(differential) > 1e-3f ? params.skidTorque : 0.0f;
+        motorA.setLoadTorque(differential > 0.0f ? -skid : skid);
+        motorB.setLoadTorque(differential > 0.0f ? skid : -skid);
+
+        driveMotor(motorA, channelA, supply, dt);
+        driveMotor(motorB, channelB, supply, dt);
+
+        float left = motorA.getSpeed() * params.sprocketRadius;
+        float right = motorB.getSpeed() * params.sprocketRadius;
+        float speed = (left + right) * 0.5f;
+        float yawRate = (right - left) / params.trackGauge * params.turnEfficiency;
+
+        pose.heading += yawRate * dt;
+        pose.x += speed * std::cos(pose.heading) * dt;
+        pose.y += speed * std::sin(pose.heading) * dt;
+        elapsed += dt;
+    }
+
+    /**
+     * Run for a duration at a fixed step
+     *
+     * @param seconds Simulated time
+     * @param dt Time step (seconds)
+     */
+    void run(float seconds, float dt = 0.001f) {
+        int steps = (int)std::lround(seconds / dt);
+        for (int i = 0; i < steps; i++) {
+            step(dt);
+        }
+    }
+
+    const Pose& getPose() const { return pose; }
+    float getTime() const { return elapsed; }
+    DcMotor& getMotorA() { return motorA; }
+    DcMotor& getMotorB() { return motorB; }
+    Battery& getBattery() { return battery; }
+
+private:
+    /**
+     * TB6612FNG input state of one channel
+     */
+    struct Channel {
+        bool in1 = false;
+        bool in2 = false;
+        uint8_t pwm = 0;
+        bool mirrored = false; // Motor mounted facing the other way
+    };
+
+    Params params;
+    DcMotor motorA;
+    DcMotor motorB;
+    Battery battery;
+    Channel channelA;
+    Channel channelB{false, false, 0, true};
+    bool standby = true;
+    Pose pose = {0.0f, 0.0f, 0.0f};
+    float elapsed = 0.0f;
+
+    /**
+     * Decode firmware pin writes into driver inputs
+     */
+    void onPinWrite(uint8_t pin, int value, bool analog) {
+        if (analog) {
+            if (pin == D0) channelA.pwm = (uint8_t)value;
+            if (pin == D5) channelB.pwm = (uint8_t)value;
+            return;
+        }
+        bool high = value != LOW;
+        if (pin == D2) channelA.in1 = high;
+        if (pin == D1) channelA.in2 = high;
+        if (pin == D3) channelB.in1 = high;
+        if (pin == D4) channelB.in2 = high;
+        if (pin == D10) standby = !high;
+    }
+
+    /**
+     * Apply the TB6612FNG truth table to one motor
+     * IN1/IN2 = H/L: CW, L/H: CCW, L/L: stop (coast), H/H: short brake
+     */
+    void driveMotor(DcMotor& motor, const Channel& channel, float supply, float dt) {
+        if (standby || (!channel.in1 && !channel.in2)) {
+            motor.coast(dt);
+            return;
+        }
+        if (channel.in1 && channel.in2) {
+            // Short brake: windings shorted through the low-side switches
+            motor.step(supply, 0, true, dt);
+            return;
+        }
+        bool clockwise = channel.in1;
+        motor.step(supply, channel.pwm, clockwise != channel.mirrored, dt);
+    }
+};
+
+#endif // CRAWLER_SIM_HPP
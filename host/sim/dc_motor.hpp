@@ -0,0 +1,117 @@
+#ifndef DC_MOTOR_HPP
+#define DC_MOTOR_HPP
+
+#include <cmath>
+#include <stdint.h>
+
+/**
+ * DcMotor Class (host simulation)
+ *
+ * Plant model of one crawler track: a geared DC motor driving the track
+ * sprocket, with all quantities referred to the sprocket shaft.
+ * The electrical time constant is far below the control period, so current
+ * is treated as quasi-static and only the mechanical state is integrated.
+ *
+ * The motor also emits encoder pulses so closed-loop controllers can be run
+ * against it exactly as they run against the PCNT counters on the robot.
+ */
+class DcMotor {
+public:
+    /**
+     * Motor and track parameters (sprocket side)
+     */
+    struct Params {
+        float resistance;      // Winding resistance (ohm)
+        float backEmf;         // Back-EMF / torque constant (V*s/rad = N*m/A)
+        float inertia;         // Motor, gearbox and track inertia (kg*m^2)
+        float viscous;         // Viscous friction (N*m*s/rad)
+        float coulomb;         // Dry friction of gearbox and track (N*m)
+        float countsPerRad;    // Encoder pulses per sprocket radian
+    };
+
+    // Typical TP101 gear motor with a 48:1 gearbox and 12-pulse encoder
+    static constexpr Params TP101 = {2.5f, 0.25f, 0.0008f, 0.002f, 0.02f, 91.7f};
+    // Same motor with a stiffer gearbox: needs about twice the duty for the
+    // same speed, like motor B on the robot (SPEED_FORWARD = {130, 255})
+    static constexpr Params TP101_STIFF = {2.5f, 0.25f, 0.0008f, 0.021f, 0.1f, 91.7f};
+
+    explicit DcMotor(Params params = TP101) : params(params) {}
+
+    /**
+     * Advance the motor state by one time step
+     *
+     * @param supplyVolts Voltage at the motor driver
+     * @param duty PWM duty (0-255)
+     * @param forward Drive polarity (ignored when duty is 0)
+     * @param dt Time step (seconds)
+     */
+    void step(float supplyVolts, uint8_t duty, bool forward, float dt) {
+        float volts = supplyVolts * duty / 255.0f * (forward ? 1.0f : -1.0f);
+        current = (volts - params.backEmf * speed) / params.resistance;
+        integrate(params.backEmf * current, dt);
+    }
+
+    /**
+     * Advance the motor state with the windings disconnected (driver outputs
+     * in high impedance), so the track coasts down on friction alone
+     *
+     * @param dt Time step (seconds)
+     */
+    void coast(float dt) {
+        current = 0.0f;
+        integrate(0.0f, dt);
+    }
+
+    /**
+     * Take the encoder pulses counted since the previous call
+     * (single-channel encoder: counts are always positive)
+     *
+     * @return Number of pulses
+     */
+    uint16_t takePulses() {
+        auto pulses = (uint16_t)pulseAccumulator;
+        pulseAccumulator -= pulses;
+        return pulses;
+    }
+
+    float getSpeed() const { return speed; }
+    float getAngle() const { return angle; }
+    float getCurrent() const { return current; }
+    void setLoadTorque(float torque) { loadTorque = torque; }
+
+private:
+    Params params;
+    float speed = 0.0f;            // Sprocket speed (rad/s)
+    float angle = 0.0f;            // Sprocket angle (rad)
+    float current = 0.0f;          // Winding current (A)
+    float loadTorque = 0.0f;       // External load from the chassis (N*m)
+    float pulseAccumulator = 0.0f; // Fractional encoder pulses
+
+    /**
+     * Integrate the mechanical state for one step
+     *
+     * @param motorTorque Electromagnetic torque (N*m)
+     * @param dt Time step (seconds)
+     */
+    void integrate(float motorTorque, float dt) {
+        float torque = motorTorque - params.viscous * speed - loadTorque;
+
+        // Dry friction holds the track until the drive torque overcomes it
+        if (std::fabs(speed) < 1e-3f && std::fabs(torque) <= params.coulomb) {
+            speed = 0.0f;
+        } else {
+            float friction = params.coulomb * (speed > 0.0f || (speed == 0.0f && torque > 0.0f) ? 1.0f : -1.0f);
+            float newSpeed = speed + (torque - friction) / params.inertia * dt;
+            // Friction cannot reverse the direction of motion within a step
+            if ((speed > 0.0f && newSpeed < 0.0f) || (speed < 0.0f && newSpeed > 0.0f)) {
+                newSpeed = 0.0f;
+            }
+            speed = newSpeed;
+        }
+
+        angle += speed * dt;
+        pulseAccumulator += std::fabs(speed) * params.countsPerRad * dt;
+    }
+};
+
+#endif // DC_MOTOR_HPP
@@ -0,0 +1,226 @@
+#ifndef GIF_WRITER_HPP
+#define GIF_WRITER_HPP
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * GifWriter Class (host)
+ *
+ * Writes an animated GIF (GIF89a, looping) from RGB frames. Each frame gets
+ * its own 256-entry color table built from the colors it uses; frames with
+ * more colors fall back to a fixed 3-3-2 palette. Pixel data is LZW
+ * compressed as the format requires.
+ */
+class GifWriter {
+public:
+    GifWriter() = default;
+    GifWriter(const GifWriter&) = delete;
+    GifWriter& operator=(const GifWriter&) = delete;
+
+    ~GifWriter() {
+        close();
+    }
+
+    /**
+     * Create the file and write the header
+     *
+     * @param path Output file
+     * @param imageWidth Frame width in pixels
+     * @param imageHeight Frame height in pixels
+     * @return true if the file was created
+     */
+    bool open(const char* path, uint16_t imageWidth, uint16_t imageHeight) {
+        close();
+        file = fopen(path, "wb");
+        if (!file) {
+            return false;
+        }
+        width = imageWidth;
+        height = imageHeight;
+        fwrite("GIF89a", 1, 6, file);
+        writeWord(width);
+        writeWord(height);
+        // No global color table, background 0, square pixels
+        const uint8_t screen[] = {0x00, 0x00, 0x00};
+        fwrite(screen, 1, sizeof(screen), file);
+        // Loop forever (NETSCAPE2.0 application extension)
+        const uint8_t loop[] = {0x21, 0xFF, 0x0B, 'N', 'E', 'T', 'S', 'C', 'A', 'P', 'E',
+                                '2',  '.',  '0',  0x03, 0x01, 0x00, 0x00, 0x00};
+        fwrite(loop, 1, sizeof(loop), file);
+        return true;
+    }
+
+    /**
+     * Append a frame
+     *
+     * @param rgb Pixels row by row, 3 bytes per pixel in R, G, B order
+     * @param delayCs Display time (hundredths of a second)
+     */
+    void addFrame(const uint8_t* rgb, uint16_t delayCs) {
+        if (!file) {
+            return;
+        }
+        size_t pixels = (size_t)width * height;
+        std::vector<uint8_t> palette(256 * 3, 0);
+        std::vector<uint8_t> indices(pixels);
+        std::unordered_map<uint32_t, uint8_t> colors;
+        bool fits = true;
+        for (size_t i = 0; i < pixels && fits; i++) {
+            uint32_t color = (uint32_t)rgb[i * 3] << 16 | rgb[i * 3 + 1] << 8 | rgb[i * 3 + 2];
+            auto found = colors.find(color);
+            if (found == colors.end()) {
+                if (colors.size() == 256) {
+                    fits = false;
+                    break;
+                }
+                uint8_t index = (uint8_t)colors.size();
+                memcpy(&palette[index * 3], rgb + i * 3, 3);
+                found = colors.emplace(color, index).first;
+            }
+            indices[i] = found->second;
+        }
+        if (!fits) {
+            // 3-3-2 palette
+            for (uint16_t index = 0; index < 256; index++) {
+                palette[index * 3] = (uint8_t)((index >> 5) * 255 / 7);
+                palette[index * 3 + 1] = (uint8_t)(((index >> 2) & 7) * 255 / 7);
+                palette[index * 3 + 2] = (uint8_t)((index & 3) * 255 / 3);
+            }
+            for (size_t i = 0; i < pixels; i++) {
+                indices[i] = (uint8_t)((rgb[i * 3] & 0xE0) | (rgb[i * 3 + 1] & 0xE0) >> 3 | rgb[i * 3 + 2] >> 6);
+            }
+        }
+
+        // Graphic control extension: frame delay, no transparency
+        const uint8_t control[] = {0x21, 0xF9, 0x04, 0x00};
+        fwrite(control, 1, sizeof(control), file);
+        writeWord(delayCs);
+        const uint8_t controlEnd[] = {0x00, 0x00};
+        fwrite(controlEnd, 1, sizeof(controlEnd), file);
+
+        // Image descriptor with a 256-entry local color table
+        fputc(0x2C, file);
+        writeWord(0);
+        writeWord(0);
+        writeWord(width);
+        writeWord(height);
+        fputc(0x87, file);
+        fwrite(palette.data(), 1, palette.size(), file);
+        writeImageData(indices);
+    }
+
+    /**
+     * Finish and close the file
+     *
+     * @return true if the file was written without errors
+     */
+    bool close() {
+        if (!file) {
+            return false;
+        }
+        fputc(0x3B, file);
+        bool ok = !ferror(file);
+        fclose(file);
+        file = nullptr;
+        return ok;
+    }
+
+private:
+    static constexpr uint8_t MIN_CODE_SIZE = 8;
+    static constexpr uint16_t CLEAR_CODE = 1 << MIN_CODE_SIZE;
+    static constexpr uint16_t END_CODE = CLEAR_CODE + 1;
+    static constexpr uint16_t MAX_CODE = 4095;
+
+    FILE* file = nullptr;
+    uint16_t width = 0;
+    uint16_t height = 0;
+    // Bit packer for the LZW codes and the current data sub-block
+    uint32_t bitBuffer = 0;
+    uint8_t bitCount = 0;
+    std::vector<uint8_t> block;
+
+    void writeWord(uint16_t value) {
+        fputc(value & 0xFF, file);
+        fputc(value >> 8, file);
+    }
+
+    void putByte(uint8_t value) {
+        block.push_back(value);
+        if (block.size() == 255) {
+            flushBlock();
+        }
+    }
+
+    void flushBlock() {
+        if (block.empty()) {
+            return;
+        }
+        fputc((int)block.size(), file);
+        fwrite(block.data(), 1, block.size(), file);
+        block.clear();
+    }
+
+    void putCode(uint16_t code, uint8_t codeSize) {
+        bitBuffer |= (uint32_t)code << bitCount;
+        bitCount += codeSize;
+        while (bitCount >= 8) {
+            putByte((uint8_t)bitBuffer);
+            bitBuffer >>= 8;
+            bitCount -= 8;
+        }
+    }
+
+    /**
+     * LZW-compress the color indices into data sub-blocks
+     * The code size grows when the decoder's table reaches the next power of
+     * two; the table is cleared when it is full.
+     */
+    void writeImageData(const std::vector<uint8_t>& indices) {
+        fputc(MIN_CODE_SIZE, file);
+        std::unordered_map<uint32_t, uint16_t> table;
+        uint8_t codeSize = MIN_CODE_SIZE + 1;
+        uint16_t nextCode = END_CODE + 1;
+        putCode(CLEAR_CODE, codeSize);
+        uint16_t prefix = indices[0];
+        for (size_t i = 1; i < indices.size(); i++) {
+            uint32_t key = (uint32_t)prefix << 8 | indices[i];
+            auto found = table.find(key);
+            if (found != table.end()) {
+                prefix = found->second;
+                continue;
+            }
+            putCode(prefix, codeSize);
+            if (nextCode <= MAX_CODE) {
+                table.emplace(key, nextCode++);
+                if (nextCode > (1u << codeSize) && codeSize < 12) {
+                    codeSize++;
+                }
+            } else {
+                putCode(CLEAR_CODE, codeSize);
+                table.clear();
+                codeSize = MIN_CODE_SIZE + 1;
+                nextCode = END_CODE + 1;
+            }
+            prefix = indices[i];
+        }
+        putCode(prefix, codeSize);
+        // The decoder adds an entry for the last code before reading the end code
+        if (nextCode == (1u << codeSize) && codeSize < 12) {
+            codeSize++;
+        }
+        putCode(END_CODE, codeSize);
+        if (bitCount > 0) {
+            putByte((uint8_t)bitBuffer);
+        }
+        bitBuffer = 0;
+        bitCount = 0;
+        flushBlock();
+        fputc(0x00, file);
+    }
+};
+
+#endif // GIF_WRITER_HPP
@@ -0,0 +1,51 @@
+#ifndef HOST_CHECK_HPP
+#define HOST_CHECK_HPP
+
+#include <esp_now.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * Host Check Helpers (host simulation)
+ *
+ * Shared by the host tools: check() prints one PASS/FAIL line per check
+ * and counts the failures, checkResult() prints the final OK/FAILED line
+ * and gives the exit code. receive() delivers a packet to the firmware
+ * through its registered receive callback, as a controller would send it.
+ */
+
+inline int failures = 0;
+
+inline void check(bool ok, const char* what) {
+    printf("%s %s\n", ok ? "PASS" : "FAIL", what);
+    if (!ok) {
+        failures++;
+    }
+}
+
+/**
+ * Print OK or FAILED
+ *
+ * @return Exit code for main()
+ */
+inline int checkResult() {
+    printf("%s\n", failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}
+
+/**
+ * Deliver a packet through the receive callback registered by the firmware
+ *
+ * @param data Packet data
+ * @param len Packet length
+ * @param sender Last byte of the controller's MAC address
+ */
+inline void receive(const uint8_t* data, int len, uint8_t sender = 0x03) {
+    static uint8_t self[ESP_NOW_ETH_ALEN] = {0x24, 0x6F, 0x28, 0x0A, 0x0B, 0x0C};
+    static wifi_pkt_rx_ctrl_t rxCtrl = {-50};
+    uint8_t mac[ESP_NOW_ETH_ALEN] = {0x24, 0x6F, 0x28, 0x01, 0x02, sender};
+    esp_now_recv_info_t info = {mac, self, &rxCtrl};
+    hosthal::receiveCallback(&info, data, len);
+}
+
+#endif // HOST_CHECK_HPP
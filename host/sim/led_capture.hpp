@@ -0,0 +1,132 @@
+#ifndef LED_CAPTURE_HPP
+#define LED_CAPTURE_HPP
+
+#include <FastLED.h>
+#include <driver/rmt_tx.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include "led_layout.hpp"
+#include "ws2812_encoder.hpp"
+
+/**
+ * LedCapture Class (host simulation)
+ *
+ * Records what an LED matrix shows: listens to the LED data leaving the
+ * firmware (the RMT symbols of the asynchronous output, or the controllers
+ * handed to FastLED.show()), decodes the LED levels of each output segment
+ * and, once the whole chain has been sent, maps the chain back to display
+ * order through the layout table. The levels are the final ones on the
+ * wire, after layout mapping, gamma, brightness and dithering.
+ *
+ * Segments of a frame are sent in output order (see LedDisplay::present),
+ * so they are appended in arrival order and no pin mapping is needed.
+ *
+ * @tparam Layout PanelLayout of the display
+ */
+template <typename Layout>
+class LedCapture {
+public:
+    // Bytes per frame (R, G, B per display pixel)
+    static constexpr size_t FRAME_BYTES = Layout::LED_COUNT * 3;
+
+    struct Frame {
+        uint64_t timeUs;          // Virtual time the frame was sent
+        uint8_t rgb[FRAME_BYTES]; // LED levels in display order (row by row)
+    };
+
+    /**
+     * Start capturing from the stand-in LED outputs
+     */
+    void attach() {
+        hosthal::rmtListener = [this](uint8_t, const uint32_t* symbols, size_t count) {
+            addSymbols(symbols, count);
+        };
+        hosthal::showListener = [this](uint8_t, const CRGB* leds, int count) {
+            addLevels(reinterpret_cast<const uint8_t*>(leds), (size_t)count);
+        };
+    }
+
+    /**
+     * Stop capturing
+     */
+    void detach() {
+        hosthal::rmtListener = nullptr;
+        hosthal::showListener = nullptr;
+    }
+
+    const std::vector<Frame>& getFrames() const {
+        return frames;
+    }
+
+    void clear() {
+        frames.clear();
+        received = 0;
+    }
+
+    /**
+     * 64-bit FNV-1a hash of a frame's levels
+     */
+    static uint64_t hash(const Frame& frame) {
+        uint64_t value = 0xCBF29CE484222325ull;
+        for (uint8_t byte : frame.rgb) {
+            value = (value ^ byte) * 0x100000001B3ull;
+        }
+        return value;
+    }
+
+private:
+    std::vector<Frame> frames;
+    // LED levels of the chain in LED order, filled segment by segment
+    uint8_t chain[FRAME_BYTES] = {};
+    size_t received = 0;
+
+    /**
+     * Decode a segment of WS2812B symbols (GRB, most significant bit first,
+     * followed by a reset symbol)
+     */
+    void addSymbols(const uint32_t* symbols, size_t count) {
+        size_t leds = count / Ws2812Encoder::SYMBOLS_PER_LED;
+        std::vector<uint8_t> levels(leds * 3);
+        for (size_t led = 0; led < leds; led++) {
+            uint8_t grb[3] = {};
+            for (uint8_t c = 0; c < 3; c++) {
+                for (uint8_t bit = 0; bit < 8; bit++) {
+                    uint32_t high = symbols[(led * 3 + c) * 8 + bit] & 0x7FFF;
+                    grb[c] = (uint8_t)((grb[c] << 1) | (high * 2 > Ws2812Encoder::T0H + Ws2812Encoder::T1H));
+                }
+            }
+            levels[led * 3] = grb[1];
+            levels[led * 3 + 1] = grb[0];
+            levels[led * 3 + 2] = grb[2];
+        }
+        addLevels(levels.data(), leds);
+    }
+
+    /**
+     * Append the levels of one segment (R, G, B per LED)
+     */
+    void addLevels(const uint8_t* rgb, size_t leds) {
+        size_t bytes = leds * 3;
+        if (received + bytes > FRAME_BYTES) {
+            received = 0;
+        }
+        memcpy(chain + received, rgb, bytes);
+        received += bytes;
+        if (received < FRAME_BYTES) {
+            return;
+        }
+        received = 0;
+        // Back to display order
+        frames.emplace_back();
+        Frame& frame = frames.back();
+        frame.timeUs = hosthal::clockMicros;
+        const uint16_t* ledIndex = layoutTable<Layout>.data();
+        for (size_t pixel = 0; pixel < Layout::LED_COUNT; pixel++) {
+            memcpy(frame.rgb + pixel * 3, chain + ledIndex[pixel] * 3, 3);
+        }
+    }
+};
+
+#endif // LED_CAPTURE_HPP
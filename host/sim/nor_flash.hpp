@@ -0,0 +1,117 @@
+#ifndef NOR_FLASH_HPP
+#define NOR_FLASH_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+/**
+ * NorFlash Class (host simulation)
+ *
+ * RAM stand-in for a flash partition with NOR semantics: erasing sets whole
+ * 4 KB sectors to 0xFF and programming can only clear bits, so writing to a
+ * location that has not been erased corrupts the data just like on the
+ * chip (and is counted). Every operation adds its typical duration to a
+ * busy-time counter, used to model the flash write task.
+ *
+ * Offers the Flash interface of AssetSlots and AssetWriter.
+ */
+class NorFlash {
+public:
+    static constexpr size_t SECTOR_SIZE = 4096;
+
+    struct Timing {
+        uint32_t eraseSectorUs; // Sector erase
+        uint32_t programPageUs; // Program one 256-byte page
+        uint32_t readKbUs;      // Read 1 KB through the SPI interface
+    };
+
+    // Typical values of the 4 MB SPI flash on the XIAO ESP32-C6 (tSE, tPP)
+    static constexpr Timing TYPICAL = {45000, 700, 15};
+
+    explicit NorFlash(size_t size, Timing timing = TYPICAL) : data(size, 0xFF), timing(timing) {}
+
+    size_t size() const {
+        return data.size();
+    }
+
+    bool read(size_t offset, void* out, size_t len) {
+        if (offset + len > data.size()) {
+            return false;
+        }
+        memcpy(out, data.data() + offset, len);
+        busyMicros += (len * timing.readKbUs + 1023) / 1024;
+        return true;
+    }
+
+    bool write(size_t offset, const void* in, size_t len) {
+        if (offset + len > data.size()) {
+            return false;
+        }
+        auto* bytes = static_cast<const uint8_t*>(in);
+        for (size_t i = 0; i < len; i++) {
+            if (bytes[i] & ~data[offset + i]) {
+                unerasedWrites++;
+            }
+            data[offset + i] &= bytes[i];
+        }
+        // Programming works in 256-byte pages
+        size_t pages = (offset + len + 255) / 256 - offset / 256;
+        busyMicros += pages * timing.programPageUs;
+        return true;
+    }
+
+    bool erase(size_t offset, size_t len) {
+        if (offset % SECTOR_SIZE || len % SECTOR_SIZE || offset + len > data.size()) {
+            return false;
+        }
+        memset(data.data() + offset, 0xFF, len);
+        busyMicros += len / SECTOR_SIZE * timing.eraseSectorUs;
+        return true;
+    }
+
+    /**
+     * Map a range (counted as read once, as when a mapped pack is validated)
+     */
+    const void* map(size_t offset, size_t len) {
+        if (offset + len > data.size()) {
+            return nullptr;
+        }
+        busyMicros += (len * timing.readKbUs + 1023) / 1024;
+        return data.data() + offset;
+    }
+
+    void unmap() {}
+
+    /**
+     * Get the busy time accumulated since the last call
+     */
+    uint64_t takeBusyMicros() {
+        uint64_t busy = busyMicros;
+        busyMicros = 0;
+        return busy;
+    }
+
+    /**
+     * Flash contents (as mapped by esp_partition_mmap)
+     */
+    const uint8_t* bytes() const {
+        return data.data();
+    }
+
+    /**
+     * Bytes programmed over data that had not been erased
+     */
+    uint32_t getUnerasedWrites() const {
+        return unerasedWrites;
+    }
+
+private:
+    std::vector<uint8_t> data;
+    Timing timing;
+    uint64_t busyMicros = 0;
+    uint32_t unerasedWrites = 0;
+};
+
+#endif // NOR_FLASH_HPP
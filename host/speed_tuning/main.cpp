@@ -0,0 +1,116 @@
+/**
+ * Speed Controller Tuning Tool (host)
+ *
+ * Runs the firmware's SpeedController against two simulated DC motor
+ * tracks much faster than real time and prints the step response, so PI
+ * gains can be tuned on Linux without a robot.
+ *
+ * Usage:
+ *   speed_tuning [--kp N] [--ki N] [--volts V] [--target COUNTS] [--seconds S]
+ *
+ * Gains are in the controller's Q8 fixed point (256 = 1.0).
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "speed_controller.hpp"
+#include "../sim/dc_motor.hpp"
+
+/**
+ * Step response metrics of one track
+ */
+struct Response {
+    float riseTime = -1.0f;   // Time to reach 90% of target (s)
+    float peak = 0.0f;        // Highest counts per period seen
+    float steadySum = 0.0f;   // Sum of counts over the last second
+    int steadySamples = 0;
+};
+
+static void record(Response& response, uint16_t counts, uint16_t target, float t, float duration) {
+    if (response.riseTime < 0.0f && counts >= target * 0.9f) {
+        response.riseTime = t;
+    }
+    if (counts > response.peak) {
+        response.peak = counts;
+    }
+    if (t >= duration - 1.0f) {
+        response.steadySum += counts;
+        response.steadySamples++;
+    }
+}
+
+static void print(const char* name, const Response& response, uint16_t target, uint8_t duty) {
+    float steady = response.steadySamples ? response.steadySum / response.steadySamples : 0.0f;
+    printf("%s: rise %.3f s, overshoot %.1f %%, steady %.2f counts (error %.1f %%), duty %u\n",
+           name, response.riseTime,
+           (response.peak - target) * 100.0f / target,
+           steady, (steady - target) * 100.0f / target, duty);
+}
+
+int main(int argc, char** argv) {
+    SpeedController::Gains gains = SpeedController::DEFAULT_GAINS;
+    float volts = 4.8f;
+    uint16_t target = 12;
+    float duration = 5.0f;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "--kp")) {
+            gains.kp = (int16_t)atoi(argv[i + 1]);
+        } else if (!strcmp(argv[i], "--ki")) {
+            gains.ki = (int16_t)atoi(argv[i + 1]);
+        } else if (!strcmp(argv[i], "--volts")) {
+            volts = (float)atof(argv[i + 1]);
+        } else if (!strcmp(argv[i], "--target")) {
+            target = (uint16_t)atoi(argv[i + 1]);
+        } else if (!strcmp(argv[i], "--seconds")) {
+            duration = (float)atof(argv[i + 1]);
+        } else {
+            fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    // Physics step and control period match the firmware (1 kHz / 100 Hz)
+    constexpr float PHYSICS_DT = 0.001f;
+    constexpr int STEPS_PER_CONTROL = 10;
+
+    // Motor B is the weaker motor on the TP101, which is why the open-loop
+    // SPEED_FORWARD table needs {130, 255}
+    DcMotor::Params weak = DcMotor::TP101;
+    weak.coulomb *= 2.5f;
+    weak.viscous *= 2.0f;
+    DcMotor motorA(DcMotor::TP101);
+    DcMotor motorB(weak);
+
+    SpeedController controller(gains);
+    controller.setTarget(target, target, {130, 255});
+    SpeedController::Duty duty = {130, 255};
+
+    Response responseA;
+    Response responseB;
+    auto start = std::chrono::steady_clock::now();
+    int controlSteps = (int)(duration / (PHYSICS_DT * STEPS_PER_CONTROL));
+
+    for (int n = 0; n < controlSteps; n++) {
+        for (int i = 0; i < STEPS_PER_CONTROL; i++) {
+            motorA.step(volts, duty.motorA, true, PHYSICS_DT);
+            motorB.step(volts, duty.motorB, true, PHYSICS_DT);
+        }
+        uint16_t countsA = motorA.takePulses();
+        uint16_t countsB = motorB.takePulses();
+        float t = (n + 1) * PHYSICS_DT * STEPS_PER_CONTROL;
+        record(responseA, countsA, target, t, duration);
+        record(responseB, countsB, target, t, duration);
+        duty = controller.update(countsA, countsB);
+    }
+
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    printf("kp %d ki %d, %.2f V, target %u counts/period\n", gains.kp, gains.ki, volts, target);
+    print("motor A", responseA, target, duty.motorA);
+    print("motor B", responseB, target, duty.motorB);
+    printf("simulated %.1f s in %.3f ms (%.0fx real time)\n",
+           duration, elapsed * 1000.0, elapsed > 0.0 ? duration / elapsed : 0.0);
+    return 0;
+}
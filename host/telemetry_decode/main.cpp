@@ -0,0 +1,323 @@
+/**
+ * Telemetry Decoder (host)
+ *
+ * Turns TELEMETRY packets received from a robot (see protocol.h) into CSV,
+ * one row per sample, and reports packets lost on the way (gaps in the
+ * packet sequence).
+ *
+ * The input is a capture of received ESP-NOW payloads, each stored as a
+ * 1-byte length followed by the payload, as a controller logs them.
+ * Packets of other types in the capture are skipped.
+ *
+ * Without --input, a self-test runs Telemetry on the virtual clock at
+ * several rates while commands, renders and received packets go on, and
+ * checks the decoded samples: packet size and rate (batching), sample
+ * spacing, no gaps, the commands and the PWM duties written for them
+ * under a duty limit, the render counts, that sending resumes once a full
+ * ESP-NOW peer table has room for the controller, and that damaged
+ * captures are reported. --capture writes the 50 Hz run as a capture file.
+ *
+ * Usage:
+ *   telemetry_decode --input capture.bin [--output telemetry.csv]
+ *   telemetry_decode [--capture capture.bin]
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <Arduino.h>
+#include <esp_now.h>
+#include <esp_system.h>
+#include <esp_timer.h>
+#include "constants.h"
+#include "motor_controller.hpp"
+#include "protocol.h"
+#include "telemetry.hpp"
+#include "uplink.hpp"
+#include "../sim/host_check.hpp"
+
+using Frame = std::vector<uint8_t>;
+
+struct Decoded {
+    std::vector<TelemetrySample> samples;
+    uint32_t packets = 0;
+    uint32_t lostPackets = 0;
+    uint32_t otherPackets = 0;
+    uint32_t malformedPackets = 0;
+};
+
+/**
+ * Decode the TELEMETRY packets of a capture
+ */
+static Decoded decode(const std::vector<Frame>& frames) {
+    Decoded result;
+    int lastSequence = -1;
+    for (const Frame& frame : frames) {
+        if (frame.empty() || frame[0] != (uint8_t)PacketType::TELEMETRY) {
+            result.otherPackets++;
+            continue;
+        }
+        TelemetryBatch header;
+        if (frame.size() < sizeof(header)) {
+            result.malformedPackets++;
+            continue;
+        }
+        memcpy(&header, frame.data(), sizeof(header));
+        if (header.sampleSize == 0 || frame.size() != sizeof(header) + (size_t)header.count * header.sampleSize) {
+            result.malformedPackets++;
+            continue;
+        }
+        result.packets++;
+        if (lastSequence >= 0) {
+            result.lostPackets += (uint8_t)(header.sequence - lastSequence - 1);
+        }
+        lastSequence = header.sequence;
+        for (uint8_t i = 0; i < header.count; i++) {
+            // Samples from newer firmware may be longer; older ones shorter
+            TelemetrySample sample = {};
+            size_t size = header.sampleSize < sizeof(sample) ? header.sampleSize : sizeof(sample);
+            memcpy(&sample, frame.data() + sizeof(header) + i * header.sampleSize, size);
+            result.samples.push_back(sample);
+        }
+    }
+    return result;
+}
+
+static void writeCsv(FILE* out, const Decoded& decoded) {
+    fprintf(out, "time_ms,direction,duty_a,duty_b,frames,frame_avg_us,frame_max_us,free_heap,"
+                 "rx_packets,rx_rejected,tx_failed,rssi\n");
+    for (const TelemetrySample& s : decoded.samples) {
+        fprintf(out, "%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%d\n", s.timeMs, s.direction, s.dutyA, s.dutyB, s.frames,
+                s.frameAvgUs, s.frameMaxUs, s.freeHeap, s.rxPackets, s.rxRejected, s.txFailed, s.rssi);
+    }
+}
+
+static bool readCapture(const char* path, std::vector<Frame>& frames) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return false;
+    }
+    int length;
+    while ((length = fgetc(file)) != EOF) {
+        Frame frame(length);
+        if (fread(frame.data(), 1, length, file) != (size_t)length) {
+            break;
+        }
+        frames.push_back(frame);
+    }
+    fclose(file);
+    return true;
+}
+
+static bool writeCapture(const char* path, const std::vector<Frame>& frames) {
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+    for (const Frame& frame : frames) {
+        fputc((int)frame.size(), file);
+        fwrite(frame.data(), 1, frame.size(), file);
+    }
+    fclose(file);
+    return true;
+}
+
+/**
+ * Run Telemetry for 10 s at a rate and check the decoded samples
+ */
+static void selfTest(uint16_t rateHz, std::vector<Frame>& frames) {
+    static constexpr uint64_t DURATION_US = 10000000;
+    static constexpr uint64_t COMMAND_INTERVAL_US = 700000;
+    static constexpr uint64_t RENDER_INTERVAL_US = 16000;
+    static const Direction commands[] = {Direction::FORWARD, Direction::LEFT, Direction::BACKWARD,
+                                         Direction::RIGHT, Direction::STOP};
+    static uint8_t controller[ESP_NOW_ETH_ALEN] = {0x24, 0x6F, 0x28, 0x01, 0x02, 0x03};
+
+    hosthal::clockMicros = 0;
+    hosthal::timers.clear();
+    hosthal::peers.clear();
+    frames.clear();
+    hosthal::sendListener = [&](const uint8_t*, const uint8_t* data, size_t len) {
+        frames.emplace_back(data, data + len);
+    };
+    MotorController motors;
+    motors.begin();
+    // Power governor limit: the duties on the pins differ from the table
+    motors.setDutyLimit(200);
+    Uplink uplink;
+    uplink.setController(controller);
+    Telemetry telemetry(motors, uplink);
+    telemetry.begin(rateHz);
+
+    // Commands with when they were applied and the PWM duties written for
+    // them, renders and received packets
+    struct Applied {
+        uint32_t timeMs;
+        Direction direction;
+        uint8_t dutyA;
+        uint8_t dutyB;
+    };
+    std::vector<Applied> applied = {{0, Direction::STOP, 0, 0}};
+    uint32_t renders = 0;
+    uint32_t received = 0;
+    for (uint64_t t = 1000; t <= DURATION_US; t += 1000) {
+        hosthal::clockMicros = t;
+        if (t % COMMAND_INTERVAL_US == 0) {
+            Direction direction = commands[(t / COMMAND_INTERVAL_US) % 5];
+            telemetry.recordPacket((int8_t)(-40 - (int)(t / COMMAND_INTERVAL_US)));
+            received++;
+            motors.executeCommand(direction);
+            bool stopped = direction == Direction::STOP;
+            applied.push_back({(uint32_t)(t / 1000), direction, (uint8_t)(stopped ? 0 : hosthal::pinDuty[D0]),
+                               (uint8_t)(stopped ? 0 : hosthal::pinDuty[D5])});
+        }
+        if (t % RENDER_INTERVAL_US == 0) {
+            telemetry.recordFrame(3000 + (uint32_t)(t / RENDER_INTERVAL_US % 7) * 100);
+            renders++;
+        }
+        hosthal::runTimers();
+    }
+
+    Decoded decoded = decode(frames);
+    size_t largest = 0;
+    for (const Frame& frame : frames) {
+        largest = frame.size() > largest ? frame.size() : largest;
+    }
+    uint32_t expectedSamples = (uint32_t)(DURATION_US / (1000000 / rateHz));
+    uint8_t perPacket = telemetry.getSamplesPerPacket();
+    bool spacing = true;
+    bool directions = true;
+    uint32_t frameSum = 0;
+    for (size_t i = 0; i < decoded.samples.size(); i++) {
+        const TelemetrySample& sample = decoded.samples[i];
+        if (i > 0 && sample.timeMs - decoded.samples[i - 1].timeMs != 1000 / rateHz) {
+            spacing = false;
+        }
+        const Applied* expected = &applied[0];
+        for (const Applied& command : applied) {
+            if (command.timeMs <= sample.timeMs) {
+                expected = &command;
+            }
+        }
+        directions = directions && sample.direction == (uint8_t)expected->direction &&
+                     sample.dutyA == expected->dutyA && sample.dutyB == expected->dutyB;
+        frameSum += sample.frames;
+    }
+    const TelemetrySample* last = decoded.samples.empty() ? nullptr : &decoded.samples.back();
+    // Renders after the last sample sent are not reported yet
+    uint32_t unreported = last ? (uint32_t)((DURATION_US / 1000 - last->timeMs) * 1000 / RENDER_INTERVAL_US) : 0;
+
+    printf("%3u Hz: %3u packets of %2u samples (%zu bytes max), %4zu samples, %u lost\n", rateHz, decoded.packets,
+           perPacket, largest, decoded.samples.size(), decoded.lostPackets);
+    char what[160];
+    snprintf(what, sizeof(what), "%u Hz: at most 10 packets/s of at most %u bytes", rateHz, ESPNOW_MAX_PAYLOAD);
+    check(decoded.packets <= DURATION_US / 100000 && largest <= ESPNOW_MAX_PAYLOAD, what);
+    snprintf(what, sizeof(what), "%u Hz: every sample decoded, %u ms apart, no packets lost", rateHz,
+             1000 / rateHz);
+    check(decoded.samples.size() + perPacket > expectedSamples && decoded.samples.size() <= expectedSamples &&
+              spacing && decoded.lostPackets == 0 && decoded.malformedPackets == 0,
+          what);
+    snprintf(what, sizeof(what), "%u Hz: directions, PWM duties, render and packet counts match", rateHz);
+    check(directions && last && frameSum + unreported >= renders - 1 && frameSum + unreported <= renders + 1 &&
+              last->rxPackets == received && last->rssi == -40 - (int)received,
+          what);
+}
+
+/**
+ * Start with the ESP-NOW peer table full: nothing can be sent to the
+ * controller until a peer is removed, then telemetry must resume
+ */
+static void peerTableTest() {
+    static uint8_t controller[ESP_NOW_ETH_ALEN] = {0x24, 0x6F, 0x28, 0x01, 0x02, 0x03};
+
+    hosthal::clockMicros = 0;
+    hosthal::timers.clear();
+    hosthal::peers.clear();
+    for (uint8_t n = 0; n < ESP_NOW_MAX_TOTAL_PEER_NUM; n++) {
+        esp_now_peer_info_t peer = {};
+        uint8_t mac[ESP_NOW_ETH_ALEN] = {0x24, 0x6F, 0x28, 0x03, 0x00, n};
+        memcpy(peer.peer_addr, mac, ESP_NOW_ETH_ALEN);
+        esp_now_add_peer(&peer);
+    }
+    uint32_t sent = 0;
+    hosthal::sendListener = [&](const uint8_t*, const uint8_t*, size_t) { sent++; };
+    MotorController motors;
+    motors.begin();
+    Uplink uplink;
+    uplink.setController(controller);
+    Telemetry telemetry(motors, uplink);
+    telemetry.begin(10);
+
+    auto runFor = [](uint64_t us) {
+        for (uint64_t end = hosthal::clockMicros + us; hosthal::clockMicros < end;) {
+            hosthal::clockMicros += 1000;
+            hosthal::runTimers();
+        }
+    };
+    runFor(1000000);
+    uint32_t whileFull = sent;
+    esp_now_del_peer(hosthal::peers.front().peer_addr);
+    runFor(1000000);
+    check(whileFull == 0 && sent >= 9, "telemetry resumes once the controller fits in the peer table");
+    hosthal::timers.clear();
+}
+
+int main(int argc, char** argv) {
+    const char* inputPath = nullptr;
+    const char* outputPath = nullptr;
+    const char* capturePath = nullptr;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "--input")) {
+            inputPath = argv[i + 1];
+        } else if (!strcmp(argv[i], "--output")) {
+            outputPath = argv[i + 1];
+        } else if (!strcmp(argv[i], "--capture")) {
+            capturePath = argv[i + 1];
+        }
+    }
+
+    if (inputPath) {
+        std::vector<Frame> frames;
+        if (!readCapture(inputPath, frames)) {
+            fprintf(stderr, "cannot read %s\n", inputPath);
+            return 1;
+        }
+        Decoded decoded = decode(frames);
+        FILE* out = outputPath ? fopen(outputPath, "w") : stdout;
+        if (!out) {
+            fprintf(stderr, "cannot write %s\n", outputPath);
+            return 1;
+        }
+        writeCsv(out, decoded);
+        if (out != stdout) {
+            fclose(out);
+        }
+        fprintf(stderr, "%u telemetry packets, %zu samples, %u packets lost, %u other, %u malformed\n",
+                decoded.packets, decoded.samples.size(), decoded.lostPackets, decoded.otherPackets,
+                decoded.malformedPackets);
+        return 0;
+    }
+
+    hosthal::serialEnabled = false;
+    std::vector<Frame> frames;
+    for (uint16_t rateHz : {1, 10, 50, 100}) {
+        selfTest(rateHz, frames);
+        if (rateHz == 50 && capturePath && !writeCapture(capturePath, frames)) {
+            fprintf(stderr, "cannot write %s\n", capturePath);
+            return 1;
+        }
+    }
+
+    peerTableTest();
+
+    // A lost packet, another robot's pose report and a truncated packet
+    std::vector<Frame> damaged = frames;
+    damaged.erase(damaged.begin() + 10);
+    damaged.insert(damaged.begin() + 20, Frame(sizeof(PoseReport), (uint8_t)PacketType::POSE_REPORT));
+    damaged[30].pop_back();
+    Decoded decoded = decode(damaged);
+    check(decoded.lostPackets == 2 && decoded.otherPackets == 1 && decoded.malformedPackets == 1,
+          "lost, foreign and truncated packets detected");
+    return checkResult();
+}
@@ -0,0 +1,135 @@
+/**
+ * Text Marquee Benchmark (host)
+ *
+ * Scrolls a text through the firmware's TextMarquee for two full cycles and
+ * checks after every step that the incrementally composed image matches a
+ * full redraw of the visible part of the string. Then times one scroll
+ * step (composing the new column), rendering the image to LED order, and
+ * the full redraw it replaces.
+ *
+ * Usage:
+ *   text_bench [--rounds N] [--text "ROBOT 07"]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "led_layout.hpp"
+#include "text_marquee.hpp"
+#include "../sim/host_check.hpp"
+
+static constexpr uint8_t WIDTH = 16;
+static constexpr uint8_t HEIGHT = 16;
+static constexpr uint8_t SCALE = 2;
+using Marquee = TextMarquee<WIDTH, HEIGHT, SCALE>;
+
+/**
+ * Full redraw: display column at a scroll position, found by walking the
+ * string from its start
+ *
+ * @param position Columns emitted since the start (negative = blank lead-in)
+ */
+static uint16_t composeColumn(const char* text, size_t length, long position) {
+    if (position < 0) {
+        return 0;
+    }
+    long glyphPosition = position / SCALE;
+    long cycle = Marquee::END_GAP;
+    for (size_t i = 0; i < length; i++) {
+        cycle += findGlyph(text[i]).width + Marquee::CHARACTER_GAP;
+    }
+    glyphPosition %= cycle;
+    for (size_t i = 0; i < length; i++) {
+        Glyph glyph = findGlyph(text[i]);
+        if (glyphPosition < glyph.width + Marquee::CHARACTER_GAP) {
+            uint8_t bits = glyphPosition < glyph.width ? glyph.columns[glyphPosition] : 0;
+            uint16_t column = 0;
+            for (uint8_t bit = 0; bit < GLYPH_HEIGHT; bit++) {
+                if (bits & (1u << bit)) {
+                    column |= (uint16_t)(((1u << SCALE) - 1) << (bit * SCALE));
+                }
+            }
+            return (uint16_t)(column << ((HEIGHT - GLYPH_HEIGHT * SCALE) / 2));
+        }
+        glyphPosition -= glyph.width + Marquee::CHARACTER_GAP;
+    }
+    return 0;
+}
+
+template <typename Body>
+static double timeSteps(int rounds, Body body) {
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        body(round);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / rounds;
+}
+
+int main(int argc, char** argv) {
+    int rounds = 200000;
+    const char* text = "ROBOT 07 BAT 87% E3";
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "--rounds")) {
+            rounds = atoi(argv[i + 1]);
+        } else if (!strcmp(argv[i], "--text")) {
+            text = argv[i + 1];
+        }
+    }
+    size_t length = strlen(text) < TEXT_MAX_LENGTH ? strlen(text) : TEXT_MAX_LENGTH;
+
+    // Columns per cycle of the text
+    long cycle = Marquee::END_GAP;
+    for (size_t i = 0; i < length; i++) {
+        cycle += findGlyph(text[i]).width + Marquee::CHARACTER_GAP;
+    }
+    cycle *= SCALE;
+
+    Marquee marquee;
+    marquee.setText(text, length, 255, 160, 0, 0, 0);
+    bool same = true;
+    for (long step = 1; step <= 2 * cycle && same; step++) {
+        marquee.step();
+        for (uint8_t x = 0; x < WIDTH && same; x++) {
+            same = marquee.getColumn(x) == composeColumn(text, length, step - WIDTH + x);
+        }
+        if (!same) {
+            printf("step %ld differs from a full redraw\n", step);
+        }
+    }
+    check(same, "incremental scrolling matches a full redraw at every step");
+
+    // Time-based scrolling: 12 columns due after 500 ms at the default speed
+    marquee.restart(0);
+    bool moved = marquee.update(500);
+    check(moved && marquee.getColumn(WIDTH - 1) == composeColumn(text, length, 11),
+          "update() scrolls by the columns due since the last step");
+
+    const uint16_t* ledIndex = layoutTable<RobotPanelLayout>.data();
+    uint8_t rgb[WIDTH * HEIGHT * 3];
+    volatile uint16_t sink = 0;
+    double stepNs = timeSteps(rounds, [&](int) {
+        marquee.step();
+        sink = sink + marquee.getColumn(WIDTH - 1);
+    });
+    double renderNs = timeSteps(rounds, [&](int round) {
+        marquee.render(ledIndex, rgb);
+        sink = sink + rgb[round % sizeof(rgb)];
+    });
+    uint16_t columns[WIDTH];
+    double redrawNs = timeSteps(rounds, [&](int round) {
+        for (uint8_t x = 0; x < WIDTH; x++) {
+            columns[x] = composeColumn(text, length, round + x);
+        }
+        sink = sink + columns[round % WIDTH];
+    });
+
+    printf("text: \"%.*s\" (%ld columns per cycle)\n", (int)length, text, cycle);
+    printf("atlas: %zu bytes (%zu column bytes, %u glyphs)\n", sizeof(glyphColumns) + sizeof(glyphOffsets),
+           sizeof(glyphColumns), GLYPH_COUNT);
+    printf("scroll step: %8.1f ns compose new column\n", stepNs);
+    printf("             %8.1f ns render to LED order\n", renderNs);
+    printf("full redraw: %8.1f ns compose all %u columns\n", redrawNs, WIDTH);
+    return checkResult();
+}
@@ -0,0 +1,436 @@
+/**
+ * Command Trace Replay (host)
+ *
+ * Replays a command trace recorded by TraceRecorder (see trace_format.h)
+ * through the firmware itself (src/main.cpp, built against the stand-in
+ * HALs in host/hal) on the virtual clock, as fast as the host runs it.
+ *
+ * The records of the last firmware start (from the last BOOT record) are
+ * replayed in order: each PACKET is delivered through the registered
+ * receive callback at its recorded time, with the firmware's loop() run in
+ * between, and every MOTOR record is checked against the motor command the
+ * firmware applied for that packet. Packets cut short in the trace (asset
+ * chunks) are skipped. FRAMES records only summarize the render timing on
+ * the robot, once per second, and are reported but not replayed.
+ *
+ * With --trace, the trace is read from a dump of the partition:
+ *   esptool.py read_flash 0x2D0000 0x10000 trace.bin
+ *
+ * Without it, a self-test writes a synthetic trace with TraceLog to a
+ * simulated NOR flash (several sessions, a power cut losing unflushed
+ * records, and several wraps of the log), checks that the flash was never
+ * programmed without an erase and that the newest records read back in
+ * order, then replays it.
+ *
+ * Usage:
+ *   trace_replay [--trace trace.bin] [--verbose]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <esp_now.h>
+#include <esp_timer.h>
+#include "constants.h"
+#include "motor_controller.hpp"
+#include "protocol.h"
+#include "trace_format.h"
+#include "trace_log.hpp"
+#include "../sim/nor_flash.hpp"
+#include "../sim/host_check.hpp"
+
+// Firmware (src/main.cpp)
+void setup();
+void loop();
+extern MotorController motorController;
+
+// Size of the trace partition (partitions.csv)
+static constexpr size_t TRACE_PARTITION_SIZE = 0x10000;
+// Render interval of the firmware's loop()
+static constexpr uint32_t RENDER_INTERVAL_MS = 16;
+
+/**
+ * One record as read back (payload copied)
+ */
+struct Entry {
+    TraceRecordType type;
+    uint32_t timeMs;
+    std::vector<uint8_t> payload;
+
+    bool operator==(const Entry& other) const {
+        return type == other.type && timeMs == other.timeMs && payload == other.payload;
+    }
+};
+
+static const char* typeName(TraceRecordType type) {
+    switch (type) {
+    case TraceRecordType::BOOT:
+        return "BOOT";
+    case TraceRecordType::PACKET:
+        return "PACKET";
+    case TraceRecordType::MOTOR:
+        return "MOTOR";
+    case TraceRecordType::FRAMES:
+        return "FRAMES";
+    default:
+        return "?";
+    }
+}
+
+static std::vector<Entry> readTrace(const uint8_t* image, size_t size, size_t& pages) {
+    std::vector<Entry> entries;
+    TraceReader reader(image, size);
+    pages = reader.forEach([&](const TraceRecord& record, const uint8_t* payload) {
+        entries.push_back({record.type, record.timeMs, std::vector<uint8_t>(payload, payload + record.length)});
+    });
+    return entries;
+}
+
+/**
+ * Synthetic Trace Session
+ *
+ * Writes what TraceRecorder would record for a stream of received packets:
+ * PACKET records, the MOTOR record of every movement command (from a local
+ * MotorController, as the firmware does), a FRAMES record every second and
+ * a flush every 2 seconds. Keeps the list of records that reached flash.
+ */
+class SyntheticSession {
+public:
+    SyntheticSession(NorFlash& flash, std::vector<Entry>& persisted) : log(flash), persisted(persisted) {}
+
+    bool begin() {
+        if (!log.begin()) {
+            return false;
+        }
+        pendingFrom = persisted.size();
+        add(TraceRecordType::BOOT, nullptr, 0);
+        return true;
+    }
+
+    /**
+     * Receive packets at random intervals for a while
+     */
+    void run(uint32_t durationMs) {
+        uint32_t end = timeMs + durationMs;
+        while (timeMs < end) {
+            timeMs += 40 + rand() % 600;
+            while (timeMs - framesMs >= FRAMES_INTERVAL_MS) {
+                framesMs += FRAMES_INTERVAL_MS;
+                TraceFrames frames = {62, (uint16_t)(900 + rand() % 300), (uint16_t)(1500 + rand() % 2000), 0};
+                add(TraceRecordType::FRAMES, &frames, sizeof(frames), framesMs);
+            }
+            if (timeMs - flushMs >= FLUSH_INTERVAL_MS) {
+                flushMs = timeMs;
+                log.flush();
+                pendingFrom = persisted.size();
+            }
+            receive(randomPacket());
+        }
+    }
+
+    /**
+     * Flush everything (clean end of the session)
+     */
+    void finish() {
+        log.flush();
+        pendingFrom = persisted.size();
+    }
+
+    /**
+     * Power cut: records not yet programmed are lost
+     */
+    void powerCut() {
+        persisted.resize(pendingFrom);
+    }
+
+    uint32_t getPackets() const {
+        return packets;
+    }
+
+private:
+    static constexpr uint32_t FRAMES_INTERVAL_MS = 1000;
+    static constexpr uint32_t FLUSH_INTERVAL_MS = 2000;
+
+    TraceLog<NorFlash> log;
+    std::vector<Entry>& persisted;
+    MotorController motors;
+    uint32_t timeMs = 250;
+    uint32_t framesMs = 250;
+    uint32_t flushMs = 250;
+    uint32_t packets = 0;
+    // First record not yet programmed
+    size_t pendingFrom = 0;
+
+    void add(TraceRecordType type, const void* payload, uint8_t length, uint32_t atMs = UINT32_MAX) {
+        uint32_t sequence = log.getSequence();
+        atMs = atMs == UINT32_MAX ? timeMs : atMs;
+        log.add(type, atMs, payload, length);
+        if (log.getSequence() != sequence) {
+            // The previous page was programmed when this record opened a new one
+            pendingFrom = persisted.size();
+        }
+        const uint8_t* bytes = static_cast<const uint8_t*>(payload);
+        persisted.push_back({type, atMs, std::vector<uint8_t>(bytes, bytes + length)});
+    }
+
+    std::vector<uint8_t> randomPacket() {
+        int kind = rand() % 100;
+        if (kind < 80) {
+            // Movement command (occasionally an unknown direction)
+            return {(uint8_t)(kind < 78 ? rand() % 5 : 9)};
+        }
+        if (kind < 90) {
+            const char* texts[] = {"HELLO", "ROBOT 07", "GO!"};
+            const char* text = texts[rand() % 3];
+            std::vector<uint8_t> packet = {(uint8_t)PacketType::TEXT_SET, 255, 160, 0, 0};
+            for (const char* c = text; *c; c++) {
+                packet.push_back((uint8_t)*c);
+            }
+            return packet;
+        }
+        if (kind < 95) {
+            // Asset chunk: longer than the trace keeps
+            std::vector<uint8_t> packet(200);
+            for (uint8_t& byte : packet) {
+                byte = (uint8_t)rand();
+            }
+            packet[0] = 0xA1;
+            return packet;
+        }
+        // Malformed
+        return {0x01, 0x02};
+    }
+
+    void receive(const std::vector<uint8_t>& packet) {
+        packets++;
+        uint8_t payload[sizeof(TracePacket) + TRACE_PACKET_BYTES];
+        uint8_t kept = (uint8_t)(packet.size() < TRACE_PACKET_BYTES ? packet.size() : TRACE_PACKET_BYTES);
+        payload[0] = (uint8_t)packet.size();
+        memcpy(payload + sizeof(TracePacket), packet.data(), kept);
+        add(TraceRecordType::PACKET, payload, sizeof(TracePacket) + kept);
+        if (packet.size() == 1) {
+            motors.executeCommand((Direction)packet[0]);
+            MotorController::MotorSpeed speed = motors.getActiveSpeed();
+            TraceMotor motor = {(uint8_t)motors.getActiveDirection(), speed.motorA, speed.motorB};
+            add(TraceRecordType::MOTOR, &motor, sizeof(motor));
+        }
+    }
+};
+
+/**
+ * Write the self-test trace and check how it reads back
+ *
+ * @return Partition image
+ */
+static std::vector<uint8_t> buildDemoTrace() {
+    NorFlash flash(TRACE_PARTITION_SIZE);
+    std::vector<Entry> persisted;
+    uint32_t packets = 0;
+
+    // Long session, a session ended by a power cut, then the session replayed
+    const uint32_t sessionsMs[] = {30 * 60 * 1000, 20 * 60 * 1000, 5 * 60 * 1000};
+    for (size_t i = 0; i < 3; i++) {
+        SyntheticSession session(flash, persisted);
+        check(session.begin(), "trace log opened");
+        session.run(sessionsMs[i]);
+        if (i == 1) {
+            session.powerCut();
+        } else {
+            session.finish();
+        }
+        packets += session.getPackets();
+    }
+
+    size_t bytes = 0;
+    for (const Entry& entry : persisted) {
+        bytes += sizeof(TraceRecord) + entry.payload.size();
+    }
+    printf("synthetic trace: %u packets, %zu records, %.1f log wraps\n", packets, persisted.size(),
+           (double)bytes / flash.size());
+    check(flash.getUnerasedWrites() == 0, "no flash writes without an erase");
+
+    size_t pages = 0;
+    std::vector<Entry> read = readTrace(flash.bytes(), flash.size(), pages);
+    printf("read back: %zu pages, %zu records\n", pages, read.size());
+    bool ordered = !read.empty() && read.size() <= persisted.size() &&
+                   std::equal(read.begin(), read.end(), persisted.end() - read.size());
+    check(ordered, "newest records read back in order");
+    // All pages but the erased sector ahead of the newest page
+    check(pages >= flash.size() / TRACE_PAGE_SIZE - TraceLog<NorFlash>::PAGES_PER_SECTOR,
+          "log keeps all but one sector");
+    return std::vector<uint8_t>(flash.bytes(), flash.bytes() + flash.size());
+}
+
+/**
+ * Run the firmware's loop() until the virtual clock reaches a time
+ */
+static void runUntil(uint64_t timeUs) {
+    while (hosthal::clockMicros + RENDER_INTERVAL_MS * 1000 <= timeUs) {
+        loop();
+        hosthal::runTimers();
+    }
+    if (hosthal::clockMicros < timeUs) {
+        hosthal::advance(timeUs - hosthal::clockMicros);
+        hosthal::runTimers();
+    }
+}
+
+/**
+ * Replay the records from the last BOOT record on
+ */
+static void replay(const std::vector<Entry>& entries, bool verbose) {
+    size_t first = 0;
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (entries[i].type == TraceRecordType::BOOT) {
+            first = i;
+        }
+    }
+    if (entries.empty()) {
+        check(false, "trace has records");
+        return;
+    }
+    if (entries[first].type != TraceRecordType::BOOT) {
+        printf("no BOOT record in the trace: replaying from the oldest record\n");
+    }
+
+    hosthal::serialEnabled = false;
+    setup();
+    // Trace times are milliseconds since that start of the firmware
+    uint64_t startUs = (uint64_t)entries[first].timeMs * 1000;
+    if (hosthal::clockMicros < startUs) {
+        hosthal::advance(startUs - hosthal::clockMicros);
+    }
+    uint64_t originUs = hosthal::clockMicros - startUs;
+
+    uint32_t packets = 0;
+    uint32_t skipped = 0;
+    uint32_t motorChecks = 0;
+    uint32_t mismatches = 0;
+    uint32_t frameRecords = 0;
+    uint32_t frames = 0;
+    uint32_t maxUpdateUs = 0;
+    uint64_t totalUpdateUs = 0;
+    uint32_t dropped = 0;
+    auto wallStart = std::chrono::steady_clock::now();
+    for (size_t i = first; i < entries.size(); i++) {
+        const Entry& entry = entries[i];
+        uint64_t atUs = originUs + (uint64_t)entry.timeMs * 1000;
+        if (atUs < hosthal::clockMicros) {
+            atUs = hosthal::clockMicros;
+        }
+        runUntil(atUs);
+        if (verbose) {
+            printf("%10.3f s  %-6s", entry.timeMs / 1000.0, typeName(entry.type));
+        }
+        if (entry.type == TraceRecordType::PACKET && !entry.payload.empty()) {
+            int length = entry.payload[0];
+            const uint8_t* packet = entry.payload.data() + sizeof(TracePacket);
+            bool complete = entry.payload.size() - sizeof(TracePacket) == (size_t)length;
+            if (complete) {
+                receive(packet, length);
+                packets++;
+            } else {
+                skipped++;
+            }
+            if (verbose) {
+                printf(" %3d bytes, type 0x%02X%s", length, length > 0 ? packet[0] : 0,
+                       complete ? "" : " (cut short, skipped)");
+            }
+        } else if (entry.type == TraceRecordType::MOTOR && entry.payload.size() == sizeof(TraceMotor)) {
+            TraceMotor recorded;
+            memcpy(&recorded, entry.payload.data(), sizeof(recorded));
+            MotorController::MotorSpeed speed = motorController.getActiveSpeed();
+            bool match = recorded.direction == (uint8_t)motorController.getActiveDirection() &&
+                         recorded.speedA == speed.motorA && recorded.speedB == speed.motorB;
+            motorChecks++;
+            if (!match) {
+                mismatches++;
+            }
+            if (verbose) {
+                printf(" direction %u, duty %u/%u%s", recorded.direction, recorded.speedA, recorded.speedB,
+                       match ? "" : " MISMATCH");
+                if (!match) {
+                    printf(" (replay: direction %u, duty %u/%u)", (unsigned)motorController.getActiveDirection(),
+                           speed.motorA, speed.motorB);
+                }
+            }
+        } else if (entry.type == TraceRecordType::FRAMES && entry.payload.size() == sizeof(TraceFrames)) {
+            TraceFrames summary;
+            memcpy(&summary, entry.payload.data(), sizeof(summary));
+            frameRecords++;
+            frames += summary.frames;
+            totalUpdateUs += (uint64_t)summary.averageUs * summary.frames;
+            maxUpdateUs = summary.maxUs > maxUpdateUs ? summary.maxUs : maxUpdateUs;
+            dropped += summary.dropped;
+            if (verbose) {
+                printf(" %u frames, update avg %u us, max %u us, %u records dropped", summary.frames,
+                       summary.averageUs, summary.maxUs, summary.dropped);
+            }
+        }
+        if (verbose) {
+            printf("\n");
+        }
+    }
+    double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    double traceSeconds = (entries.back().timeMs - entries[first].timeMs) / 1000.0;
+
+    printf("replayed %zu records, %.1f s of trace in %.3f s (%.0fx)\n", entries.size() - first, traceSeconds,
+           wallSeconds, wallSeconds > 0 ? traceSeconds / wallSeconds : 0.0);
+    printf("packets: %u delivered, %u cut short and skipped\n", packets, skipped);
+    if (frames > 0) {
+        printf("robot render loop: %u frames in %u s, update avg %llu us, max %u us\n", frames, frameRecords,
+               (unsigned long long)(totalUpdateUs / frames), maxUpdateUs);
+    }
+    if (dropped > 0) {
+        printf("%u records were dropped on the robot (trace queue full)\n", dropped);
+    }
+    char what[96];
+    snprintf(what, sizeof(what), "%u of %u motor commands match the trace", motorChecks - mismatches, motorChecks);
+    check(mismatches == 0, what);
+}
+
+int main(int argc, char** argv) {
+    const char* tracePath = nullptr;
+    bool verbose = false;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--trace") && i + 1 < argc) {
+            tracePath = argv[++i];
+        } else if (!strcmp(argv[i], "--verbose")) {
+            verbose = true;
+        }
+    }
+
+    std::vector<uint8_t> image;
+    if (tracePath) {
+        FILE* file = fopen(tracePath, "rb");
+        if (!file) {
+            printf("%s: cannot open\n", tracePath);
+            return 1;
+        }
+        uint8_t buffer[4096];
+        size_t count;
+        while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+            image.insert(image.end(), buffer, buffer + count);
+        }
+        fclose(file);
+        if (image.empty() || image.size() % TRACE_SECTOR_SIZE != 0) {
+            printf("%s: %zu bytes is not a trace partition dump\n", tracePath, image.size());
+            return 1;
+        }
+    } else {
+        // Same synthetic trace on every run
+        srand(1);
+        image = buildDemoTrace();
+    }
+
+    size_t pages = 0;
+    std::vector<Entry> entries = readTrace(image.data(), image.size(), pages);
+    if (tracePath) {
+        printf("%s: %zu pages, %zu records\n", tracePath, pages, entries.size());
+    }
+    replay(entries, verbose);
+    return checkResult();
+}
@@ -0,0 +1,217 @@
+/**
+ * WS2812B Bitstream Check (host)
+ *
+ * Encodes test frames with the firmware's Ws2812Encoder, decodes the RMT
+ * symbol stream back into pulses and checks them against the WS2812B
+ * datasheet timing, the GRB/MSB-first bit order, per-channel correction
+ * and the latch period. Frames encoded through the fused output tables
+ * (OutputLut) are checked to average to the table levels over time, and
+ * the number of distinguishable dim shades at 5% brightness is shown with
+ * and without temporal dithering. Exits with status 1 if any check fails.
+ *
+ * Usage:
+ *   ws2812_check
+ */
+
+#include <cstdio>
+#include <vector>
+#include "ws2812_encoder.hpp"
+#include "../sim/host_check.hpp"
+
+/**
+ * WS2812B timing limits (nanoseconds)
+ */
+struct PulseLimits {
+    uint32_t min;
+    uint32_t max;
+};
+
+static constexpr PulseLimits T0H = {250, 550};
+static constexpr PulseLimits T0L = {700, 1000};
+static constexpr PulseLimits T1H = {650, 950};
+static constexpr PulseLimits T1L = {300, 600};
+static constexpr PulseLimits BIT_PERIOD = {650, 1850};
+static constexpr uint32_t RESET_MIN_NS = 280000;
+static constexpr uint32_t NS_PER_TICK = 1000000000u / Ws2812Encoder::RESOLUTION_HZ;
+
+static bool within(uint32_t ns, PulseLimits limits) {
+    return ns >= limits.min && ns <= limits.max;
+}
+
+/**
+ * Decode one data symbol into a bit, validating its timing
+ *
+ * @return 0 or 1, or -1 if the symbol is not a valid WS2812B bit
+ */
+static int decodeBit(uint32_t symbol) {
+    uint32_t high = (symbol & 0x7FFF) * NS_PER_TICK;
+    uint32_t low = ((symbol >> 16) & 0x7FFF) * NS_PER_TICK;
+    bool level0 = symbol & (1u << 15);
+    bool level1 = symbol & (1u << 31);
+    if (!level0 || level1 || !within(high + low, BIT_PERIOD)) {
+        return -1;
+    }
+    if (within(high, T1H) && within(low, T1L)) {
+        return 1;
+    }
+    if (within(high, T0H) && within(low, T0L)) {
+        return 0;
+    }
+    return -1;
+}
+
+/**
+ * Encode a frame through the output tables, decode it back and compare
+ * with the table levels (no carried fractions yet)
+ */
+static bool roundTrip(const std::vector<uint8_t>& rgb, const OutputLut& lut) {
+    size_t ledCount = rgb.size() / 3;
+    std::vector<uint32_t> symbols(Ws2812Encoder::frameSymbols(ledCount));
+    std::vector<uint8_t> error(rgb.size(), 0);
+    Ws2812Encoder::encode(rgb.data(), ledCount, lut, error.data(), symbols.data());
+
+    for (size_t led = 0; led < ledCount; led++) {
+        // Wire order is G, R, B
+        const uint8_t order[3] = {1, 0, 2};
+        for (uint8_t c = 0; c < 3; c++) {
+            uint8_t channel = order[c];
+            uint8_t expected = (uint8_t)(lut.getLevel(channel, rgb[led * 3 + channel]) >> 8);
+            uint8_t value = 0;
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                int decoded = decodeBit(symbols[led * 24 + c * 8 + bit]);
+                if (decoded < 0) {
+                    return false;
+                }
+                value = (uint8_t)((value << 1) | decoded);
+            }
+            if (value != expected) {
+                return false;
+            }
+        }
+    }
+
+    uint32_t reset = symbols.back();
+    uint32_t resetNs = ((reset & 0x7FFF) + ((reset >> 16) & 0x7FFF)) * NS_PER_TICK;
+    bool resetLow = !(reset & (1u << 15)) && !(reset & (1u << 31));
+    return resetLow && resetNs >= RESET_MIN_NS;
+}
+
+/**
+ * Encode a frame through the output tables and decode the LED levels
+ *
+ * @param rgb Frame values, 3 bytes per LED
+ * @param error Carried fractions, 3 bytes per LED (updated)
+ * @param levels Receives the decoded levels, 3 bytes per LED in R, G, B order
+ * @return false if a symbol is not a valid bit
+ */
+static bool encodeLevels(const std::vector<uint8_t>& rgb, const OutputLut& lut, std::vector<uint8_t>& error,
+                         std::vector<uint8_t>& levels) {
+    size_t ledCount = rgb.size() / 3;
+    std::vector<uint32_t> symbols(Ws2812Encoder::frameSymbols(ledCount));
+    Ws2812Encoder::encode(rgb.data(), ledCount, lut, error.data(), symbols.data());
+    levels.assign(rgb.size(), 0);
+    const uint8_t order[3] = {1, 0, 2};
+    for (size_t led = 0; led < ledCount; led++) {
+        for (uint8_t c = 0; c < 3; c++) {
+            uint8_t value = 0;
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                int decoded = decodeBit(symbols[led * 24 + c * 8 + bit]);
+                if (decoded < 0) {
+                    return false;
+                }
+                value = (uint8_t)((value << 1) | decoded);
+            }
+            levels[led * 3 + order[c]] = value;
+        }
+    }
+    return true;
+}
+
+/**
+ * Check that 256 dithered frames add up to exactly the table level of
+ * every LED channel, and count the distinct shades seen over time
+ *
+ * @param ditheredShades Distinct average levels over the input ramp
+ * @param plainShades Distinct levels with the fraction dropped
+ */
+static bool checkDithering(const std::vector<uint8_t>& rgb, const OutputLut& lut, size_t& ditheredShades,
+                           size_t& plainShades) {
+    std::vector<uint8_t> error(rgb.size(), 0);
+    std::vector<uint8_t> levels;
+    std::vector<uint32_t> sums(rgb.size(), 0);
+    for (int frame = 0; frame < 256; frame++) {
+        if (!encodeLevels(rgb, lut, error, levels)) {
+            return false;
+        }
+        for (size_t i = 0; i < rgb.size(); i++) {
+            sums[i] += levels[i];
+        }
+    }
+    std::vector<bool> dithered(65536, false);
+    std::vector<bool> plain(256, false);
+    ditheredShades = 0;
+    plainShades = 0;
+    for (size_t i = 0; i < rgb.size(); i++) {
+        uint16_t level = lut.getLevel((uint8_t)(i % 3), rgb[i]);
+        if (sums[i] != level) {
+            return false;
+        }
+        ditheredShades += !dithered[level];
+        plainShades += !plain[level >> 8];
+        dithered[level] = true;
+        plain[level >> 8] = true;
+    }
+    return true;
+}
+
+int main() {
+    const uint8_t fullScale[3] = {255, 255, 255};
+    OutputLut linear(1.0f);
+    linear.setScale(255, fullScale);
+
+    check(decodeBit(Ws2812Encoder::BIT0) == 0, "BIT0 symbol within T0H/T0L limits");
+    check(decodeBit(Ws2812Encoder::BIT1) == 1, "BIT1 symbol within T1H/T1L limits");
+
+    std::vector<uint8_t> ramp(256 * 3);
+    for (size_t i = 0; i < ramp.size(); i++) {
+        ramp[i] = (uint8_t)(i * 7);
+    }
+    check(roundTrip(ramp, linear), "256-LED ramp decodes to the same GRB bytes");
+
+    std::vector<uint8_t> single = {0x12, 0x34, 0x56};
+    check(roundTrip(single, linear), "single LED, GRB order, MSB first, latch >= 280 us");
+
+    const uint8_t warm[3] = {0xFF, 0xB0, 0xF0};
+    OutputLut corrected(1.0f);
+    corrected.setScale(128, warm);
+    check(roundTrip(ramp, corrected), "per-channel correction applied while encoding");
+
+    // Fused output tables: linear at full brightness leaves values unchanged
+    std::vector<uint8_t> error(ramp.size(), 0);
+    std::vector<uint8_t> levels;
+    check(encodeLevels(ramp, linear, error, levels) && levels == ramp,
+          "output tables at gamma 1 and full brightness keep values unchanged");
+
+    // Green ramp at 5% brightness with gamma (dim arrow shades)
+    OutputLut dim(2.2f);
+    const uint8_t correction[3] = {0xFF, 0xFF, 0xF3};
+    dim.setScale(13, correction);
+    std::vector<uint8_t> greens(256 * 3, 0);
+    for (size_t i = 0; i < 256; i++) {
+        greens[i * 3 + 1] = (uint8_t)i;
+    }
+    size_t ditheredShades = 0;
+    size_t plainShades = 0;
+    check(checkDithering(greens, dim, ditheredShades, plainShades),
+          "256 dithered frames add up to the table level of every LED");
+    printf("5%% brightness, gamma 2.2: %zu distinct green shades with dithering, %zu without\n", ditheredShades,
+           plainShades);
+
+    // Wire time of a 16x16 frame (1 bits, the longer ones)
+    double bitNs = (double)(((Ws2812Encoder::BIT1 & 0x7FFF) + ((Ws2812Encoder::BIT1 >> 16) & 0x7FFF)) * NS_PER_TICK);
+    double frameUs = 256 * 24 * bitNs / 1000.0 + 2 * Ws2812Encoder::RESET_HALF * NS_PER_TICK / 1000.0;
+    printf("256-LED frame: %.0f us on the wire (%zu symbols, %zu bytes)\n", frameUs,
+           Ws2812Encoder::frameSymbols(256), Ws2812Encoder::frameSymbols(256) * sizeof(uint32_t));
+
+    return checkResult();
+}
@@ -2,96 +2,396 @@
 #define ANIMATION_CONTROLLER_HPP
 
 #include <LovyanGFX.hpp>
-#include "arrow_images.h"
+#include <atomic>
+#include "animation_timeline.hpp"
 #include "constants.h"
+#include "led_display.hpp"
+#include "protocol.h"
+#include "text_marquee.hpp"
+#if ASSET_PARTITION_ENABLED
+#include "asset_partition.hpp"
+#else
+#include "assets.h"
+#endif
 
 /**
  * AnimationController Class
  * 
  * Manages animated arrow displays on the LED matrix to indicate robot direction.
- * The class cycles through 12 animation frames for each direction, creating
- * smooth animated arrows.
- * 
+ * Each direction plays its arrow animation on an AnimationTimeline, so the
+ * frame durations and loop mode declared in images/animations.json set the
+ * animation speed, independent of how often update() is called.
+ *
  * Animation Structure:
  * - 4 arrow types (forward, backward, left, right)
- * - 12 frames per animation cycle
+ * - 12 frames per animation cycle, 200 ms each
+ *
+ * Between two source frames, in-between frames are interpolated in linear
+ * light (FrameBlend::STEPS per frame), so the 12-frame arrows move smoothly
+ * at the render rate without more frames in flash. The two source frames
+ * are expanded into RAM once when playback reaches them, whatever their
+ * compression. If unpacking and interpolating an in-between frame take
+ * longer than INTERPOLATION_BUDGET_US (the transfer to the LEDs is not
+ * counted), the rest of that source frame is shown without interpolation.
+ *
+ * Direction changes crossfade from the frame on display to the new
+ * animation over CROSSFADE_MS. A frame is only sent to the LEDs when it
+ * changes or while a crossfade is running.
+ *
+ * With setPhaseLocked(), arrows play in phase with the clock passed to
+ * update() instead of from their first frame, so robots sharing a fleet
+ * clock (FleetClock) show the same frame.
+ *
+ * Arrow frames are generated at build time from images/animations.json
+ * and handed to the display straight from flash. The sprite is only drawn
+ * on for the random sparkle shown while stopped.
+ *
+ * Text Mode:
+ * Text received with setText() (TEXT_SET packets) replaces the arrows with
+ * a scrolling marquee (see TextMarquee) until an empty text is received.
+ * The text is handed from the receive callback to update() through a
+ * sequence counter, so neither side waits for the other.
+ *
+ * Animations are looked up by name in begin(): with ASSET_PARTITION_ENABLED
+ * from the asset pack in the "assets" flash partition (artwork can be
+ * updated without reflashing the firmware, and is not linked into the app
+ * image), otherwise from the tables compiled into the firmware (assets.h).
  */
 class AnimationController {
 public:
     /**
-     * Update animation frame and display arrow
+     * Look up the arrow animations
+     *
+     * @return true if all arrow animations were found
+     */
+    bool begin() {
+#if ASSET_PARTITION_ENABLED
+        if (!assets.begin()) {
+            return false;
+        }
+#endif
+        bool found = true;
+        for (uint8_t i = 0; i < ARROW_COUNT; i++) {
+            arrows[i] = {};
+#if ASSET_PARTITION_ENABLED
+            bool ok = assets.getPack().findAnimation(ARROW_NAMES[i], arrows[i]);
+#else
+            const AnimationAsset* animation = findAnimation(ARROW_NAMES[i]);
+            bool ok = animation != nullptr;
+            if (ok) {
+                arrows[i] = *animation;
+            }
+#endif
+            if (!ok || arrows[i].width != RobotLedDisplay::LED_MATRIX_WIDTH ||
+                arrows[i].height != RobotLedDisplay::LED_MATRIX_HEIGHT) {
+                Serial.printf("Animation '%s' not available\n", ARROW_NAMES[i]);
+                arrows[i] = {};
+                found = false;
+            }
+        }
+        // The timeline may still point at the previous tables
+        restartRequested.store(true);
+        return found;
+    }
+
+    /**
+     * Update animation frame and start showing it on the display
      * 
-     * @param sprite LovyanGFX sprite to draw the arrow on
+     * @param display LED matrix to show the frame on
+     * @param sprite LovyanGFX sprite used for dynamically drawn frames
      * @param direction Current movement direction (from constants.h)
+     * @param nowMs Current time (milliseconds)
      */
-    void update(LGFX_Sprite& sprite, Direction direction) {
-        animCounter++;
-        if (animCounter >= ANIMATION_FRAMES) {
-            animCounter = 0;
+    void update(RobotLedDisplay& display, LGFX_Sprite& sprite, Direction direction, uint32_t nowMs) {
+        bool restart = restartRequested.exchange(false);
+        bool textChanged = takeText(nowMs);
+        bool text = marquee.hasText();
+        // Text stays up whatever the direction; new text starts over
+        bool changed = text ? textChanged || !showingText : direction != currentDirection || showingText;
+        if (changed) {
+            // Fade out of whatever is on display
+            display.holdFrame();
+            fadeStart = nowMs;
+            fading = true;
+            restart = true;
+        }
+        currentDirection = direction;
+        showingText = text;
+
+        // Weight of the new animation in the crossfade
+        uint16_t amount = FrameBlend::FULL;
+        if (fading) {
+            uint32_t elapsed = nowMs - fadeStart;
+            if (elapsed < CROSSFADE_MS) {
+                amount = (uint16_t)(elapsed * FrameBlend::FULL / CROSSFADE_MS);
+            } else {
+                fading = false;
+            }
+        }
+        display.setCrossfade(amount);
+        // The last crossfade step is sent like a new frame
+        bool redraw = fading || amount != lastAmount;
+        lastAmount = amount;
+
+        if (text) {
+            if (marquee.update(nowMs) || redraw || restart) {
+                display.showMarqueeAsync(marquee);
+            }
+            return;
         }
 
         // Display arrow based on direction
         switch (direction) {
         case Direction::FORWARD:
-            displayArrow(sprite, 0);  // Upward arrow
+            displayArrow(display, 0, nowMs, restart, redraw);  // Upward arrow
             break;
         case Direction::BACKWARD:
-            displayArrow(sprite, 1);  // Downward arrow
+            displayArrow(display, 1, nowMs, restart, redraw);  // Downward arrow
             break;
         case Direction::LEFT:
-            displayArrow(sprite, 2);  // Leftward arrow
+            displayArrow(display, 2, nowMs, restart, redraw);  // Leftward arrow
             break;
         case Direction::RIGHT:
-            displayArrow(sprite, 3);  // Rightward arrow
+            displayArrow(display, 3, nowMs, restart, redraw);  // Rightward arrow
             break;
         default:
-            sprite.clear();
-            for (int x = 0; x < 16; x++) {
-                for (int y = 0; y < 16; y++) {
-                    switch (rand() % 10) {
-                        case 0:
-                            sprite.setColor(sprite.color565(153, 132, 0));
-                            sprite.drawPixel(x, y);
-                            break;
-                        case 1:
-                            sprite.setColor(sprite.color565(102, 81, 0));
-                            sprite.drawPixel(x, y);
-                            break;
-                        case 2:
-                            sprite.setColor(sprite.color565(51, 30, 0));
-                            sprite.drawPixel(x, y);
-                            break;
-                        default:
-                            break;
-                    }
-                }
+            if (restart || nowMs - sparkleStart >= SPARKLE_INTERVAL_MS) {
+                sparkleStart = nowMs;
+                drawSparkle(sprite);
+            } else if (!redraw) {
+                break;
             }
+            display.showAsync(sprite);
             break;
         }
     }
 
     /**
-     * Reset animation counter to first frame
+     * Show text instead of the arrows (empty text: back to the arrows)
+     * Safe to call from the ESP-NOW receive callback; applied on the next update().
+     *
+     * @param packet TEXT_SET packet (TextSet header followed by the text)
+     * @param len Packet length
+     */
+    void setText(const uint8_t* packet, size_t len) {
+        if (len < sizeof(TextSet)) {
+            return;
+        }
+        // Odd sequence while the pending text is being written
+        uint32_t sequence = textSequence.load();
+        textSequence.store(sequence + 1);
+        std::atomic_thread_fence(std::memory_order_release);
+        memcpy(&pendingHeader, packet, sizeof(TextSet));
+        pendingLength = (uint8_t)(len - sizeof(TextSet) < TEXT_MAX_LENGTH ? len - sizeof(TextSet) : TEXT_MAX_LENGTH);
+        memcpy(pendingText, packet + sizeof(TextSet), pendingLength);
+        textSequence.store(sequence + 2);
+    }
+
+    /**
+     * Restart the current animation from its first frame
+     * Safe to call from the ESP-NOW receive callback; applied on the next update().
      */
     void reset() {
-        animCounter = 0;
+        restartRequested.store(true);
     }
 
+    /**
+     * Play arrows in phase with the update() clock (from its time 0)
+     *
+     * @param locked true for a shared clock, false to start from the first frame
+     */
+    void setPhaseLocked(bool locked) {
+        phaseLocked = locked;
+    }
+
+#if ASSET_PARTITION_ENABLED
+    /**
+     * Get the asset partition slot the animations are read from
+     */
+    uint8_t getAssetSlot() const {
+        return assets.getSlot();
+    }
+#endif
+
 private:
-    // Number of frames in each animation cycle
-    static constexpr uint8_t ANIMATION_FRAMES = 12;
-    // Current animation frame (0-11)
-    uint8_t animCounter = 0;
+    // Arrow animations, in arrow type order
+    static constexpr uint8_t ARROW_COUNT = 4;
+    static constexpr const char* ARROW_NAMES[ARROW_COUNT] = {"forward", "backward", "left", "right"};
+    // Crossfade time on direction changes
+    static constexpr uint32_t CROSSFADE_MS = 150;
+    // A new random sparkle pattern while stopped every N ms
+    static constexpr uint32_t SPARKLE_INTERVAL_MS = 200;
+    // Longest an in-between frame may take to interpolate before falling back
+    static constexpr uint32_t INTERPOLATION_BUDGET_US = 4000;
+
+#if ASSET_PARTITION_ENABLED
+    AssetPartition assets;
+#endif
+    AnimationAsset arrows[ARROW_COUNT] = {};
+    AnimationTimeline timeline;
+    std::atomic<bool> restartRequested{false};
+    Direction currentDirection = Direction::STOP;
+    bool phaseLocked = false;
+    // Text mode
+    TextMarquee<RobotLedDisplay::LED_MATRIX_WIDTH, RobotLedDisplay::LED_MATRIX_HEIGHT> marquee;
+    bool showingText = false;
+    // Text handed over by setText(), and the sequence last taken
+    std::atomic<uint32_t> textSequence{0};
+    uint32_t takenSequence = 0;
+    TextSet pendingHeader = {};
+    char pendingText[TEXT_MAX_LENGTH];
+    uint8_t pendingLength = 0;
+    // Frame and interpolation step last sent (0xFFFF = none)
+    uint16_t shownFrame = 0xFFFF;
+    uint8_t shownStep = 0;
+    // Interpolation went over budget during the current source frame
+    bool overBudget = false;
+    // Current and next source frame expanded to RGB565 for interpolation
+    static constexpr uint16_t FRAME_PIXELS = RobotLedDisplay::LED_MATRIX_WIDTH * RobotLedDisplay::LED_MATRIX_HEIGHT;
+    static constexpr uint16_t FRAME_WORDS = FRAME_PIXELS / 2;
+    uint32_t sourceWords[2][FRAME_WORDS];
+    // Source frames held in sourceWords (0xFFFF = none)
+    uint16_t unpackedFrame = 0xFFFF;
+    uint16_t unpackedNext = 0xFFFF;
+    uint32_t fadeStart = 0;
+    bool fading = false;
+    uint16_t lastAmount = FrameBlend::FULL;
+    uint32_t sparkleStart = 0;
 
     /**
-     * Display a specific arrow frame on the sprite
+     * Display the current frame of an arrow animation directly from flash
      * 
-     * @param sprite LovyanGFX sprite to draw on
+     * @param display LED matrix to show the frame on
      * @param arrowType Arrow direction type (0-3)
+     * @param nowMs Current time (milliseconds)
+     * @param restart Start the animation over (from its first frame, or in phase)
+     * @param redraw Send the frame even if it has not changed
+     */
+    void displayArrow(RobotLedDisplay& display, uint8_t arrowType, uint32_t nowMs, bool restart, bool redraw) {
+        const AnimationAsset& animation = arrows[arrowType];
+        if (animation.frameCount == 0) {
+            // Not available: keep showing the previous frame
+            return;
+        }
+        if (restart) {
+            if (phaseLocked) {
+                timeline.startInPhase(animation, nowMs);
+            } else {
+                timeline.start(animation, nowMs);
+            }
+            shownFrame = 0xFFFF;
+            unpackedFrame = 0xFFFF;
+        }
+        uint16_t frame = timeline.update(nowMs);
+        uint16_t next = timeline.getNextFrame();
+        if (frame != shownFrame) {
+            overBudget = false;
+        }
+        uint8_t step = 0;
+        if (next != frame && !overBudget) {
+            step = (uint8_t)(timeline.getProgress(nowMs) * FrameBlend::STEPS / 256);
+        }
+        if (frame == shownFrame && step == shownStep && !redraw) {
+            return;
+        }
+        shownFrame = frame;
+        shownStep = step;
+        if (step > 0) {
+            // Only unpacking and interpolation count, not the transfer
+            uint32_t start = micros();
+            bool blended = unpackSources(animation, frame, next) &&
+                           display.blendFrames(unpacked(0), unpacked(1), step);
+            uint32_t elapsed = micros() - start;
+            if (!blended || elapsed > INTERPOLATION_BUDGET_US) {
+                // Too slow or not interpolatable: source frames only until the next one
+                overBudget = true;
+                shownStep = 0;
+            }
+            if (blended) {
+                display.presentAsync();
+                return;
+            }
+        }
+        display.showFrameAsync(animation.frame(frame));
+    }
+
+    /**
+     * Take text handed over by setText() into the marquee
+     *
+     * @param nowMs Current time (milliseconds)
+     * @return true if new text was taken
      */
-    void displayArrow(LGFX_Sprite& sprite, uint8_t arrowType) {
-        sprite.pushImage(0, 0, ARROW_WIDTH, ARROW_HEIGHT, 
-                        (lgfx::rgb565_t*)arrowImg[arrowType][animCounter]);
+    bool takeText(uint32_t nowMs) {
+        uint32_t sequence = textSequence.load();
+        if (sequence == takenSequence || (sequence & 1)) {
+            return false;
+        }
+        TextSet header = pendingHeader;
+        char message[TEXT_MAX_LENGTH];
+        uint8_t length = pendingLength;
+        memcpy(message, pendingText, length);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (textSequence.load() != sequence) {
+            // Overwritten while copying: take it on the next update
+            return false;
+        }
+        takenSequence = sequence;
+        marquee.setText(message, length, header.red, header.green, header.blue, header.speed, nowMs);
+        return true;
+    }
+
+    /**
+     * Expand two source frames into sourceWords, unless they already are
+     *
+     * @return false if the animation is not RGB565
+     */
+    bool unpackSources(const AnimationAsset& animation, uint16_t frame, uint16_t next) {
+        if (frame == unpackedFrame && next == unpackedNext) {
+            return true;
+        }
+        unpackedFrame = 0xFFFF;
+        if (animation.width * animation.height != FRAME_PIXELS ||
+            !FrameDecoder::unpack565(animation.frame(frame), sourceWords[0]) ||
+            !FrameDecoder::unpack565(animation.frame(next), sourceWords[1])) {
+            return false;
+        }
+        unpackedFrame = frame;
+        unpackedNext = next;
+        return true;
+    }
+
+    /**
+     * Expanded source frame (0 = current, 1 = next)
+     */
+    AssetFrame unpacked(uint8_t index) const {
+        return {sourceWords[index], FRAME_PIXELS, PixelFormat::RGB565, Compression::NONE};
+    }
+
+    /**
+     * Draw a random sparkle pattern into the sprite
+     */
+    void drawSparkle(LGFX_Sprite& sprite) {
+        sprite.clear();
+        for (int x = 0; x < 16; x++) {
+            for (int y = 0; y < 16; y++) {
+                switch (rand() % 10) {
+                    case 0:
+                        sprite.setColor(sprite.color565(153, 132, 0));
+                        sprite.drawPixel(x, y);
+                        break;
+                    case 1:
+                        sprite.setColor(sprite.color565(102, 81, 0));
+                        sprite.drawPixel(x, y);
+                        break;
+                    case 2:
+                        sprite.setColor(sprite.color565(51, 30, 0));
+                        sprite.drawPixel(x, y);
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
     }
 };
 
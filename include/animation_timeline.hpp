@@ -0,0 +1,146 @@
+#ifndef ANIMATION_TIMELINE_HPP
+#define ANIMATION_TIMELINE_HPP
+
+#include <stdint.h>
+#include "asset_format.h"
+
+/**
+ * AnimationTimeline Class
+ *
+ * Plays an animation by elapsed time: each frame is shown for its own
+ * duration (AnimationAsset::frameDurations) and the sequence continues as
+ * set by the animation's loop mode. The frame shown depends only on the
+ * time since start(), so the animation runs at the same speed however
+ * often the display is refreshed, and frames are skipped rather than
+ * slowed down when rendering falls behind.
+ *
+ * Playback walks forward from the current frame, so a call costs one
+ * comparison while the frame is unchanged; after a long gap, whole loop
+ * cycles are skipped at once. getNextFrame() and getProgress() tell how far
+ * playback is towards the next frame, for in-between frames.
+ */
+class AnimationTimeline {
+public:
+    AnimationTimeline() = default;
+
+    /**
+     * Start an animation from its first frame
+     *
+     * @param animation Animation to play (must stay valid while playing)
+     * @param nowMs Current time (milliseconds)
+     */
+    void start(const AnimationAsset& animation, uint32_t nowMs) {
+        durations = animation.frameDurations;
+        frameCount = animation.frameCount;
+        loop = animation.loop;
+        // Ping-pong plays the inner frames twice per cycle
+        steps = loop == LoopMode::PING_PONG && frameCount > 1 ? 2 * frameCount - 2 : frameCount;
+        cycleMs = 0;
+        for (uint16_t position = 0; position < steps; position++) {
+            cycleMs += durations[frameAt(position)];
+        }
+        step = 0;
+        stepStart = nowMs;
+        finished = false;
+    }
+
+    /**
+     * Start an animation in phase with a shared clock: as if it had been
+     * playing since time 0, so devices with the same clock show the same
+     * frame (ONCE animations start from their first frame)
+     *
+     * @param animation Animation to play (must stay valid while playing)
+     * @param nowMs Current time on the shared clock (milliseconds)
+     */
+    void startInPhase(const AnimationAsset& animation, uint32_t nowMs) {
+        start(animation, nowMs);
+        if (loop != LoopMode::ONCE && cycleMs > 0) {
+            stepStart = nowMs - nowMs % cycleMs;
+        }
+    }
+
+    /**
+     * Get the frame to show at a given time
+     *
+     * @param nowMs Current time (milliseconds, not earlier than the last call)
+     * @return Frame number (0 to frameCount - 1)
+     */
+    uint16_t update(uint32_t nowMs) {
+        if (steps == 0) {
+            return 0;
+        }
+        uint32_t elapsed = nowMs - stepStart;
+        if (finished || elapsed < durations[frameAt(step)]) {
+            return frameAt(step);
+        }
+        if (loop != LoopMode::ONCE && elapsed >= cycleMs) {
+            uint32_t skipped = elapsed - elapsed % cycleMs;
+            stepStart += skipped;
+            elapsed -= skipped;
+        }
+        while (elapsed >= durations[frameAt(step)]) {
+            if (loop == LoopMode::ONCE && step == steps - 1) {
+                finished = true;
+                break;
+            }
+            elapsed -= durations[frameAt(step)];
+            stepStart += durations[frameAt(step)];
+            step = step + 1 < steps ? step + 1 : 0;
+        }
+        return frameAt(step);
+    }
+
+    /**
+     * Get the frame that follows the current one
+     * (the current frame once a ONCE animation has reached its last frame)
+     */
+    uint16_t getNextFrame() const {
+        if (steps == 0 || (loop == LoopMode::ONCE && step == steps - 1)) {
+            return frameAt(step);
+        }
+        return frameAt(step + 1 < steps ? step + 1 : 0);
+    }
+
+    /**
+     * Get how much of the current frame's display time has passed
+     *
+     * @param nowMs Current time (milliseconds, as passed to the last update())
+     * @return 0 (frame just started) to 255
+     */
+    uint8_t getProgress(uint32_t nowMs) const {
+        if (steps == 0 || finished) {
+            return 0;
+        }
+        uint32_t elapsed = nowMs - stepStart;
+        uint16_t duration = durations[frameAt(step)];
+        return elapsed >= duration ? 255 : (uint8_t)(elapsed * 256 / duration);
+    }
+
+    /**
+     * Check whether a ONCE animation has reached its last frame's end
+     */
+    bool isFinished() const {
+        return finished;
+    }
+
+private:
+    const uint16_t* durations = nullptr;
+    uint16_t frameCount = 0;
+    LoopMode loop = LoopMode::LOOP;
+    // Steps per cycle and the current step
+    uint16_t steps = 0;
+    uint16_t step = 0;
+    // Start time of the current step
+    uint32_t stepStart = 0;
+    uint32_t cycleMs = 0;
+    bool finished = false;
+
+    /**
+     * Frame shown at a step of the cycle
+     */
+    uint16_t frameAt(uint16_t position) const {
+        return position < frameCount ? position : (uint16_t)(steps - position);
+    }
+};
+
+#endif // ANIMATION_TIMELINE_HPP
@@ -1,925 +0,0 @@
-/**
- * Arrow Animation Image Data
- * 
- * This file contains pre-rendered arrow images for the LED matrix animation.
- * The images were created in GIMP and exported as C source code.
- * 
- * Data Format:
- * - Color format: RGB565 (16-bit color, 2 bytes per pixel)
- * - Image size: 16x16 pixels
- * - Storage: PROGMEM (stored in flash memory to save RAM)
- * 
- * Array Structure:
- * ArrowImg[direction][frame][pixel_data]
- * - direction: 4 types (0=forward/up, 1=backward/down, 2=left, 3=right)
- * - frame: 12 animation frames per direction
- * - pixel_data: 16×16×2 = 512 bytes per frame + 1 null terminator
- */
-
-// Arrow image dimensions (must match LED matrix size)
-const uint16_t ARROW_WIDTH = 16;
-const uint16_t ARROW_HEIGHT = 16;
-// Number of animation frames per direction
-const uint16_t ARROW_PATTERNS = 12;
-
-/**
- * Arrow image data array
- * 
- * 4D array containing all arrow animation frames in RGB565 format.
- * Each frame is 16x16 pixels × 2 bytes + 1 null terminator = 513 bytes.
- * 
- * Array indices:
- * [0][frame] = Forward/upward arrow animation
- * [1][frame] = Backward/downward arrow animation
- * [2][frame] = Left arrow animation
- * [3][frame] = Right arrow animation
- */
-const unsigned char arrowImg[4][ARROW_PATTERNS][ARROW_WIDTH * ARROW_HEIGHT * 2 + 1] PROGMEM = {
-    {{
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000@\010@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\244\340\233\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000`b"
-         "`\376`\376`Z\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000)\040\366`\376`"
-         "\376\040\366\000)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000@\010@\325`\376`\376`\376"
-         "`\376@\325@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\244`\376`\376`\376`\376"
-         "`\376`\376\340\233\000\000\000\000\000\000\000\000\000\000\000\000\000\000`b`\376`\376`\376`\376`\376"
-         "`\376`\376`\376`Z\000\000\000\000\000\000\000\000\000\000`\020\240\274\340\304\340\304@\376`\376"
-         "`\376@\376\340\304\340\304\240\274`\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340"
-         "\355`\376`\376\300\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340"
-         "\355`\376`\376\300\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340"
-         "\355`\376`\376\300\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340"
-         "\355`\376`\376\300\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340"
-         "\355`\376`\376\300\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340"
-         "\355`\376`\376\300\355\000\000\000\000\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\040)\040\061\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000@\010`\335\200\335@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\040\244`\376`\376\040\254\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\200b`\376`\376`\376`\376\240j\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040)"
-         "\040\366`\376`\376`\376`\376\040\376\040\061\000\000\000\000\000\000\000\000\000\000\000\000\000\000@\010"
-         "`\335`\376`\376`\376`\376`\376`\376\200\335@\010\000\000\000\000\000\000\000\000\000\000\000\000\040"
-         "\244`\376`\376`\376`\376`\376`\376`\376`\376\040\254\000\000\000\000\000\000\000\000\000\000`"
-         "\020\200j\200j\200j\000\366`\376`\376\040\366\200j\200j\200j\200\020\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\240\223\000\244\000\244\300\223\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000`b\200b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000)\040\366\040\376\040)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000@\010@\325`\376`\376`\335@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\340\233`\376`\376`\376`\376\040\244\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "`b`\376`\376`\376`\376`\376`\376\200b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000)\040\366"
-         "`\376`\376`\376`\376`\376`\376\040\376\040)\000\000\000\000\000\000\000\000\000\000@\010@\325`\376"
-         "`\376`\376`\376`\376`\376`\376`\376`\335@\010\000\000\000\000\000\000\000\000\040\000\200\030"
-         "\200\030\200\030\300\355`\376`\376\000\366\200\030\200\030\200\030\040\010\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300I\000R\000R\340I\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000@Z`\376`\376\200b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000)\040\366`\376`\376\040\366\040)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000@\010@\325`\376`\376`\376`\376`\335@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\340\233`\376`\376`\376`\376`\376`\376\000\244\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000`Z`\376`\376`\376`\376`\376`\376`\376`\376`b\000\000\000\000\000\000\000\000\000\000`\020"
-         "\240\274\340\304\340\304@\376`\376`\376@\376\340\304\340\304\240\274\200"
-         "\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000@\010@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\340\233\000\244\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000`b`\376`\376`\376`\376\200b\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000)\040\366`\376`\376`\376`\376\040\376\040)\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000@\010@\325`\376`\376`\376`\376`\376`\376`\335@\010\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\244`\376`\376`\376`\376`\376`\376`\376`\376\040\244\000\000\000\000\000\000\000"
-         "\000\000\000`\020\240j\240j\240j\000\366`\376`\376\040\366\240j\240j\240j\200\020\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\233\040\254\040\254\340\233\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000)\040)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000@\010@\325`\335@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\244`\376`\376\040\244\000\000\000\000\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000@Z`\376`\376`\376`\376`\376`\376\200b\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000)\040\366`\376`\376`\376`\376`\376`\376\040\366\040)\000\000\000\000\000\000\000"
-         "\000\000\000@\010@\325`\376`\376`\376`\376`\376`\376`\376`\376`\335@\010\000\000\000\000"
-         "\000\000\000\000\040\010\240\030\240\030\240\030\300\355`\376`\376\000\366\240\030\240\030"
-         "\240\030\040\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340I\000R\000R\340I\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000`Z`b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000)\040\366\040\366\040)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000@\010@\325`\376`\376`\335@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\340\233`\376`\376`\376`\376\000\244\000\000\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000`b`\376`\376`\376`\376`\376`\376`\376`\376\200b\000\000\000\000\000\000\000"
-         "\000\000\000`\020\240\274\340\304\340\304\040\376`\376`\376@\376\340\304\340\304"
-         "\240\274\200\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\240\345@\376@\376\340\355"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000@\010@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340\233\040\244\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000`b`\376`\376\200b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000)\040\366`\376`\376\040\376\040)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000@\010@\325`\376`\376`\376`\376`\335@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\340\233`\376`\376`\376`\376`\376`\376\040\244\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000`\020\300j\300j\300j\000\366`\376`\376\040\366\300j\300j\300j\200\020"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\233@\254@\254\340\233\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000)\040)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000@\010@\325`\335@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\340\233`\376`\376\040\244\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000`Z`\376`\376`\376`\376\200b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         ")\040\366`\376`\376`\376`\376\040\366\040)\000\000\000\000\000\000\000\000\000\000\000\000\000\000@\010@"
-         "\325`\376`\376`\376`\376`\376`\376`\335@\010\000\000\000\000\000\000\000\000\000\000\000\000\340\233"
-         "`\376`\376`\376`\376`\376`\376`\376`\376\040\244\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340I\040R\040R\000R\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000@Z`b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         ")\040\366\040\366\040)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000@\010@\325"
-         "`\376`\376`\325@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340\233`\376"
-         "`\376`\376`\376\000\244\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000@Z`\376`\376`\376"
-         "`\376`\376`\376`b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000)\040\366`\376`\376`\376`\376"
-         "`\376`\376\040\366\040)\000\000\000\000\000\000\000\000\000\000@\010@\325`\376`\376`\376`\376`\376"
-         "`\376`\376`\376`\325@\010\000\000\000\000\000\000\000\000\040\010\240\030\240\030\240\030\300\355"
-         "`\376`\376\000\366\240\030\240\030\240\030\040\010\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000@\010@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\340\233\000\244\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000`Z`\376`\376`b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000)\040\366"
-         "`\376`\376\040\366\040)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000@\010@\325`\376`"
-         "\376`\376`\376`\335@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340\233`\376`\376"
-         "`\376`\376`\376`\376\000\244\000\000\000\000\000\000\000\000\000\000\000\000\000\000`Z`\376`\376`\376`"
-         "\376`\376`\376`\376`\376`b\000\000\000\000\000\000\000\000\000\000`\020\240\274\340\304\340\304"
-         "@\376`\376`\376@\376\340\304\340\304\240\274\200\020\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\233\040\254\040\254\340\233\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000)\040)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000@\010@\325`\335@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\244`\376`\376\040\244\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000`b`"
-         "\376`\376`\376`\376\200b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000)\040\366`\376"
-         "`\376`\376`\376\040\376\040)\000\000\000\000\000\000\000\000\000\000\000\000\000\000@\010@\325`\376`\376"
-         "`\376`\376`\376`\376`\335@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\244`\376`\376`\376"
-         "`\376`\376`\376`\376`\376\040\244\000\000\000\000\000\000\000\000\000\000`\020\240j\240j\240j\000"
-         "\366`\376`\376\040\366\240j\240j\240j\200\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000R\040Z\040Z\000R\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000@Z`b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000)\040\366\040"
-         "\366\000)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000@\010@\325`\376`\376`\325"
-         "@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340\233`\376`\376`\376`\376"
-         "\000\244\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000@Z`\376`\376`\376`\376`\376`\376"
-         "`b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000)\040\366`\376`\376`\376`\376`\376`\376\040"
-         "\366\000)\000\000\000\000\000\000\000\000\000\000@\010@\325`\376`\376`\376`\376`\376`\376`\376`"
-         "\376`\325@\010\000\000\000\000\000\000\000\000\040\010\240\030\240\030\240\030\300\355`\376`\376"
-         "\000\366\240\030\240\030\240\030\040\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345"
-         "`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345"
-         "`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345"
-         "`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345"
-         "`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000",
-     }},
-    {{
-         "\000\000\000\000\000\000\000\000\000\000\000\000\340\355`\376`\376\300\355\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\340\355`\376`\376\300\355\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340\355`\376`\376\300\355\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340\355`\376`\376\300\355\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340\355`\376`\376\300\355\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340\355`\376`\376\300\355\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000`\020\240\274\340\304\340\304@\376`\376`\376@\376\340"
-         "\304\340\304\240\274`\020\000\000\000\000\000\000\000\000\000\000`b`\376`\376`\376`\376`\376`"
-         "\376`\376`\376`Z\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\244`\376`\376`\376`\376`\376"
-         "`\376\340\233\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000@\010@\325`\376`\376`\376`\376"
-         "@\325@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000)\040\366`\376`\376\040\366"
-         "\000)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000`b`\376`\376`Z\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\244\340\233\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000@\010@\010\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\240\223\000\244\000\244\300\223\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000`\020\200j\200j\200j\000\366`\376`\376\040\366\200j\200j\200j\200"
-         "\020\000\000\000\000\000\000\000\000\000\000\040\244`\376`\376`\376`\376`\376`\376`\376`\376\040"
-         "\254\000\000\000\000\000\000\000\000\000\000\000\000@\010`\335`\376`\376`\376`\376`\376`\376\200\335"
-         "@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040)\040\366`\376`\376`\376`\376\040\376\040"
-         "\061\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\200b`\376`\376`\376`\376\240j\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\244`\376`\376\040\254\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000@\010`\335\200\335@\010\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040)\040\061\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\300I\000R\000R\340I\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\000\200"
-         "\030\200\030\200\030\300\355`\376`\376\000\366\200\030\200\030\200\030\040\010\000\000"
-         "\000\000\000\000\000\000@\010@\325`\376`\376`\376`\376`\376`\376`\376`\376`\335@\010\000"
-         "\000\000\000\000\000\000\000\000\000\000)\040\366`\376`\376`\376`\376`\376`\376\040\376\040)\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000`b`\376`\376`\376`\376`\376`\376\200b\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\340\233`\376`\376`\376`\376\040\244\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000@\010@\325`\376`\376`\335@\010\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000)\040\366\040\376\040)\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000`b\200b\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340\233\000\244\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000@\010@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300"
-         "\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300"
-         "\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300"
-         "\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300"
-         "\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300"
-         "\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300"
-         "\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000`\020\240\274\340\304"
-         "\340\304@\376`\376`\376@\376\340\304\340\304\240\274\200\020\000\000\000\000\000\000\000"
-         "\000\000\000`Z`\376`\376`\376`\376`\376`\376`\376`\376`b\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\340\233`\376`\376`\376`\376`\376`\376\000\244\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000@\010@\325`\376`\376`\376`\376`\335@\010\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000)\040\366`\376`\376\040\366\040)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000@Z`\376`\376\200b\000\000\000\000\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\244`\376`\376\040\244\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000@\010@\325`\335@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000)\040)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\233\040"
-         "\254\040\254\340\233\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345"
-         "`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345"
-         "`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345"
-         "`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345"
-         "`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345"
-         "`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000`\020\240j\240j\240j\000\366"
-         "`\376`\376\040\366\240j\240j\240j\200\020\000\000\000\000\000\000\000\000\000\000\000\244`\376`\376"
-         "`\376`\376`\376`\376`\376`\376\040\244\000\000\000\000\000\000\000\000\000\000\000\000@\010@\325`\376"
-         "`\376`\376`\376`\376`\376`\335@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000)\040\366"
-         "`\376`\376`\376`\376\040\376\040)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000`b`\376"
-         "`\376`\376`\376\200b\000\000\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\340\233`\376`\376`\376`\376\000\244\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000@\010@\325`\376`\376`\335@\010\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000)\040\366\040\366\040)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000`Z`b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340I\000R\000"
-         "R\340I\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376"
-         "\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376"
-         "\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376"
-         "\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376"
-         "\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376"
-         "\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\010\240\030\240\030\240\030\300\355"
-         "`\376`\376\000\366\240\030\240\030\240\030\040\010\000\000\000\000\000\000\000\000@\010@\325`\376"
-         "`\376`\376`\376`\376`\376`\376`\376`\335@\010\000\000\000\000\000\000\000\000\000\000\000)\040\366"
-         "`\376`\376`\376`\376`\376`\376\040\366\040)\000\000\000\000\000\000\000\000\000\000\000\000\000\000@Z`"
-         "\376`\376`\376`\376`\376`\376\200b\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\340\233`\376`\376`\376`\376`\376`\376\040\244\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000@\010@\325`\376`\376`\376`\376`\335@\010\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000)\040\366`\376`\376\040\376\040)\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000`b`\376`\376\200b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\340\233\040\244\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000@\010@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\240\345@\376"
-         "@\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376"
-         "`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376"
-         "`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376"
-         "`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376"
-         "`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376"
-         "`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000`\020\240\274\340\304\340\304"
-         "\040\376`\376`\376@\376\340\304\340\304\240\274\200\020\000\000\000\000\000\000\000\000\000\000"
-         "`b`\376`\376`\376`\376`\376`\376`\376`\376\200b\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\340\233`\376`\376`\376`\376`\376`\376`\376`\376\040\244\000\000\000"
-         "\000\000\000\000\000\000\000\000\000@\010@\325`\376`\376`\376`\376`\376`\376`\335@\010\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000)\040\366`\376`\376`\376`\376\040\366\040)\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000`Z`\376`\376`\376`\376\200b\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\340\233`\376`\376\040\244\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000@\010@\325`\335@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000)\040)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\233"
-         "@\254@\254\340\233\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345"
-         "`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345"
-         "`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345"
-         "`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345"
-         "`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345"
-         "`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000`\020\300j\300j\300j\000\366"
-         "`\376`\376\040\366\300j\300j\300j\200\020\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\040\010\240\030\240\030\240\030\300\355`\376`\376\000\366\240\030\240\030"
-         "\240\030\040\010\000\000\000\000\000\000\000\000@\010@\325`\376`\376`\376`\376`\376`\376`\376"
-         "`\376`\325@\010\000\000\000\000\000\000\000\000\000\000\000)\040\366`\376`\376`\376`\376`\376`\376"
-         "\040\366\040)\000\000\000\000\000\000\000\000\000\000\000\000\000\000@Z`\376`\376`\376`\376`\376`\376`"
-         "b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340\233`\376`\376`\376`\376\000\244\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000@\010@\325`\376`\376`\325@\010\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000)\040\366\040\366\040)\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000@Z`b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\340I\040R\040R\000R\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300"
-         "\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300"
-         "\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300"
-         "\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300"
-         "\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300"
-         "\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000`\020\240\274\340\304\340\304@\376`\376`\376@\376\340\304\340"
-         "\304\240\274\200\020\000\000\000\000\000\000\000\000\000\000`Z`\376`\376`\376`\376`\376`\376`"
-         "\376`\376`b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340\233`\376`\376`\376`\376`\376"
-         "`\376\000\244\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000@\010@\325`\376`\376`\376`\376"
-         "`\335@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000)\040\366`\376`\376\040\366"
-         "\040)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000`Z`\376`\376`b\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340\233\000\244\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000@\010@\010\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000`\020\240j\240j\240j\000\366`\376`\376\040\366\240j\240j\240j\200"
-         "\020\000\000\000\000\000\000\000\000\000\000\000\244`\376`\376`\376`\376`\376`\376`\376`\376\040"
-         "\244\000\000\000\000\000\000\000\000\000\000\000\000@\010@\325`\376`\376`\376`\376`\376`\376`\335"
-         "@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000)\040\366`\376`\376`\376`\376\040\376\040"
-         ")\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000`b`\376`\376`\376`\376\200b\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\244`\376`\376\040\244\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000@\010@\325`\335@\010\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000)\040)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\300\233\040\254\040\254\340\233\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\345`\376`\376\340\355\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\040\010\240\030\240\030\240\030\300\355`\376`\376\000\366\240\030"
-         "\240\030\240\030\040\010\000\000\000\000\000\000\000\000@\010@\325`\376`\376`\376`\376`\376`\376"
-         "`\376`\376`\325@\010\000\000\000\000\000\000\000\000\000\000\000)\040\366`\376`\376`\376`\376`\376"
-         "`\376\040\366\000)\000\000\000\000\000\000\000\000\000\000\000\000\000\000@Z`\376`\376`\376`\376`\376`\376"
-         "`b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340\233`\376`\376`\376`\376\000\244"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000@\010@\325`\376`\376`\325@\010\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000)\040\366\040\366\000)\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000@Z`b\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000R\040Z\040Z\000R\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300"
-         "\345`\376`\376\340\355\000\000\000\000\000\000\000\000\000\000\000\000",
-     }},
-    {{
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340\040\240j\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040R\000\366\300\233\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\040\000\240\223`\376`\376\240\274\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\200\020`\020\000\000\300r`\376`\376`\376`\376\240\274\200\020\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\244\340\304@\010\000\000@Z\000\366`\376@\376`\376\240\274\000\000\000"
-         "\000\000\000\000\000\000\000\200\071`\376@\376@\061\000\000\000\000\340\040\040\325`\264\040\376`\376"
-         "@Z\000\000\000\000\000\000\000\000\300\274`\376\340\233\000\000\000\000\000\000\000\000\040\010\300I\040\203"
-         "`\376\240\274\000\000\000\000\000\000\000\000@\325`\376\300A\000\000\000\000\000\000\000\000\000\000\000\000`\071"
-         "`\376\300\345\000\000\000\000\000\000\000\000\340\304`\376\040R\000\000\000\000\000\000\000\000\000\000\000\000@\061"
-         "`\376\340\355\000\000\000\000\000\000\000\000`\264`\376\000{\000\000\000\000\000\000\000\000\000\000\000\000\340r`"
-         "\376\240\274\000\000\000\000\000\000\000\000\240j`\376\000\366\340\040\000\000\000\000\000\000\000\000\340\040"
-         "\000\366`\376\240j\000\000\000\000\000\000\000\000\000\000\000\315`\376\000\366\300r\040)@\061\340r\000"
-         "\366`\376\340\304\000\000\000\000\000\000\000\000\000\000\000\000\300\030\000\315`\376`\376`\376`\376"
-         "`\376`\376\000\315\240\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300r\300\274\040\366"
-         "\340\355\300\304\240j\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000@\010\300\223\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\240j`\376`\071\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000`\335`\376\040\366`\335\240\274\340I\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\240A`\376`\376`\376`\376`\376`\376\340\304`\020\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\040\254`\376`\376`\376\000\366\240\223\040\366`\376\240\274\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000`\020\040\061\340I\240j`\071@\061\040\366`\376`b\000\000"
-         "\000\000\000\000\000\000`\213\240j`\020\000\000\000\000\000\000\000\000\000\000\000\000\040{`\376\200\264\000\000\000"
-         "\000\000\000\000\000\000\315`\376\340I\000\000\000\000\000\000\000\000\000\000\000\000@\061`\376\000\366\000\000\000\000"
-         "\000\000\000\000\040\315`\376\340I\000\000\000\000\000\000\000\000\000\000\000\000@\061`\376\240\345\000\000\000"
-         "\000\000\000\000\000\300\304`\376\200\213\000\000\000\000\000\000\000\000\000\000\000\000\000{`\376\340\304\000"
-         "\000\000\000\000\000\000\000\340I`\376@\376`\071\000\000\000\000\000\000\000\000\000)\340\355`\376@Z\000\000\000"
-         "\000\000\000\000\000\000\000\000\244`\376\340\355\340r\040\061\000)\340r\000\366`\376\040\325\000"
-         "\000\000\000\000\000\000\000\000\000\000\000`\020@\325`\376`\376`\376`\376`\376`\376\340\304\200"
-         "\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000`b\040\315\300\355\040\366\300\274\240j"
-         "\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\040\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000{\240"
-         "\223\200\020\000R\300\274`\335\240\345\200\264\040R\040\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000`b`\376\040\366`\376`\376`\376`\376`\376`\376\300\304`\010\000\000\000\000\000\000"
-         "\000\000\000\000\200A`\376`\376`\376\340\355\000{\200\071@\203\000\366`\376\000\315\000\000"
-         "\000\000\000\000\000\000\000\000\300\040`\376`\376`\376\000\315@Z\000\000\000\000@\061\000\366`\376\040"
-         "R\000\000\000\000\000\000\000\000\000\000\040\366\040\244`\071\000\000\000\000\000\000\000\000\000\000\040\203`\376\340"
-         "\304\000\000\000\000\000\000\000\000\000\000\200\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000`\061`\376\240"
-         "\345\000\000\000\000\000\000\000\000\000\000\040\010@\010\000\000\000\000\000\000\000\000\000\000\000\000@\061`\376\340\355"
-         "\000\000\000\000\000\000\000\000\300\233@\376\300\223\000\000\000\000\000\000\000\000\000\000\000\000\000{`\376\300"
-         "\274\000\000\000\000\000\000\000\000\240A`\376@\376\040\061\000\000\000\000\000\000\000\000\000)\340\355`\376"
-         "`b\000\000\000\000\000\000\000\000\000\000`\264`\376@\376\340\233@\061\040\061\000{\340\355`\376\000"
-         "\315\040\010\000\000\000\000\000\000\000\000\000\000\240\030\240\274`\376`\376`\376`\376`\376`\376"
-         "\040\325`\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\200\071\240\274\000\366\300\355"
-         "\000\315`b\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\040\000@Z\200\264\300\345\200\335\300\274\000R\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000@\010\240\274`\376`\376`\376`\376`\376`\376\340\304@\010\000\000\000\000\000\000\000\000"
-         "\000\000\040\000\340\304`\376\000\366@\203`\071\200\071@\203\000\366`\376\300\274\040\000"
-         "\000\000\000\000\000\000\000\000\040R`\376\000\366`b@\010\000\000\000\000\000\000@\061\000\366`\376@Z\000\000\000"
-         "\000\340I\000{\300\355`\376@\376\000\315\000\000\000\000\000\000\000\000\000\000@\203`\376\240\274"
-         "\000\000\000\000\240\223`\376`\376`\376`\376\340I\000\000\000\000\000\000\000\000\000\000@\061`\376\340"
-         "\355\000\000\000\000\000\000\040\203`\376`\376\000\315\000\000\000\000\000\000\000\000\000\000\000\000@\061`\376"
-         "\240\345\000\000\000\000\000\000\000\000\300j`\376\340I\000\000\000\000\000\000\000\000\000\000\000\000\000{`\376\340"
-         "\304\000\000\000\000\000\000\000\000\000\000\240A\000\000\000\000\000\000\000\000\000\000\000\000\000)\340\355`\376@Z\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\040\254\300\233\200\071\000R\200\213\340\355`\376"
-         "\040\325\040\000\000\000\000\000\000\000\000\000\000\000\000\000\240j`\376`\376`\376`\376`\376`\376\000"
-         "\315`\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\240A\040\244\000\366`\335\300\233@"
-         "Z\040\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\040R\300\274\200\335\300\355`\264@Z\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000`"
-         "\020\000\315`\376`\376`\376`\376`\376`\376\240\274`\020\000\000\000\000\000\000\000\000\000\000\040"
-         "\000\240\274`\376\000\366@\203\200\071`\071@\203\040\366`\376\000\315\000\000\000\000\000\000"
-         "\000\000\000\000`b`\376\040\366\040\061\000\000\000\000\000\000\000\000@\061\000\366`\376\040Z\000\000\000\000\000"
-         "\000\000\000`\264`\376\040{\000\000\000\000\000\000\000\000\000\000\000\000\040\203`\376\300\304\000\000\000\000"
-         "\000\000\000\000\000\366`\376\240\223\340I\000\000\000\000\000\000\000\000\000\000`\071`\376\240\345\000\000"
-         "\000\000\000\000\000\000\300\345`\376`\376@Z\000\000\000\000\000\000\000\000\000\000@\061`\376\000\366\000\000\000"
-         "\000\000\000`\020\340\355`\376`\376\240j\000\000\000\000\000\000\000\000\000\000\000{`\376\240\274\000\000"
-         "\000\000\340\040`\335`\376`\376`\376\040{\000\000\000\000\000\000\000\000\340I\040\376`\376\200"
-         "b\000\000\000\000\000)\300j\040\254\240\345`\376\200\213\000\000\240\030\000R@\203@\376`\376"
-         "`\264\040\000\000\000\000\000\000\000\000\000\000\000\000\000\240\030\040)\000\000\000\244`\376`\376`\376\040"
-         "\244\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\200\264\040\315\000\244\240"
-         "j\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000`b`\264\300\345\240\345`\264`Z\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\200\030"
-         "\240\274`\376`\376`\376`\376`\376`\376\300\274\200\020\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\340\304`\376\040\366\040\203\200\071\200A@\203\040\366`\376\240\274\000\000"
-         "\000\000\000\000\000\000\000\000\200b`\376\040\366\000)\000\000\000\000\000\000\000\000\040)\040\366`\376\200"
-         "b\000\000\000\000\000\000\000\000\240\274`\376\000{\000\000\000\000\000\000\000\000\000\000\000\000\040{`\376\200\264"
-         "\000\000\000\000\000\000\000\000\300\355`\376`\071\000\000\000\000\000\000\000\000\000\000\000\000`\071`\376\340\355"
-         "\000\000\000\000\000\000\000\000\000\366`\376\200\071\340\040\000\000\000\000\000\000\000\000\000\000\340I`\376\200"
-         "\335\000\000\000\000\000\000\000\000\200\264`\376\000\244\000\315\000\000\000\000\000\000\000\000\000\000\300\233"
-         "`\376\240\223\000\000\000\000\000\000\000\000\240j`\376@\376`\376\340r\000\000\000\000\000\000\240A\000"
-         "\366`\376\300I\000\000\000\000\000\000\000\000\040\000\340\304`\376`\376\040\366\340\040\000\000\000"
-         "R@\376`\376\340\304\040\000\000\000\000\000\000\000\000\000\000\000\340r`\376`\376`\376\340\304"
-         "\000\000\040)`\376\000\244\040\010\000\000\000\000\000\000\000\000\000\000\000\000\340\304`\376\000\315\000{\000"
-         ")\000\000\000\000\000R\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\010\200b\240\030\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\040\000@Z\200\264\300\345\200\335\300\274\000R\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000@\010\300\274`\376`\376`\376`\376`\376`\376\340\304@\010\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\315`\376\000\366@\203`\071\200\071@\203\000\366`\376\300\274\040\000\000"
-         "\000\000\000\000\000\000\000\040Z`\376\000\366@\061\000\000\000\000\000\000\000\000@\061\000\366`\376\000R\000\000\000"
-         "\000\000\000\000\000\340\304`\376\040{\000\000\000\000\000\000\000\000\000\000\000\000\300\223`\376\240\223"
-         "\000\000\000\000\000\000\000\000\300\345`\376@\061\000\000\000\000\000\000\000\000\000\000\000\000\040Z`\376\040\325"
-         "\000\000\000\000\000\000\000\000\000\366`\376\040)\000\000\000\000\000\000\000\000\000\000\000\000\240A`\376\340\355"
-         "\000\000\000\000\000\000\000\000\300\304`\376\000{\040\010\000\000\000\000\000\000\000\000\000\000\340\233`\376\000"
-         "\244\000\000\000\000\000\000\000\000\200b`\376\340\355@Z\300\304\240A\000\000\000\000\000\000`\264`\376"
-         "\200A\000\000\000\000\000\000\000\000\040\010\000\315`\376\340\355`\376`\376\300\304\240A\000\000"
-         "\000\000\300j\000\000\000\000\000\000\000\000\000\000\000\000`\020\040\315`\376`\376`\376`\376@\376\200"
-         "\071\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\010`b\340\355`\376`\376\240j\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\203`\376\040{\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000R\200\223\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\040R\240\274\200\335\300\355`\254@Z\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000`"
-         "\020\000\315`\376`\376`\376`\376`\376`\376\040\244\000\000\000\000\000\000\000\000\000\000\000\000\040"
-         "\000\240\274`\376\000\366@\203\200\071`\071@\203@\376`\376\340\233\000\000\000\000\000\000"
-         "\000\000\000\000\200b`\376\040\366\040\061\000\000\000\000\000\000\000\000\040R@\376`\376@Z\000\000\000\000\000"
-         "\000\000\000\200\264`\376\000{\000\000\000\000\000\000\000\000\000\000\000\000\200\213`\376\340\233\000\000\000"
-         "\000\000\000\000\000\000\366`\376\040\061\000\000\000\000\000\000\000\000\000\000\000\000\040Z`\376\340\304\000\000"
-         "\000\000\000\000\000\000\300\345`\376@\061\000\000\000\000\000\000\000\000\000\000\000\000\300\040\040\244\200\264"
-         "\000\000\000\000\000\000\000\000\000\315`\376\340r\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000`b`\376\340\355\000)\000\000\300I@Z\240j\000{`\213\340\040\000\000\000\000\000\000"
-         "\000\000\000\000\000\000@\325`\376\000\366\340r\300\233`\376`\376`\376`\376\200\020\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\200\020\340\304`\376`\376`\376`\376`\376`\376\200\335"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\010\240j\240\274\040\366\300\355\340\355"
-         "`\376\000\244\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\200\020\200"
-         "\345\200j\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000)\340"
-         "\040\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000`b`\264\240\345@\325\200\213\240A\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\200"
-         "\030\240\274`\376`\376`\376`\376`\376`\376\240\274\040\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\340\304`\376\040\366\040\203\200\071\040Z\000\244\040\366`\376\300\223\000"
-         "\000\000\000\000\000\000\000\000\000\200b`\376\040\366\000)\000\000\000\000\000\000\000\000\340I`\376`\376\300"
-         "I\000\000\000\000\000\000\000\000\240\274`\376\000{\000\000\000\000\000\000\000\000\000\000\000\000\040Z@\061\000\000\000\000"
-         "\000\000\000\000\000\000\300\355`\376`\071\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\366`\376@\061\000\000\000\000\000\000\000\000\000\000\000\000\340\040\340\304\300\040\000\000"
-         "\000\000\000\000\000\000\240\274`\376\340r\000\000\000\000\000\000\000\000\000\000\340r\040\366`\376\300r"
-         "\000\000\000\000\000\000\000\000\300j`\376\000\366\340\040\000\000\000\000\000)\000\315`\376`\376`\376\300"
-         "\274\000\000\000\000\000\000\000\000\000\000\340\304`\376\000\366\300r@\061\200\071\040\244@\376`"
-         "\376`\376@\376`\020\000\000\000\000\000\000\000\000\300\030\000\315`\376`\376`\376`\376`\376"
-         "`\376\000\315\040{\000\315@Z\000\000\000\000\000\000\000\000\000\000\000\000\300j\300\304\340\355\000\366"
-         "\200\274\300j\000\000\000\000\000\000@\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\040\000\340I\200\213\000\315\240\345\300\223@\061\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000`\010\300\304`\376`\376`\376`\376`\376`\376\200j\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\315`\376\000\366\340\233@Z\340I\040\244\200\264\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\040Z`\376\000\366@\061\000\000\000\000\000\000\000\000\000\000\000\000`\071\000\000\000\000\000\000\000\000\000"
-         "\000\340\304`\376\040{\000\000\000\000\000\000\000\000\000\000\000\000\300A@\376`Z\000\000\000\000\000\000\000\000\300"
-         "\345`\376@\061\000\000\000\000\000\000\000\000\000\000\000\000\340\304`\376`\376\300r\000\000\000\000\000\000"
-         "\000\366`\376\040)\000\000\000\000\000\000\000\000\000\000\300A`\376`\376`\376`\376@\203\000\000\000\000"
-         "\300\304`\376\000{\000\000\000\000\000\000\000\000\000\000\340\304`\376`\376\340\355@\203\040Z\000"
-         "\000\000\000\200b`\376\340\355\000)\000\000\000\000\000\000@\010\200b\340\355`\376@Z\000\000\000\000\000"
-         "\000\000\000\040\010\000\315`\376\340\355\340r\040)\000)\000{\000\366`\376\040\315\040\000\000\000"
-         "\000\000\000\000\000\000\000\000\200\020@\325`\376`\376`\376`\376`\376`\376\340\304`\020\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\040\000`b\040\315\340\355\040\366\300\304\200b\040\010"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000@Z\300\233\300\304@\254\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340"
-         "\233`\376`\376`\376\000\244\000\000\340\040`\020\000\000\000\000\000\000\000\000\000\000\000\000\040\000\040"
-         "\254`\376@\376\240\223@Z\340\040\000\000\200\213`\376@\325\340\233`b\300\040\000"
-         "\000\000\000`b`\376@\376\040R\000\000\000\000\000\000\000\000\040\203`\376`\376`\376\240\345\040)"
-         "\000\000\000\000\200\274`\376\040{\000\000\000\000\000\000\000\000\000\000\300r`\376`\376\340\355\200"
-         "\030\000\000\000\000\000\000\000\366`\376@\061\000\000\000\000\000\000\000\000\000\000`b`\376`\376\240\345\000"
-         "\000\000\000\000\000\000\000\300\345`\376@\061\000\000\000\000\000\000\000\000\000\000\000R\340\233`\376\000\366"
-         "\000\000\000\000\000\000\000\000\000\315`\376\340r\000\000\000\000\000\000\000\000\000\000\040\000\000{`\376\200\264"
-         "\000\000\000\000\000\000\000\000`b`\376\340\355\000)\000\000\000\000\000\000\000\000\000)\000\366`\376\200b\000\000"
-         "\000\000\000\000\000\000\000\000@\325`\376\000\366\340r\000)\040\061\340r\340\355`\376\340\304"
-         "\040\000\000\000\000\000\000\000\000\000\000\000\200\020\340\304`\376`\376`\376`\376`\376`\376@\325"
-         "\200\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\010\240j\300\274\040\376\300\355\000\315"
-         "`b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000`\020\040Z\040\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\240A\000\000\000\000\240\030\240j\240\274@\376\340\304\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\040\000\300\223`\376\000)\000\000\040\315`\376`\376`\376\340r\000\000\000\000\000\000\000\000\000"
-         "\000\040\000\240\274`\376`\376\000R\000\000\040)@\376`\376`\376\240\274\000\000\000\000\000\000\000"
-         "\000\000\000\300I`\376\000\366\340I\000\000\000\000\000\000\040\203`\376@\376`\376\200b\000\000\000"
-         "\000\000\000\000\000\240\223`\376\340\233\000\000\000\000\000\000\000\000\040\000\040\325@\254`\376`\264"
-         "\000\000\000\000\000\000\000\000\200\335`\376\000R\000\000\000\000\000\000\000\000\000\000\040)\240A`\376\300\355"
-         "\000\000\000\000\000\000\000\000\000\366`\376@\061\000\000\000\000\000\000\000\000\000\000\000\000`\061`\376\300\355"
-         "\000\000\000\000\000\000\000\000\240\274`\376\340r\000\000\000\000\000\000\000\000\000\000\000\000\340r`\376\240"
-         "\274\000\000\000\000\000\000\000\000\300j`\376\000\366\340\040\000\000\000\000\000\000\000\000\340\040\000\366"
-         "`\376\240j\000\000\000\000\000\000\000\000\000\000\340\304`\376\000\366\300r\040\061\040\061\340r\000"
-         "\366`\376\000\315\000\000\000\000\000\000\000\000\000\000\000\000\300\030\000\315`\376`\376`\376`\376"
-         "`\376`\376\340\304\240\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300j\300\304\340"
-         "\355\000\366\240\274\300j\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000",
-     }},
-    {{
-         "\000\000\000\000\000\000\000\000\000\000\240j\340\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\300\233\000\366\040R\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\240\274`\376`\376\240\223\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\200\020\240\274`\376`\376`\376`\376\300r\000\000`\020\200\020\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\240\274`\376@\376`\376\000\366@Z\000\000@\010\340\304\000\244\000\000\000"
-         "\000\000\000\000\000\000\000@Z`\376\040\376`\264\040\325\340\040\000\000\000\000@\061@\376`\376\200"
-         "\071\000\000\000\000\000\000\000\000\240\274`\376\040\203\300I\040\010\000\000\000\000\000\000\000\000\340\233"
-         "`\376\300\274\000\000\000\000\000\000\000\000\300\345`\376`\071\000\000\000\000\000\000\000\000\000\000\000\000\300"
-         "A`\376@\325\000\000\000\000\000\000\000\000\340\355`\376@\061\000\000\000\000\000\000\000\000\000\000\000\000\040R"
-         "`\376\340\304\000\000\000\000\000\000\000\000\240\274`\376\340r\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "{`\376`\264\000\000\000\000\000\000\000\000\240j`\376\000\366\340\040\000\000\000\000\000\000\000\000\340\040"
-         "\000\366`\376\240j\000\000\000\000\000\000\000\000\000\000\340\304`\376\000\366\340r@\061\040)\300"
-         "r\000\366`\376\000\315\000\000\000\000\000\000\000\000\000\000\000\000\240\030\000\315`\376`\376`\376`\376"
-         "`\376`\376\000\315\300\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\240j\300\304\340"
-         "\355\040\366\300\274\300r\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300\223@\010\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000`\071`\376\240j\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\340I\240\274`\335\040\366`\376`\335\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000`\020\340\304`\376`\376`\376`\376`\376`\376\240A\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\240\274`\376\040\366\240\223\000\366`\376`\376`\376\040\254\000\000\000\000\000"
-         "\000\000\000\000\000\000\000`b`\376\040\366@\061`\071\240j\340I\040\061`\020\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\200\264`\376\040{\000\000\000\000\000\000\000\000\000\000\000\000`\020\240j`\213\000\000\000"
-         "\000\000\000\000\000\000\366`\376@\061\000\000\000\000\000\000\000\000\000\000\000\000\340I`\376\000\315\000\000\000\000"
-         "\000\000\000\000\240\345`\376@\061\000\000\000\000\000\000\000\000\000\000\000\000\340I`\376\040\315\000\000\000"
-         "\000\000\000\000\000\340\304`\376\000{\000\000\000\000\000\000\000\000\000\000\000\000\200\213`\376\300\304\000"
-         "\000\000\000\000\000\000\000@Z`\376\340\355\000)\000\000\000\000\000\000\000\000`\071@\376`\376\340I\000\000\000"
-         "\000\000\000\000\000\000\000\040\325`\376\000\366\340r\000)\040\061\340r\340\355`\376\000\244\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\200\020\340\304`\376`\376`\376`\376`\376`\376@\325"
-         "`\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\000\240j\300\274\040\366\300\355\040\315"
-         "`b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\010\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\040\000\040R\200\264\240\345`\335\300\274\000R\200\020\240\223\000{\000\000\000\000\000\000"
-         "\000\000\000\000`\010\300\304`\376`\376`\376`\376`\376`\376\040\366`\376`b\000\000\000\000"
-         "\000\000\000\000\000\000\000\315`\376\000\366@\203\200\071\000{\340\355`\376`\376`\376\200A"
-         "\000\000\000\000\000\000\000\000\040R`\376\000\366@\061\000\000\000\000@Z\000\315`\376`\376`\376\300\040"
-         "\000\000\000\000\000\000\000\000\340\304`\376\040\203\000\000\000\000\000\000\000\000\000\000`\071\040\244\040\366"
-         "\000\000\000\000\000\000\000\000\000\000\240\345`\376`\061\000\000\000\000\000\000\000\000\000\000\000\000\000\000\200\020"
-         "\000\000\000\000\000\000\000\000\000\000\340\355`\376@\061\000\000\000\000\000\000\000\000\000\000\000\000@\010\040\010\000"
-         "\000\000\000\000\000\000\000\000\000\300\274`\376\000{\000\000\000\000\000\000\000\000\000\000\000\000\300\223@\376\300"
-         "\233\000\000\000\000\000\000\000\000`b`\376\340\355\000)\000\000\000\000\000\000\000\000\040\061@\376`\376\240"
-         "A\000\000\000\000\000\000\000\000\040\010\000\315`\376\340\355\000{\040\061@\061\340\233@\376`\376"
-         "`\264\000\000\000\000\000\000\000\000\000\000\000\000`\020\040\325`\376`\376`\376`\376`\376`\376\240"
-         "\274\240\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\000`b\000\315\300\355\000\366\240\274"
-         "\200\071\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000R\300\274\200\335\300\345\200\264@Z\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000@\010\340\304`\376`\376`\376`\376`\376`\376\240\274@\010\000\000\000\000\000\000\000\000"
-         "\000\000\040\000\300\274`\376\000\366@\203\200\071`\071@\203\000\366`\376\340\304\040\000"
-         "\000\000\000\000\000\000\000\000@Z`\376\000\366@\061\000\000\000\000\000\000@\010`b\000\366`\376\040R\000\000\000"
-         "\000\000\000\000\000\240\274`\376@\203\000\000\000\000\000\000\000\000\000\000\000\315@\376`\376\300\355"
-         "\000{\340I\000\000\000\000\340\355`\376@\061\000\000\000\000\000\000\000\000\000\000\340I`\376`\376`\376"
-         "`\376\240\223\000\000\000\000\240\345`\376@\061\000\000\000\000\000\000\000\000\000\000\000\000\000\315`\376"
-         "`\376\040\203\000\000\000\000\000\000\340\304`\376\000{\000\000\000\000\000\000\000\000\000\000\000\000\340I`\376"
-         "\300j\000\000\000\000\000\000\000\000@Z`\376\340\355\000)\000\000\000\000\000\000\000\000\000\000\000\000\240A\000\000"
-         "\000\000\000\000\000\000\000\000\040\000\040\325`\376\340\355\200\213\000R\200\071\300\233\040\254"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000`\020\000\315`\376`\376`\376`\376`\376`\376"
-         "\240j\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\010@Z\300\233`\335\000\366\040\244\240"
-         "A\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000@Z`\264\300\355\200\335\300\274\040R\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000`"
-         "\020\240\274`\376`\376`\376`\376`\376`\376\000\315`\020\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\315`\376\040\366@\203`\071\200\071@\203\000\366`\376\240\274\040\000\000\000\000\000"
-         "\000\000\000\000\040Z`\376\000\366@\061\000\000\000\000\000\000\000\000\040\061\040\366`\376`b\000\000\000\000\000"
-         "\000\000\000\300\304`\376\040\203\000\000\000\000\000\000\000\000\000\000\000\000\040{`\376`\264\000\000\000\000"
-         "\000\000\000\000\240\345`\376`\071\000\000\000\000\000\000\000\000\000\000\340I\240\223`\376\000\366\000\000"
-         "\000\000\000\000\000\000\000\366`\376@\061\000\000\000\000\000\000\000\000\000\000@Z`\376`\376\300\345\000\000\000"
-         "\000\000\000\000\000\240\274`\376\000{\000\000\000\000\000\000\000\000\000\000\240j`\376`\376\340\355`\020"
-         "\000\000\000\000\000\000\200b`\376\040\376\340I\000\000\000\000\000\000\000\000\040{`\376`\376`\376`\335"
-         "\340\040\000\000\000\000\040\000`\264`\376@\376@\203\000R\240\030\000\000\200\213`\376\240\345"
-         "\040\254\300j\000)\000\000\000\000\000\000\040\000\040\244`\376`\376`\376\000\244\000\000\040)\240"
-         "\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\240j\000\244\040\315\200\264\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000`Z`\264\240\345\300\345`\264`b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\200\020"
-         "\300\274`\376`\376`\376`\376`\376`\376\240\274\200\030\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\240\274`\376\040\366@\203\200A\200\071\040\203\040\366`\376\340\304\000\000"
-         "\000\000\000\000\000\000\000\000\200b`\376\040\366\040)\000\000\000\000\000\000\000\000\000)\040\366`\376\200"
-         "b\000\000\000\000\000\000\000\000\200\264`\376\040{\000\000\000\000\000\000\000\000\000\000\000\000\000{`\376\240\274"
-         "\000\000\000\000\000\000\000\000\340\355`\376`\071\000\000\000\000\000\000\000\000\000\000\000\000`\071`\376\300\355"
-         "\000\000\000\000\000\000\000\000\200\335`\376\340I\000\000\000\000\000\000\000\000\000\000\340\040\200\071`\376"
-         "\000\366\000\000\000\000\000\000\000\000\240\223`\376\300\233\000\000\000\000\000\000\000\000\000\000\000\315\000\244"
-         "`\376\200\264\000\000\000\000\000\000\000\000\300I`\376\000\366\240A\000\000\000\000\000\000\340r`\376"
-         "@\376`\376\240j\000\000\000\000\000\000\000\000\040\000\340\304`\376@\376\000R\000\000\340\040\040\366"
-         "`\376`\376\340\304\040\000\000\000\000\000\000\000\000\000\000\000\040\010\000\244`\376\040)\000\000\340"
-         "\304`\376`\376`\376\340r\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000R\000\000\000\000\000)\000"
-         "{\000\315`\376\340\304\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\240\030\200b\040\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000R\300\274\200\335\300\345\200\264@Z\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000@\010\340\304`\376`\376`\376`\376`\376`\376\300\274@\010\000\000\000\000\000\000\000\000"
-         "\000\000\040\000\300\274`\376\000\366@\203\200\071`\071@\203\000\366`\376\000\315\000\000\000"
-         "\000\000\000\000\000\000\000\000R`\376\000\366@\061\000\000\000\000\000\000\000\000@\061\000\366`\376\040Z\000\000\000"
-         "\000\000\000\000\000\240\223`\376\300\223\000\000\000\000\000\000\000\000\000\000\000\000\040{`\376\340\304"
-         "\000\000\000\000\000\000\000\000\040\325`\376\040Z\000\000\000\000\000\000\000\000\000\000\000\000@\061`\376\300\345"
-         "\000\000\000\000\000\000\000\000\340\355`\376\240A\000\000\000\000\000\000\000\000\000\000\000\000\040)`\376\000\366"
-         "\000\000\000\000\000\000\000\000\000\244`\376\340\233\000\000\000\000\000\000\000\000\000\000\040\010\000{`\376\300"
-         "\304\000\000\000\000\000\000\000\000\200A`\376`\264\000\000\000\000\000\000\240A\300\304@Z\340\355`\376"
-         "\200b\000\000\000\000\000\000\000\000\000\000\300j\000\000\000\000\240A\300\304`\376`\376\340\355`\376"
-         "\000\315\040\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\200\071@\376`\376`\376`\376`\376"
-         "\040\315`\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\240j`\376`\376\340\355`b"
-         "\040\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040{`\376\040\203\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\200\223\000R\000\000\000\000\000\000"
-         "\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000@Z`\254\300\355\200\335\240\274\040R\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\040\244`\376`\376`\376`\376`\376`\376\000\315`\020\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\340\233`\376@\376@\203`\071\200\071@\203\000\366`\376\240\274\040\000\000\000\000\000\000"
-         "\000\000\000@Z`\376@\376\040R\000\000\000\000\000\000\000\000\040\061\040\366`\376\200b\000\000\000\000\000\000"
-         "\000\000\340\233`\376\200\213\000\000\000\000\000\000\000\000\000\000\000\000\000{`\376\200\264\000\000\000\000"
-         "\000\000\000\000\340\304`\376\040Z\000\000\000\000\000\000\000\000\000\000\000\000\040\061`\376\000\366\000\000\000"
-         "\000\000\000\000\000\200\264\040\244\300\040\000\000\000\000\000\000\000\000\000\000\000\000@\061`\376\300\345"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340r`\376\000\315\000\000"
-         "\000\000\000\000\000\000\000\000\340\040`\213\000{\240j@Z\300I\000\000\000)\340\355`\376`b\000\000\000\000"
-         "\000\000\000\000\000\000\200\020`\376`\376`\376`\376\300\233\340r\000\366`\376@\325\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\200\335`\376`\376`\376`\376`\376`\376\340\304\200"
-         "\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\244`\376\340\355\300\355\040\366\240\274"
-         "\240j\040\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\200j\200\345\200\020\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340\040\000)\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\240A\200\213@\325\240\345`\264`b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040"
-         "\000\240\274`\376`\376`\376`\376`\376`\376\240\274\200\030\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\300\223`\376\040\366\000\244\040Z\200\071\040\203\040\366`\376\340\304\000"
-         "\000\000\000\000\000\000\000\000\000\300I`\376`\376\340I\000\000\000\000\000\000\000\000\000)\040\366`\376\200"
-         "b\000\000\000\000\000\000\000\000\000\000@\061\040Z\000\000\000\000\000\000\000\000\000\000\000\000\000{`\376\240\274\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000`\071`\376\300\355\000\000\000\000"
-         "\000\000\000\000\300\040\340\304\340\040\000\000\000\000\000\000\000\000\000\000\000\000@\061`\376\000\366\000\000"
-         "\000\000\000\000\000\000\300r`\376\040\366\340r\000\000\000\000\000\000\000\000\000\000\340r`\376\240\274"
-         "\000\000\000\000\000\000\000\000\300\274`\376`\376`\376\000\315\000)\000\000\000\000\340\040\000\366`\376"
-         "\300j\000\000\000\000\000\000`\020@\376`\376`\376@\376\040\244\200\071@\061\300r\000\366`\376"
-         "\340\304\000\000\000\000\000\000\000\000@Z\000\315\040{\000\315`\376`\376`\376`\376`\376`\376"
-         "\000\315\300\030\000\000\000\000\000\000\000\000@\010\000\000\000\000\000\000\300j\200\274\000\366\340\355"
-         "\300\304\300j\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000@\061\300\223\240\345\000\315\200\213\340I\040\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\200j`\376`\376`\376`\376`\376`\376\300\304`\010\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\200\264\040\244\340I@Z\340\233\000\366`\376\000\315\000\000\000\000\000\000"
-         "\000\000\000\000\000\000`\071\000\000\000\000\000\000\000\000\000\000\000\000@\061\000\366`\376\040Z\000\000\000\000\000\000\000"
-         "\000`Z@\376\300A\000\000\000\000\000\000\000\000\000\000\000\000\040{`\376\340\304\000\000\000\000\000\000\300r"
-         "`\376`\376\340\304\000\000\000\000\000\000\000\000\000\000\000\000@\061`\376\300\345\000\000\000\000@\203"
-         "`\376`\376`\376`\376\300A\000\000\000\000\000\000\000\000\000\000\040)`\376\000\366\000\000\000\000\040Z"
-         "@\203\340\355`\376`\376\340\304\000\000\000\000\000\000\000\000\000\000\000{`\376\300\304\000\000\000"
-         "\000\000\000\000\000@Z`\376\340\355\200b@\010\000\000\000\000\000\000\000)\340\355`\376\200b\000\000\000"
-         "\000\000\000\000\000\040\000\040\315`\376\000\366\000{\000)\040)\340r\340\355`\376\000\315\040\010"
-         "\000\000\000\000\000\000\000\000\000\000`\020\340\304`\376`\376`\376`\376`\376`\376@\325\200\020"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\010\200b\300\304\040\366\340\355\040\315`b\040"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000@\254\300\304\300\233@Z\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000`"
-         "\020\340\040\000\000\000\244`\376`\376`\376\340\233\000\000\000\000\000\000\000\000\300\040`b\340"
-         "\233@\325`\376\200\213\000\000\340\040@Z\240\223@\376`\376\040\254\040\000\000\000\000\000"
-         "\040)\240\345`\376`\376`\376\040\203\000\000\000\000\000\000\000\000\040R@\376`\376`b\000\000\000"
-         "\000\000\000\200\030\340\355`\376`\376\300r\000\000\000\000\000\000\000\000\000\000\040{`\376\200\274"
-         "\000\000\000\000\000\000\000\000\240\345`\376`\376`b\000\000\000\000\000\000\000\000\000\000@\061`\376\000\366\000"
-         "\000\000\000\000\000\000\000\000\366`\376\340\233\000R\000\000\000\000\000\000\000\000\000\000@\061`\376\300\345"
-         "\000\000\000\000\000\000\000\000\200\264`\376\000{\040\000\000\000\000\000\000\000\000\000\000\000\340r`\376\000\315"
-         "\000\000\000\000\000\000\000\000\200b`\376\000\366\000)\000\000\000\000\000\000\000\000\000)\340\355`\376`b\000\000"
-         "\000\000\000\000\000\000\040\000\340\304`\376\340\355\340r\040\061\000)\340r\000\366`\376@\325"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\200\020@\325`\376`\376`\376`\376`\376`\376\340\304"
-         "\200\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000`b\000\315\300\355\040\376\300\274\240"
-         "j\040\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000",
-     },
-     {
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\040\000\040Z`\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\340"
-         "\304@\376\240\274\240j\240\030\000\000\000\000\240A\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\340r`\376`\376`\376\040\315\000\000\000)`\376\300\223\040\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\240\274`\376`\376@\376\040)\000\000\000R`\376`\376\240\274\040\000\000\000\000\000\000"
-         "\000\000\000\200b`\376@\376`\376\040\203\000\000\000\000\000\000\340I\000\366`\376\300I\000\000\000"
-         "\000\000\000\000\000`\264`\376@\254\040\325\040\000\000\000\000\000\000\000\000\000\340\233`\376\240\223"
-         "\000\000\000\000\000\000\000\000\300\355`\376\240A\040)\000\000\000\000\000\000\000\000\000\000\000R`\376\200\335"
-         "\000\000\000\000\000\000\000\000\300\355`\376`\061\000\000\000\000\000\000\000\000\000\000\000\000@\061`\376\000\366"
-         "\000\000\000\000\000\000\000\000\240\274`\376\340r\000\000\000\000\000\000\000\000\000\000\000\000\340r`\376\240"
-         "\274\000\000\000\000\000\000\000\000\240j`\376\000\366\340\040\000\000\000\000\000\000\000\000\340\040\000\366"
-         "`\376\300j\000\000\000\000\000\000\000\000\000\000\000\315`\376\000\366\340r\040\061\040\061\300r\000\366"
-         "`\376\340\304\000\000\000\000\000\000\000\000\000\000\000\000\240\030\340\304`\376`\376`\376`\376"
-         "`\376`\376\000\315\300\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\300j\240\274\000\366"
-         "\340\355\300\304\300j\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-         "\000\000\000\000\000\000\000\000\000\000\000\000",
-     }}};
@@ -0,0 +1,85 @@
+#ifndef ASSET_FORMAT_H
+#define ASSET_FORMAT_H
+
+#include <stdint.h>
+
+/**
+ * Animation Asset Format
+ *
+ * Frames are stored as 32-bit words so they can be read from flash with
+ * aligned word loads. The word layout depends on the pixel format and the
+ * compression chosen per animation (see images/animations.json):
+ *
+ * - RGB565, no compression: two pixels per word, first pixel in the low half
+ * - RGB565, RLE:            one run per word, (length << 16) | pixel
+ * - RGB888, no compression: one pixel per word, 0x00RRGGBB
+ * - RGB888, RLE:            one run per word, (length << 24) | 0xRRGGBB
+ *
+ * Pixels are in display order (row by row from the top left). The asset
+ * tables themselves are generated by scripts/generate_assets.py.
+ *
+ * Each animation also carries its timing: a display time per frame and a
+ * loop mode, played back by AnimationTimeline.
+ */
+
+/**
+ * Pixel Format Constants
+ */
+enum class PixelFormat : uint8_t {
+    RGB565 = 0,
+    RGB888 = 1
+};
+
+/**
+ * Compression Constants
+ */
+enum class Compression : uint8_t {
+    NONE = 0,
+    RLE = 1
+};
+
+/**
+ * Loop Mode Constants
+ */
+enum class LoopMode : uint8_t {
+    LOOP = 0,      // 0, 1, ..., n-1, 0, 1, ...
+    PING_PONG = 1, // 0, 1, ..., n-1, n-2, ..., 1, 0, 1, ...
+    ONCE = 2       // 0, 1, ..., n-1, then hold the last frame
+};
+
+/**
+ * One encoded frame
+ */
+struct AssetFrame {
+    const uint32_t* words; // Encoded frame data (word aligned)
+    uint16_t pixelCount;   // Pixels in the decoded frame
+    PixelFormat format;
+    Compression compression;
+};
+
+/**
+ * One animation: a timed sequence of equally sized frames
+ */
+struct AnimationAsset {
+    const char* name;
+    uint16_t width;
+    uint16_t height;
+    uint16_t frameCount;
+    PixelFormat format;
+    Compression compression;
+    const uint32_t* data;           // Start of the word array holding the frames
+    const uint32_t* frameOffsets;   // Word offset of each frame in data
+    const uint16_t* frameDurations; // Display time of each frame (ms, at least 1)
+    LoopMode loop;                  // Playback after the last frame
+
+    /**
+     * Get a frame
+     *
+     * @param frame Frame number (0 to frameCount - 1)
+     */
+    AssetFrame frame(uint16_t frame) const {
+        return {data + frameOffsets[frame], (uint16_t)(width * height), format, compression};
+    }
+};
+
+#endif // ASSET_FORMAT_H
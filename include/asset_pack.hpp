@@ -0,0 +1,223 @@
+#ifndef ASSET_PACK_HPP
+#define ASSET_PACK_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "asset_format.h"
+#include "crc32.hpp"
+
+/**
+ * AssetPack Class
+ *
+ * Read-only view of an animation asset pack: the same animations as the
+ * generated assets.h, in a single binary image that lives in its own flash
+ * partition (see AssetPartition) or, on the host, in a memory-mapped file.
+ * Frames are used in place; nothing is copied out of the pack.
+ *
+ * Pack Format (little-endian, all offsets in bytes from the pack start):
+ * - Header (16 bytes): magic "ANPK", version, animation count, pack size,
+ *   CRC-32 of everything after the header
+ * - Animation entries (40 bytes each): name, size, frame count, format,
+ *   compression, loop mode, offsets of the frame offset and duration tables
+ * - Frame offset tables: one uint32_t per frame, word offset of the frame
+ *   from the pack start
+ * - Frame duration tables: one uint16_t per frame (ms), padded to 4 bytes
+ * - Frame data: 32-bit words as described in asset_format.h
+ *
+ * The pack must be mapped at a 4-byte aligned address.
+ */
+class AssetPack {
+public:
+    static constexpr uint32_t MAGIC = 0x4B504E41; // "ANPK"
+    static constexpr uint16_t VERSION = 2;
+    static constexpr size_t NAME_LENGTH = 20;
+
+    struct Header {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t animationCount;
+        uint32_t size; // Pack size in bytes, including the header
+        uint32_t crc;  // CRC-32 of bytes 16 to size
+    };
+
+    struct Entry {
+        char name[NAME_LENGTH]; // Zero-terminated
+        uint16_t width;
+        uint16_t height;
+        uint16_t frameCount;
+        uint8_t format;
+        uint8_t compression;
+        uint8_t loop;
+        uint8_t reserved[3];
+        uint32_t offsetsOffset;   // Frame offset table
+        uint32_t durationsOffset; // Frame duration table
+    };
+
+    static_assert(sizeof(Header) == 16 && sizeof(Entry) == 40, "Pack structures must match the file format");
+
+    AssetPack() = default;
+
+    /**
+     * Validate a pack and make its animations available
+     *
+     * Checks the header, the CRC and that every frame lies inside the pack,
+     * so a partially written or stale pack is rejected as a whole.
+     *
+     * @param data Start of the mapped pack (4-byte aligned)
+     * @param size Size of the mapping (may be larger than the pack)
+     * @return true if the pack is valid
+     */
+    bool open(const void* data, size_t size) {
+        close();
+        auto* bytes = static_cast<const uint8_t*>(data);
+        if (((uintptr_t)bytes & 3) || size < sizeof(Header)) {
+            return false;
+        }
+        Header header;
+        memcpy(&header, bytes, sizeof(header));
+        if (header.magic != MAGIC || header.version != VERSION || header.size > size ||
+            header.size % 4 || sizeof(Header) + (size_t)header.animationCount * sizeof(Entry) > header.size) {
+            return false;
+        }
+        if (crc32(bytes + sizeof(Header), header.size - sizeof(Header)) != header.crc) {
+            return false;
+        }
+
+        base = bytes;
+        packSize = header.size;
+        entries = reinterpret_cast<const Entry*>(bytes + sizeof(Header));
+        count = header.animationCount;
+        for (uint16_t i = 0; i < count; i++) {
+            if (!validate(entries[i])) {
+                close();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Forget the pack
+     */
+    void close() {
+        base = nullptr;
+        entries = nullptr;
+        packSize = 0;
+        count = 0;
+    }
+
+    /**
+     * Check whether a valid pack is open
+     */
+    bool isOpen() const {
+        return base != nullptr;
+    }
+
+    /**
+     * Get the number of animations
+     */
+    uint16_t getAnimationCount() const {
+        return count;
+    }
+
+    /**
+     * Get an animation by index
+     *
+     * @param index Animation index (0 to getAnimationCount() - 1)
+     * @param animation Receives the animation (pointing into the pack)
+     * @return true if the index is valid
+     */
+    bool getAnimation(uint16_t index, AnimationAsset& animation) const {
+        if (index >= count) {
+            return false;
+        }
+        const Entry& entry = entries[index];
+        animation.name = entry.name;
+        animation.width = entry.width;
+        animation.height = entry.height;
+        animation.frameCount = entry.frameCount;
+        animation.format = (PixelFormat)entry.format;
+        animation.compression = (Compression)entry.compression;
+        animation.data = reinterpret_cast<const uint32_t*>(base);
+        animation.frameOffsets = reinterpret_cast<const uint32_t*>(base + entry.offsetsOffset);
+        animation.frameDurations = reinterpret_cast<const uint16_t*>(base + entry.durationsOffset);
+        animation.loop = (LoopMode)entry.loop;
+        return true;
+    }
+
+    /**
+     * Look up an animation by name
+     *
+     * @param name Animation name
+     * @param animation Receives the animation (pointing into the pack)
+     * @return true if found
+     */
+    bool findAnimation(const char* name, AnimationAsset& animation) const {
+        for (uint16_t i = 0; i < count; i++) {
+            if (!strcmp(entries[i].name, name)) {
+                return getAnimation(i, animation);
+            }
+        }
+        return false;
+    }
+
+private:
+    const uint8_t* base = nullptr;
+    const Entry* entries = nullptr;
+    uint32_t packSize = 0;
+    uint16_t count = 0;
+
+    /**
+     * Check that an entry, its tables and all of its frames lie inside the
+     * pack, and that every frame has a display time
+     */
+    bool validate(const Entry& entry) const {
+        if (entry.name[NAME_LENGTH - 1] != '\0' || entry.format > (uint8_t)PixelFormat::RGB888 ||
+            entry.compression > (uint8_t)Compression::RLE || entry.loop > (uint8_t)LoopMode::ONCE ||
+            entry.offsetsOffset % 4 || (uint64_t)entry.offsetsOffset + entry.frameCount * 4ull > packSize ||
+            entry.durationsOffset % 2 || (uint64_t)entry.durationsOffset + entry.frameCount * 2ull > packSize) {
+            return false;
+        }
+        auto* durations = reinterpret_cast<const uint16_t*>(base + entry.durationsOffset);
+        for (uint16_t i = 0; i < entry.frameCount; i++) {
+            if (durations[i] == 0) {
+                return false;
+            }
+        }
+        const uint32_t words = packSize / 4;
+        const uint32_t pixels = (uint32_t)entry.width * entry.height;
+        auto* offsets = reinterpret_cast<const uint32_t*>(base + entry.offsetsOffset);
+        for (uint16_t i = 0; i < entry.frameCount; i++) {
+            if (offsets[i] > words || frameWords(entry, offsets[i], pixels) > words - offsets[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Number of words a frame occupies (walks the runs of RLE frames)
+     *
+     * @return Word count, or UINT32_MAX if the frame runs past the pack
+     */
+    uint32_t frameWords(const Entry& entry, uint32_t offset, uint32_t pixels) const {
+        if (entry.compression == (uint8_t)Compression::NONE) {
+            return entry.format == (uint8_t)PixelFormat::RGB565 ? (pixels + 1) / 2 : pixels;
+        }
+        auto* words = reinterpret_cast<const uint32_t*>(base);
+        const uint32_t end = packSize / 4;
+        const uint8_t shift = entry.format == (uint8_t)PixelFormat::RGB565 ? 16 : 24;
+        uint32_t covered = 0;
+        uint32_t i = offset;
+        while (covered < pixels) {
+            if (i >= end) {
+                return UINT32_MAX;
+            }
+            covered += words[i++] >> shift;
+        }
+        return i - offset;
+    }
+};
+
+#endif // ASSET_PACK_HPP
@@ -0,0 +1,112 @@
+#ifndef ASSET_PARTITION_HPP
+#define ASSET_PARTITION_HPP
+
+#include <Arduino.h>
+#include <esp_partition.h>
+#include "asset_pack.hpp"
+#include "asset_slots.hpp"
+#include "partition_flash.hpp"
+
+// Custom data partition subtype and label (see partitions.csv)
+static constexpr uint8_t ASSET_PARTITION_SUBTYPE = 0x40;
+static constexpr const char* ASSET_PARTITION_LABEL = "assets";
+
+/**
+ * AssetPartition Class
+ *
+ * Maps the active asset pack of the "assets" flash data partition into the
+ * address space with esp_partition_mmap. Frames are then read in place
+ * through the flash cache, exactly like const data in the app image, but
+ * the artwork can be updated without reflashing the firmware, either over
+ * USB (`pio run -t upload_assets`) or over ESP-NOW (see AssetUploader).
+ *
+ * The partition holds two pack slots (see AssetSlots). The newest slot
+ * whose pack validates is used; if it is damaged, the previous pack is.
+ *
+ * Partition (partitions.csv):
+ * assets, data, 0x40, 0x290000, 256K
+ */
+class AssetPartition {
+public:
+    AssetPartition() = default;
+
+    /**
+     * Map the newest valid pack (unmaps the current one first)
+     *
+     * @return true if a valid pack was found
+     */
+    bool begin() {
+        end();
+        if (!flash.begin()) {
+            Serial.println("Asset partition not found");
+            return false;
+        }
+
+        AssetSlots::Header headers[AssetSlots::SLOT_COUNT];
+        uint8_t order[AssetSlots::SLOT_COUNT];
+        uint8_t count = AssetSlots::scan(flash, headers, order);
+        for (uint8_t i = 0; i < count; i++) {
+            uint8_t slot = order[i];
+            const void* data = nullptr;
+            if (esp_partition_mmap(flash.getPartition(), AssetSlots::packOffset(flash.size(), slot),
+                                   headers[slot].size, ESP_PARTITION_MMAP_DATA, &data, &mapping) != ESP_OK) {
+                Serial.println("Asset partition mapping failed");
+                return false;
+            }
+            if (pack.open(data, headers[slot].size)) {
+                mappedSlot = slot;
+                generation = headers[slot].generation;
+                Serial.printf("Asset pack: %u animations (slot %u, generation %lu)\n", pack.getAnimationCount(),
+                              slot, (unsigned long)generation);
+                return true;
+            }
+            esp_partition_munmap(mapping);
+            mapping = 0;
+        }
+        Serial.println("Asset pack missing or invalid");
+        return false;
+    }
+
+    /**
+     * Unmap the pack (frames from the pack become invalid)
+     */
+    void end() {
+        pack.close();
+        mappedSlot = AssetSlots::NO_SLOT;
+        generation = 0;
+        if (mapping) {
+            esp_partition_munmap(mapping);
+            mapping = 0;
+        }
+    }
+
+    /**
+     * Get the pack stored in the partition
+     */
+    const AssetPack& getPack() const {
+        return pack;
+    }
+
+    /**
+     * Get the slot of the mapped pack (AssetSlots::NO_SLOT if none)
+     */
+    uint8_t getSlot() const {
+        return mappedSlot;
+    }
+
+    /**
+     * Get the generation of the mapped pack (0 if none)
+     */
+    uint32_t getGeneration() const {
+        return generation;
+    }
+
+private:
+    PartitionFlash flash{ASSET_PARTITION_SUBTYPE, ASSET_PARTITION_LABEL};
+    AssetPack pack;
+    esp_partition_mmap_handle_t mapping = 0;
+    uint8_t mappedSlot = AssetSlots::NO_SLOT;
+    uint32_t generation = 0;
+};
+
+#endif // ASSET_PARTITION_HPP
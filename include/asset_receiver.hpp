@@ -0,0 +1,273 @@
+#ifndef ASSET_RECEIVER_HPP
+#define ASSET_RECEIVER_HPP
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "crc32.hpp"
+#include "protocol.h"
+
+/**
+ * AssetReceiver Class
+ *
+ * Receiving side of the asset upload protocol (see protocol.h): checks
+ * incoming ASSET_BEGIN / ASSET_CHUNK packets, keeps track of the chunks
+ * received and builds the ASSET_ACK and ASSET_STATUS replies.
+ *
+ * The receiver does not store anything itself. A new chunk is handed back
+ * to the caller, which queues it for writing and calls markReceived() once
+ * it has been accepted; a chunk that cannot be queued is simply not marked,
+ * so the sender sends it again. This keeps the receive path free of flash
+ * operations and gives the sender back-pressure from the write queue.
+ *
+ * No hardware dependencies: the same code runs in the ESP-NOW receive
+ * callback and in the host loopback (host/asset_upload_sim).
+ */
+class AssetReceiver {
+public:
+    // Largest pack that can be tracked (240 KB)
+    static constexpr uint16_t MAX_CHUNKS = 1024;
+
+    enum class Result : uint8_t {
+        IGNORED,   // Not for the current transfer, or corrupt: no reply
+        STARTED,   // New transfer: prepare the slot, then send an ack
+        REPEATED,  // Begin of the current transfer again: send an ack or status
+        REJECTED,  // Transfer refused: send the status
+        NEW_CHUNK, // Store the chunk, call markReceived() if it was accepted
+        DUPLICATE, // Chunk already received: send an ack or status
+    };
+
+    /**
+     * Chunk handed to the caller for storing
+     */
+    struct Chunk {
+        uint16_t index;
+        uint32_t offset; // Pack offset of the first byte
+        const uint8_t* data;
+        uint16_t length;
+    };
+
+    AssetReceiver() = default;
+
+    /**
+     * Handle an ASSET_BEGIN packet
+     *
+     * @param packet Packet data
+     * @param len Packet length
+     * @param capacity Largest pack the robot can store (bytes)
+     * @return What to do with the packet
+     */
+    Result begin(const uint8_t* packet, size_t len, size_t capacity) {
+        if (len != sizeof(AssetBegin)) {
+            return Result::IGNORED;
+        }
+        AssetBegin msg;
+        memcpy(&msg, packet, sizeof(msg));
+        if (state.load() != IDLE && msg.transferId == transferId && msg.size == size && msg.crc == crc) {
+            return Result::REPEATED;
+        }
+
+        state.store(IDLE);
+        transferId = msg.transferId;
+        size = msg.size;
+        crc = msg.crc;
+        if (msg.size == 0 || msg.size > capacity || msg.size > (size_t)MAX_CHUNKS * ASSET_CHUNK_SIZE) {
+            chunkCount = 0;
+            status = AssetStatusCode::TOO_LARGE;
+            generation = 0;
+            state.store(FINISHED);
+            return Result::REJECTED;
+        }
+        chunkCount = (uint16_t)((msg.size + ASSET_CHUNK_SIZE - 1) / ASSET_CHUNK_SIZE);
+        memset(received, 0, sizeof(received));
+        base = 0;
+        // Ack at least twice per window, so the sender never waits for a timeout
+        uint8_t half = msg.window / 2;
+        ackInterval = half == 0 ? 1 : (half < ACK_INTERVAL ? half : ACK_INTERVAL);
+        receivedCount = 0;
+        lastIndex = 0xFFFF;
+        chunksSinceAck = 0;
+        state.store(RECEIVING);
+        return Result::STARTED;
+    }
+
+    /**
+     * Drop the current transfer (e.g. when it could not be started)
+     */
+    void cancel() {
+        state.store(IDLE);
+    }
+
+    /**
+     * Handle an ASSET_CHUNK packet
+     * Chunks of a transfer that has ended (activated, failed or rejected)
+     * are all DUPLICATE, so they are answered with its status.
+     *
+     * @param packet Packet data
+     * @param len Packet length
+     * @param chunk Receives the chunk if the result is NEW_CHUNK
+     * @return What to do with the packet
+     */
+    Result chunk(const uint8_t* packet, size_t len, Chunk& chunk) {
+        uint8_t current = state.load();
+        if (len <= sizeof(AssetChunk) || current == IDLE) {
+            return Result::IGNORED;
+        }
+        AssetChunk header;
+        memcpy(&header, packet, sizeof(header));
+        chunk.index = header.index;
+        chunk.offset = (uint32_t)header.index * ASSET_CHUNK_SIZE;
+        chunk.data = packet + sizeof(AssetChunk);
+        chunk.length = (uint16_t)(len - sizeof(AssetChunk));
+        if (chunkCrc(packet, chunk.data, chunk.length) != header.crc || header.transferId != transferId) {
+            return Result::IGNORED;
+        }
+        if (current != RECEIVING) {
+            return Result::DUPLICATE;
+        }
+        if (header.index >= chunkCount || chunk.length != chunkLength(header.index)) {
+            return Result::IGNORED;
+        }
+        if (isReceived(header.index)) {
+            return Result::DUPLICATE;
+        }
+        return Result::NEW_CHUNK;
+    }
+
+    /**
+     * Record a chunk as received (after it has been queued for writing)
+     *
+     * @param index Chunk number
+     * @return true if an ack should be sent now
+     */
+    bool markReceived(uint16_t index) {
+        received[index / 32] |= 1u << (index % 32);
+        receivedCount++;
+        while (base < chunkCount && isReceived(base)) {
+            base++;
+        }
+        // Acknowledge at once when a gap shows up, so the sender can fill it
+        bool outOfOrder = index != (uint16_t)(lastIndex + 1);
+        lastIndex = index;
+        return outOfOrder || ++chunksSinceAck >= ackInterval || isComplete();
+    }
+
+    /**
+     * Check whether every chunk has been received
+     */
+    bool isComplete() const {
+        return state.load() != IDLE && receivedCount == chunkCount;
+    }
+
+    /**
+     * Check whether the current transfer has ended (activated or failed)
+     */
+    bool isFinished() const {
+        return state.load() == FINISHED;
+    }
+
+    /**
+     * Record the outcome of a transfer (from the writer task)
+     *
+     * @param id Transfer that was written; ignored if a new one has started
+     * @param result Outcome
+     * @param activeGeneration Generation of the active pack
+     */
+    void finish(uint16_t id, AssetStatusCode result, uint32_t activeGeneration) {
+        if (id != transferId || state.load() != RECEIVING) {
+            return;
+        }
+        status = result;
+        generation = activeGeneration;
+        state.store(FINISHED);
+    }
+
+    /**
+     * Build the acknowledgement for the current transfer
+     */
+    AssetAck makeAck() {
+        AssetAck ack = {};
+        ack.type = PacketType::ASSET_ACK;
+        ack.transferId = transferId;
+        ack.base = base;
+        for (uint8_t n = 0; n < 32; n++) {
+            uint32_t index = (uint32_t)base + 1 + n;
+            if (index < chunkCount && isReceived((uint16_t)index)) {
+                ack.received |= 1u << n;
+            }
+        }
+        chunksSinceAck = 0;
+        return ack;
+    }
+
+    /**
+     * Build the status of the current transfer (once finished or rejected)
+     */
+    AssetStatus makeStatus() const {
+        AssetStatus msg = {};
+        msg.type = PacketType::ASSET_STATUS;
+        msg.transferId = transferId;
+        msg.status = status;
+        msg.generation = generation;
+        return msg;
+    }
+
+    uint16_t getTransferId() const {
+        return transferId;
+    }
+
+    uint32_t getSize() const {
+        return size;
+    }
+
+    uint32_t getCrc() const {
+        return crc;
+    }
+
+    uint16_t getChunkCount() const {
+        return chunkCount;
+    }
+
+private:
+    static constexpr uint8_t IDLE = 0;
+    static constexpr uint8_t RECEIVING = 1;
+    static constexpr uint8_t FINISHED = 2;
+    // Acknowledge every N in-order chunks
+    static constexpr uint8_t ACK_INTERVAL = 4;
+    // Header bytes covered by the chunk CRC (transferId, index)
+    static constexpr size_t CHUNK_CRC_FIELDS = 4;
+
+    std::atomic<uint8_t> state{IDLE};
+    uint16_t transferId = 0;
+    uint32_t size = 0;
+    uint32_t crc = 0;
+    uint16_t chunkCount = 0;
+    uint32_t received[MAX_CHUNKS / 32] = {};
+    uint16_t receivedCount = 0;
+    // First chunk not yet received
+    uint16_t base = 0;
+    uint16_t lastIndex = 0xFFFF;
+    uint8_t chunksSinceAck = 0;
+    uint8_t ackInterval = ACK_INTERVAL;
+    AssetStatusCode status = AssetStatusCode::ACTIVATED;
+    uint32_t generation = 0;
+
+    /**
+     * CRC of a chunk: transferId and index, then the data
+     */
+    static uint32_t chunkCrc(const uint8_t* packet, const uint8_t* data, uint16_t length) {
+        return crc32(data, length, crc32(packet + offsetof(AssetChunk, transferId), CHUNK_CRC_FIELDS));
+    }
+
+    bool isReceived(uint16_t index) const {
+        return received[index / 32] & (1u << (index % 32));
+    }
+
+    uint16_t chunkLength(uint16_t index) const {
+        uint32_t remaining = size - (uint32_t)index * ASSET_CHUNK_SIZE;
+        return (uint16_t)(remaining < ASSET_CHUNK_SIZE ? remaining : ASSET_CHUNK_SIZE);
+    }
+};
+
+#endif // ASSET_RECEIVER_HPP
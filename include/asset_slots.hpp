@@ -0,0 +1,116 @@
+#ifndef ASSET_SLOTS_HPP
+#define ASSET_SLOTS_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include "crc32.hpp"
+
+/**
+ * AssetSlots Class
+ *
+ * Layout of the "assets" partition as two slots, so a new pack can be
+ * written while the current one stays in use:
+ *
+ *   | slot 0                        | slot 1                        |
+ *   | header sector | pack ...      | header sector | pack ...      |
+ *
+ * A slot header holds a generation number and the pack size. It is erased
+ * before a slot is rewritten and only written after the whole pack has been
+ * stored and checked, so a slot is either complete or ignored; the valid
+ * slot with the newest generation is the active one. An interrupted upload
+ * therefore leaves the previous pack active.
+ *
+ * Works on any Flash type with size(), read(), write() and erase()
+ * (PartitionFlash on the robot, NorFlash on the host); AssetWriter also
+ * needs map() and unmap() to validate a stored pack.
+ */
+class AssetSlots {
+public:
+    static constexpr uint32_t MAGIC = 0x544F4C53; // "SLOT"
+    static constexpr size_t SLOT_COUNT = 2;
+    // Flash erase unit
+    static constexpr size_t SECTOR_SIZE = 4096;
+    // Pack position in the slot (after the header sector)
+    static constexpr size_t PACK_OFFSET = SECTOR_SIZE;
+    // No slot (e.g. nothing mapped)
+    static constexpr uint8_t NO_SLOT = 0xFF;
+
+    struct Header {
+        uint32_t magic;
+        uint32_t generation; // Incremented for every activated pack
+        uint32_t size;       // Pack size in bytes
+        uint32_t crc;        // CRC-32 of the fields above
+    };
+
+    static_assert(sizeof(Header) == 16, "Slot header must match the flash layout");
+
+    /**
+     * Size of one slot (whole sectors)
+     */
+    static constexpr size_t slotSize(size_t partitionSize) {
+        return partitionSize / SLOT_COUNT / SECTOR_SIZE * SECTOR_SIZE;
+    }
+
+    /**
+     * Largest pack a slot can hold
+     */
+    static constexpr size_t capacity(size_t partitionSize) {
+        return slotSize(partitionSize) > PACK_OFFSET ? slotSize(partitionSize) - PACK_OFFSET : 0;
+    }
+
+    /**
+     * Partition offset of a slot's pack
+     */
+    static constexpr size_t packOffset(size_t partitionSize, uint8_t slot) {
+        return slot * slotSize(partitionSize) + PACK_OFFSET;
+    }
+
+    /**
+     * Build a slot header
+     */
+    static Header makeHeader(uint32_t generation, uint32_t size) {
+        Header header = {MAGIC, generation, size, 0};
+        header.crc = crc32((const uint8_t*)&header, offsetof(Header, crc));
+        return header;
+    }
+
+    /**
+     * Read both slot headers and order the valid slots, newest first
+     *
+     * @param flash Partition to read
+     * @param headers Receive the slot headers
+     * @param order Receive the valid slots, newest first
+     * @return Number of valid slots
+     */
+    template <typename Flash>
+    static uint8_t scan(Flash& flash, Header headers[SLOT_COUNT], uint8_t order[SLOT_COUNT]) {
+        uint8_t count = 0;
+        for (uint8_t slot = 0; slot < SLOT_COUNT; slot++) {
+            if (!flash.read(slot * slotSize(flash.size()), &headers[slot], sizeof(Header)) ||
+                !isValid(headers[slot], flash.size())) {
+                continue;
+            }
+            // Insert after all newer slots
+            uint8_t pos = count++;
+            while (pos > 0 && isNewer(headers[slot], headers[order[pos - 1]])) {
+                order[pos] = order[pos - 1];
+                pos--;
+            }
+            order[pos] = slot;
+        }
+        return count;
+    }
+
+private:
+    static bool isValid(const Header& header, size_t partitionSize) {
+        return header.magic == MAGIC && header.size <= capacity(partitionSize) &&
+               header.crc == crc32((const uint8_t*)&header, offsetof(Header, crc));
+    }
+
+    // Serial number comparison, so the generation may wrap around
+    static bool isNewer(const Header& a, const Header& b) {
+        return (int32_t)(a.generation - b.generation) > 0;
+    }
+};
+
+#endif // ASSET_SLOTS_HPP
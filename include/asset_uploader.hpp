@@ -0,0 +1,277 @@
+#ifndef ASSET_UPLOADER_HPP
+#define ASSET_UPLOADER_HPP
+
+#include <Arduino.h>
+#include <atomic>
+#include "asset_partition.hpp"
+#include "asset_receiver.hpp"
+#include "asset_writer.hpp"
+#include "handoff.hpp"
+#include "protocol.h"
+#include "uplink.hpp"
+
+/**
+ * AssetUploader Class
+ *
+ * Receives asset packs over ESP-NOW (see protocol.h) and writes them into
+ * the free slot of the assets partition.
+ *
+ * The receive callback only checks packets (AssetReceiver) and copies new
+ * chunks into a queue; a low-priority task drains the queue and does all
+ * flash erasing and writing (AssetWriter), so direction commands are
+ * handled as before while an upload runs. The receiver is only touched by
+ * the receive callback: the write task reports each outcome directly to
+ * the controller and hands it back to the receiver through a Handoff. When the queue is full, chunks
+ * are dropped without an acknowledgement and the controller sends them
+ * again, which paces the upload to the flash write speed.
+ *
+ * A completed pack is activated by writing its slot header; the running
+ * animations switch over when the main loop calls takeActivation() and
+ * remaps the partition. A failed or interrupted upload leaves the current
+ * pack in use. The main loop reports the mapped slot with setMappedSlot(),
+ * and the next upload waits for that after an activation, so the slot the
+ * animations are reading is never erased.
+ */
+class AssetUploader {
+public:
+    explicit AssetUploader(Uplink& uplink) : uplink(uplink), writer(flash) {}
+
+    /**
+     * Start the flash write task
+     *
+     * @return true if initialization successful, false otherwise
+     */
+    bool begin() {
+        if (!flash.begin()) {
+            return false;
+        }
+        capacity = AssetSlots::capacity(flash.size());
+        queue = xQueueCreate(QUEUE_DEPTH, sizeof(Job));
+        if (!queue) {
+            return false;
+        }
+        return xTaskCreate(&AssetUploader::taskEntry, "assets", TASK_STACK_SIZE, this, TASK_PRIORITY,
+                           &task) == pdPASS;
+    }
+
+    /**
+     * Handle an asset upload packet (from the ESP-NOW receive callback)
+     * Never waits: replies are queued with esp_now_send.
+     *
+     * @param data Packet data (starting with the PacketType)
+     * @param len Packet length
+     */
+    void handle(const uint8_t* data, int len) {
+        if (!queue || len < 1) {
+            return;
+        }
+        Outcome outcome;
+        while (outcomes.pop(outcome)) {
+            receiver.finish(outcome.transferId, outcome.status, outcome.generation);
+        }
+        switch ((PacketType)data[0]) {
+        case PacketType::ASSET_BEGIN:
+            handleBegin(data, len);
+            break;
+        case PacketType::ASSET_CHUNK:
+            handleChunk(data, len);
+            break;
+        default:
+            break;
+        }
+    }
+
+    /**
+     * Check for a newly activated pack (clears the flag)
+     *
+     * @return true if the partition should be remapped
+     */
+    bool takeActivation() {
+        return activated.exchange(false);
+    }
+
+    /**
+     * Set the slot the animations are read from (from the main loop, after
+     * mapping the partition)
+     *
+     * @param slot Mapped slot, or AssetSlots::NO_SLOT
+     */
+    void setMappedSlot(uint8_t slot) {
+        mappedSlot.store(slot);
+    }
+
+private:
+    // Chunks buffered between the receive callback and the write task (~4 KB)
+    static constexpr UBaseType_t QUEUE_DEPTH = 16;
+    static constexpr uint32_t TASK_STACK_SIZE = 3072;
+    static constexpr UBaseType_t TASK_PRIORITY = 1;
+
+    static constexpr uint8_t JOB_START = 0;
+    static constexpr uint8_t JOB_CHUNK = 1;
+    // mappedSlot while the main loop has yet to remap an activated pack
+    static constexpr uint8_t REMAP_PENDING = 0xFE;
+    static constexpr uint32_t REMAP_POLL_MS = 5;
+
+    /**
+     * Work item for the write task
+     */
+    struct Job {
+        uint8_t kind;        // JOB_START or JOB_CHUNK
+        uint16_t transferId;
+        uint16_t length;     // Chunk length
+        uint32_t offset;     // Chunk: pack offset; start: pack size
+        uint32_t crc;        // Start: pack CRC
+        uint8_t data[ASSET_CHUNK_SIZE];
+    };
+
+    /**
+     * Result of a written transfer, for the receiver
+     */
+    struct Outcome {
+        uint16_t transferId;
+        AssetStatusCode status;
+        uint32_t generation; // Generation of the active pack
+    };
+
+    Uplink& uplink;
+    PartitionFlash flash{ASSET_PARTITION_SUBTYPE, ASSET_PARTITION_LABEL};
+    AssetWriter<PartitionFlash> writer;
+    AssetReceiver receiver;
+    size_t capacity = 0;
+    QueueHandle_t queue = nullptr;
+    TaskHandle_t task = nullptr;
+    Handoff<Outcome, 4> outcomes;
+    std::atomic<bool> activated{false};
+    std::atomic<uint8_t> mappedSlot{AssetSlots::NO_SLOT};
+    // Write task state
+    uint16_t writingId = 0;
+    uint16_t chunksLeft = 0;
+
+    void handleBegin(const uint8_t* data, int len) {
+        switch (receiver.begin(data, len, capacity)) {
+        case AssetReceiver::Result::STARTED: {
+            Job job = {};
+            job.kind = JOB_START;
+            job.transferId = receiver.getTransferId();
+            job.offset = receiver.getSize();
+            job.crc = receiver.getCrc();
+            if (xQueueSend(queue, &job, 0) != pdTRUE) {
+                // Not started: the controller repeats the begin packet
+                receiver.cancel();
+                return;
+            }
+            Serial.printf("Asset upload %u: %lu bytes\n", job.transferId, (unsigned long)job.offset);
+            sendAck();
+            break;
+        }
+        case AssetReceiver::Result::REPEATED:
+            sendReply();
+            break;
+        case AssetReceiver::Result::REJECTED:
+            sendStatus();
+            break;
+        default:
+            break;
+        }
+    }
+
+    void handleChunk(const uint8_t* data, int len) {
+        AssetReceiver::Chunk chunk;
+        switch (receiver.chunk(data, len, chunk)) {
+        case AssetReceiver::Result::NEW_CHUNK: {
+            Job job;
+            job.kind = JOB_CHUNK;
+            job.transferId = receiver.getTransferId();
+            job.length = chunk.length;
+            job.offset = chunk.offset;
+            memcpy(job.data, chunk.data, chunk.length);
+            if (xQueueSend(queue, &job, 0) == pdTRUE && receiver.markReceived(chunk.index)) {
+                sendAck();
+            }
+            break;
+        }
+        case AssetReceiver::Result::DUPLICATE:
+            sendReply();
+            break;
+        default:
+            break;
+        }
+    }
+
+    // Ack while receiving, status once the transfer has ended
+    void sendReply() {
+        if (receiver.isFinished()) {
+            sendStatus();
+        } else {
+            sendAck();
+        }
+    }
+
+    void sendAck() {
+        AssetAck ack = receiver.makeAck();
+        uplink.send(&ack, sizeof(ack));
+    }
+
+    void sendStatus() {
+        AssetStatus status = receiver.makeStatus();
+        uplink.send(&status, sizeof(status));
+    }
+
+    static void taskEntry(void* arg) {
+        static_cast<AssetUploader*>(arg)->run();
+    }
+
+    /**
+     * Write task: erases and writes flash in queue order
+     */
+    void run() {
+        Job job;
+        while (true) {
+            if (xQueueReceive(queue, &job, portMAX_DELAY) != pdTRUE) {
+                continue;
+            }
+            if (job.kind == JOB_START) {
+                // The slot to keep is only known once the last pack is mapped
+                while (mappedSlot.load() == REMAP_PENDING) {
+                    vTaskDelay(pdMS_TO_TICKS(REMAP_POLL_MS));
+                }
+                writingId = job.transferId;
+                chunksLeft = (uint16_t)((job.offset + ASSET_CHUNK_SIZE - 1) / ASSET_CHUNK_SIZE);
+                writer.start(job.offset, job.crc, mappedSlot.load());
+                continue;
+            }
+            // Chunks of a transfer that has been replaced are dropped
+            if (job.transferId != writingId || chunksLeft == 0) {
+                continue;
+            }
+            writer.write(job.offset, job.data, job.length);
+            if (--chunksLeft == 0) {
+                complete();
+            }
+        }
+    }
+
+    /**
+     * All chunks written: verify, activate and report
+     */
+    void complete() {
+        AssetStatusCode status = writer.finish();
+        uint32_t generation = writer.getGeneration();
+        if (status == AssetStatusCode::ACTIVATED) {
+            mappedSlot.store(REMAP_PENDING);
+            activated.store(true);
+        } else {
+            generation--;
+        }
+        Serial.printf("Asset upload %u: status %u\n", writingId, (unsigned)status);
+        outcomes.push({writingId, status, generation});
+        AssetStatus reply = {};
+        reply.type = PacketType::ASSET_STATUS;
+        reply.transferId = writingId;
+        reply.status = status;
+        reply.generation = generation;
+        uplink.send(&reply, sizeof(reply));
+    }
+};
+
+#endif // ASSET_UPLOADER_HPP
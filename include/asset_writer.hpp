@@ -0,0 +1,158 @@
+#ifndef ASSET_WRITER_HPP
+#define ASSET_WRITER_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "asset_pack.hpp"
+#include "asset_slots.hpp"
+#include "crc32.hpp"
+#include "protocol.h"
+
+/**
+ * AssetWriter Class
+ *
+ * Writes an uploaded asset pack into the inactive slot of the assets
+ * partition (see AssetSlots) and activates it:
+ * - start() picks the slot the animations are not reading and erases its
+ *   header sector, so the slot is invalid until the upload has been completed
+ * - write() stores chunks in any order, erasing each sector on first use
+ * - finish() reads the pack back, checks its CRC, validates it as
+ *   AssetPartition will (AssetPack::open) and writes the slot header with
+ *   the next generation, which makes it the active pack
+ *
+ * Flash operations block for milliseconds (a sector erase takes ~45 ms), so
+ * this runs in the asset upload task, never in the receive callback.
+ *
+ * @tparam Flash Partition access (size(), read(), write(), erase(), map(), unmap())
+ */
+template <typename Flash>
+class AssetWriter {
+public:
+    explicit AssetWriter(Flash& flash) : flash(flash) {}
+
+    /**
+     * Prepare the inactive slot for a new pack
+     *
+     * The newest slot is not always the one in use: if its pack is invalid,
+     * AssetPartition falls back to the older one, which must then be kept.
+     *
+     * @param packSize Pack size in bytes
+     * @param packCrc CRC-32 of the whole pack
+     * @param mappedSlot Slot mapped by AssetPartition, or AssetSlots::NO_SLOT
+     * @return false if the slot could not be erased
+     */
+    bool start(uint32_t packSize, uint32_t packCrc, uint8_t mappedSlot) {
+        AssetSlots::Header headers[AssetSlots::SLOT_COUNT];
+        uint8_t order[AssetSlots::SLOT_COUNT];
+        uint8_t count = AssetSlots::scan(flash, headers, order);
+        generation = count > 0 ? headers[order[0]].generation + 1 : 1;
+        if (mappedSlot < AssetSlots::SLOT_COUNT) {
+            slot = (uint8_t)(1 - mappedSlot);
+        } else {
+            slot = count > 0 ? (uint8_t)(1 - order[0]) : 0;
+        }
+        size = packSize;
+        crc = packCrc;
+        memset(erased, 0, sizeof(erased));
+        failed = packSize > AssetSlots::capacity(flash.size()) || packSize > MAX_SECTORS * AssetSlots::SECTOR_SIZE ||
+                 !flash.erase(slot * AssetSlots::slotSize(flash.size()), AssetSlots::SECTOR_SIZE);
+        return !failed;
+    }
+
+    /**
+     * Store one chunk
+     *
+     * @param offset Pack offset of the chunk
+     * @param data Chunk data
+     * @param length Chunk length
+     * @return false if a flash operation failed
+     */
+    bool write(uint32_t offset, const uint8_t* data, uint16_t length) {
+        if (failed || offset + length > size) {
+            return false;
+        }
+        size_t packStart = AssetSlots::packOffset(flash.size(), slot);
+        for (uint32_t sector = offset / AssetSlots::SECTOR_SIZE;
+             sector <= (offset + length - 1) / AssetSlots::SECTOR_SIZE; sector++) {
+            if (erased[sector / 32] & (1u << (sector % 32))) {
+                continue;
+            }
+            if (!flash.erase(packStart + sector * AssetSlots::SECTOR_SIZE, AssetSlots::SECTOR_SIZE)) {
+                failed = true;
+                return false;
+            }
+            erased[sector / 32] |= 1u << (sector % 32);
+        }
+        if (!flash.write(packStart + offset, data, length)) {
+            failed = true;
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Verify the stored pack and activate it
+     *
+     * @return ACTIVATED, or the reason the pack was not activated
+     */
+    AssetStatusCode finish() {
+        if (failed) {
+            return AssetStatusCode::FLASH_ERROR;
+        }
+        // Read back what is actually in flash
+        size_t packStart = AssetSlots::packOffset(flash.size(), slot);
+        uint8_t block[VERIFY_BLOCK];
+        uint32_t check = 0;
+        for (uint32_t offset = 0; offset < size; offset += VERIFY_BLOCK) {
+            uint32_t length = size - offset < VERIFY_BLOCK ? size - offset : VERIFY_BLOCK;
+            if (!flash.read(packStart + offset, block, length)) {
+                return AssetStatusCode::FLASH_ERROR;
+            }
+            check = crc32(block, length, check);
+        }
+        if (check != crc) {
+            return AssetStatusCode::CRC_MISMATCH;
+        }
+        // A pack AssetPartition would reject must not replace the current one
+        const void* mapped = flash.map(packStart, size);
+        if (!mapped) {
+            return AssetStatusCode::FLASH_ERROR;
+        }
+        AssetPack pack;
+        bool valid = pack.open(mapped, size);
+        flash.unmap();
+        if (!valid) {
+            return AssetStatusCode::INVALID_PACK;
+        }
+
+        AssetSlots::Header header = AssetSlots::makeHeader(generation, size);
+        if (!flash.write(slot * AssetSlots::slotSize(flash.size()), &header, sizeof(header))) {
+            return AssetStatusCode::FLASH_ERROR;
+        }
+        return AssetStatusCode::ACTIVATED;
+    }
+
+    /**
+     * Generation the pack gets when activated
+     */
+    uint32_t getGeneration() const {
+        return generation;
+    }
+
+private:
+    // Largest slot that can be tracked (1 MB)
+    static constexpr size_t MAX_SECTORS = 256;
+    static constexpr size_t VERIFY_BLOCK = 256;
+
+    Flash& flash;
+    uint8_t slot = 0;
+    uint32_t generation = 0;
+    uint32_t size = 0;
+    uint32_t crc = 0;
+    bool failed = false;
+    // Pack sectors erased since start()
+    uint32_t erased[MAX_SECTORS / 32] = {};
+};
+
+#endif // ASSET_WRITER_HPP
@@ -0,0 +1,159 @@
+#ifndef BATTERY_MONITOR_HPP
+#define BATTERY_MONITOR_HPP
+
+#include <Arduino.h>
+#include "led_display.hpp"
+#include "motor_controller.hpp"
+#include "power_governor.hpp"
+#include "protocol.h"
+#include "uplink.hpp"
+
+/**
+ * BatteryMonitor Class
+ *
+ * Samples the battery pack voltage with the ADC in continuous (DMA) mode and
+ * applies PowerGovernor limits to the LED panel and the motors.
+ *
+ * The ADC hardware converts samples into a DMA buffer without CPU
+ * involvement; when a block is complete, the conversion-done interrupt wakes
+ * a low-priority task, which reads the block (averaged in software by the
+ * Arduino continuous-ADC driver), filters the value and pushes new limits
+ * only when the power level changes. Nothing runs in the frame loop.
+ *
+ * Battery Sense Connection:
+ * VBAT -> 100k -> GPIO5 (MTDI pad) -> 100k -> GND
+ */
+class BatteryMonitor {
+public:
+    BatteryMonitor(RobotLedDisplay& display, MotorController& motors, Uplink& uplink)
+        : display(display), motors(motors), uplink(uplink) {}
+
+    /**
+     * Start continuous sampling and the governor task
+     *
+     * The ADC is configured before the task is created, and the task is
+     * deleted again if sampling cannot start, so a failure leaves nothing
+     * running.
+     *
+     * @return true if initialization successful, false otherwise
+     */
+    bool begin() {
+        instance = this;
+        const uint8_t pins[] = {BATTERY_SENSE};
+        analogContinuousSetAtten(ADC_11db);
+        if (!analogContinuous(pins, 1, CONVERSIONS_PER_READ, SAMPLE_RATE_HZ, &onConversionDone)) {
+            return false;
+        }
+
+        // The conversion-done interrupt needs the task, so start sampling last
+        if (xTaskCreate(&BatteryMonitor::taskEntry, "battery", TASK_STACK_SIZE, this,
+                        TASK_PRIORITY, &task) != pdPASS) {
+            task = nullptr;
+            analogContinuousDeinit();
+            return false;
+        }
+        if (!analogContinuousStart()) {
+            vTaskDelete(task);
+            task = nullptr;
+            analogContinuousDeinit();
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Get the filtered pack voltage
+     *
+     * @return Pack voltage (mV)
+     */
+    uint16_t getMillivolts() const {
+        return governor.getMillivolts();
+    }
+
+    /**
+     * Get the estimated state of charge
+     *
+     * @return State of charge (0-100 %)
+     */
+    uint8_t getStateOfCharge() const {
+        return governor.getStateOfCharge();
+    }
+
+private:
+    // Battery sense input (ADC1 channel 5)
+    static constexpr uint8_t BATTERY_SENSE = 5;
+    // Pack voltage = pin voltage x 2 (100k/100k divider)
+    static constexpr uint8_t DIVIDER_RATIO = 2;
+    // 1 kHz sampling, 64 conversions averaged per read = ~16 readings per second
+    static constexpr uint32_t SAMPLE_RATE_HZ = 1000;
+    static constexpr uint32_t CONVERSIONS_PER_READ = 64;
+    // Send a battery report every N readings (~4 seconds)
+    static constexpr uint8_t REPORT_INTERVAL = 64;
+    static constexpr uint32_t TASK_STACK_SIZE = 3072;
+    static constexpr UBaseType_t TASK_PRIORITY = 1;
+
+    static inline BatteryMonitor* instance = nullptr;
+
+    RobotLedDisplay& display;
+    MotorController& motors;
+    Uplink& uplink;
+    PowerGovernor governor;
+    TaskHandle_t task = nullptr;
+    uint8_t readingsSinceReport = 0;
+    uint8_t sequence = 0;
+
+    /**
+     * ADC conversion-done interrupt: wake the governor task
+     */
+    static void ARDUINO_ISR_ATTR onConversionDone() {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(instance->task, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+
+    static void taskEntry(void* arg) {
+        static_cast<BatteryMonitor*>(arg)->run();
+    }
+
+    /**
+     * Governor task: runs once per completed ADC block
+     */
+    void run() {
+        while (true) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+            adc_continuous_data_t* result = nullptr;
+            if (!analogContinuousRead(&result, 0)) {
+                continue;
+            }
+
+            auto millivolts = (uint16_t)(result[0].avg_read_mvolts * DIVIDER_RATIO);
+            if (governor.update(millivolts)) {
+                auto limits = governor.getLimits();
+                display.setBrightnessLimit(limits.ledScale);
+                motors.setDutyLimit(limits.motorScale);
+                Serial.printf("Battery %u mV: power level %u\n", governor.getMillivolts(), governor.getLevel());
+            }
+
+            if (++readingsSinceReport >= REPORT_INTERVAL) {
+                readingsSinceReport = 0;
+                sendReport();
+            }
+        }
+    }
+
+    /**
+     * Send voltage and state of charge to the controller
+     */
+    void sendReport() {
+        BatteryReport report = {};
+        report.type = PacketType::BATTERY_REPORT;
+        report.sequence = sequence++;
+        report.millivolts = governor.getMillivolts();
+        report.stateOfCharge = governor.getStateOfCharge();
+        report.powerLevel = governor.getLevel();
+        uplink.send(&report, sizeof(report));
+    }
+};
+
+#endif // BATTERY_MONITOR_HPP
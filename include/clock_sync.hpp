@@ -0,0 +1,194 @@
+#ifndef CLOCK_SYNC_HPP
+#define CLOCK_SYNC_HPP
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * ClockSync Class
+ *
+ * Estimates the fleet clock from TIME_BEACON packets: the offset between
+ * the beacon source's clock and the local clock, and how fast the two
+ * drift apart (crystal tolerance, tens of ppm).
+ *
+ * A beacon is received some time after it was stamped, so each sample
+ * understates the offset by its delay. Within every WINDOW_US only the
+ * sample with the largest offset (the least delayed one) is kept; a line
+ * fitted through the last POINT_COUNT of those gives the drift, and the
+ * offset at the mean of the points. The first beacon sets the offset
+ * directly, so the clock is usable at once and refines over a few seconds.
+ * Between beacons (and if they stop) the fleet time is extrapolated with
+ * the estimated drift.
+ *
+ * Samples far from the estimate are ignored, unless OUTLIER_LIMIT come in
+ * a row (the source restarted): then the estimate starts over.
+ *
+ * No floating point outside the fit, which runs once per window; all
+ * times are microseconds. Not thread safe: FleetClock feeds it from the
+ * main loop.
+ */
+class ClockSync {
+public:
+    static constexpr uint32_t WINDOW_US = 1000000;
+
+    ClockSync() = default;
+
+    /**
+     * Use the local clock as the fleet clock (on the beacon source)
+     */
+    void setReference() {
+        reference = true;
+        locked = true;
+        offsetUs = 0;
+        driftPpb = 0;
+        referenceLocalUs = 0;
+    }
+
+    /**
+     * Add a received beacon
+     *
+     * @param sourceUs Fleet time in the beacon
+     * @param localUs Local time the beacon was received
+     * @return true if the estimate started over (fleet time stepped)
+     */
+    bool addSample(uint64_t sourceUs, uint64_t localUs) {
+        if (reference) {
+            return false;
+        }
+        int64_t offset = (int64_t)(sourceUs - localUs);
+        if (locked && llabs(offset - offsetAt(localUs)) > STEP_US) {
+            if (++outliers < OUTLIER_LIMIT) {
+                return false;
+            }
+        } else if (locked) {
+            outliers = 0;
+            if (localUs - windowStartUs >= WINDOW_US) {
+                closeWindow();
+                windowStartUs = localUs;
+                windowSamples = 0;
+            }
+            if (windowSamples == 0 || offset > windowOffsetUs) {
+                windowOffsetUs = offset;
+                windowLocalUs = localUs;
+            }
+            windowSamples++;
+            return false;
+        }
+        // First beacon, or the source restarted
+        locked = true;
+        outliers = 0;
+        pointCount = 0;
+        offsetUs = offset;
+        driftPpb = 0;
+        referenceLocalUs = localUs;
+        windowStartUs = localUs;
+        windowOffsetUs = offset;
+        windowLocalUs = localUs;
+        windowSamples = 1;
+        return true;
+    }
+
+    /**
+     * Check whether a fleet time is known (a beacon was received, or this is the source)
+     */
+    bool isLocked() const {
+        return locked;
+    }
+
+    /**
+     * Convert local time to fleet time (local time when not locked)
+     */
+    uint64_t toFleet(uint64_t localUs) const {
+        return localUs + offsetAt(localUs);
+    }
+
+    /**
+     * Convert fleet time to local time
+     */
+    uint64_t toLocal(uint64_t fleetUs) const {
+        return fleetUs - offsetAt(fleetUs - offsetUs);
+    }
+
+    /**
+     * Get the estimated drift of the fleet clock against the local clock
+     *
+     * @return Drift (parts per billion, positive: fleet clock runs faster)
+     */
+    int32_t getDriftPpb() const {
+        return driftPpb;
+    }
+
+private:
+    // Least-delayed samples used for the fit (one per window)
+    static constexpr uint8_t POINT_COUNT = 8;
+    // Samples further from the estimate are outliers (or a restarted source)
+    static constexpr int64_t STEP_US = 50000;
+    static constexpr uint8_t OUTLIER_LIMIT = 3;
+    // Larger drifts are not crystals, but bad fits
+    static constexpr int32_t MAX_DRIFT_PPB = 200000;
+
+    bool reference = false;
+    bool locked = false;
+    uint8_t outliers = 0;
+    // Estimate: offset at a local reference time, and drift from there
+    int64_t offsetUs = 0;
+    int32_t driftPpb = 0;
+    uint64_t referenceLocalUs = 0;
+    // Current window: start and its least-delayed sample
+    uint64_t windowStartUs = 0;
+    int64_t windowOffsetUs = 0;
+    uint64_t windowLocalUs = 0;
+    uint16_t windowSamples = 0;
+    // Fit points, oldest first
+    uint64_t pointLocalUs[POINT_COUNT];
+    int64_t pointOffsetUs[POINT_COUNT];
+    uint8_t pointCount = 0;
+
+    int64_t offsetAt(uint64_t localUs) const {
+        return offsetUs + (int64_t)(localUs - referenceLocalUs) * driftPpb / 1000000000;
+    }
+
+    /**
+     * Add the window's least-delayed sample as a fit point and refit
+     */
+    void closeWindow() {
+        if (pointCount == POINT_COUNT) {
+            for (uint8_t i = 1; i < POINT_COUNT; i++) {
+                pointLocalUs[i - 1] = pointLocalUs[i];
+                pointOffsetUs[i - 1] = pointOffsetUs[i];
+            }
+            pointCount--;
+        }
+        pointLocalUs[pointCount] = windowLocalUs;
+        pointOffsetUs[pointCount] = windowOffsetUs;
+        pointCount++;
+
+        // Least squares, relative to the newest point
+        uint64_t baseLocal = pointLocalUs[pointCount - 1];
+        int64_t baseOffset = pointOffsetUs[pointCount - 1];
+        float meanX = 0;
+        float meanY = 0;
+        for (uint8_t i = 0; i < pointCount; i++) {
+            meanX += (float)(int64_t)(pointLocalUs[i] - baseLocal);
+            meanY += (float)(pointOffsetUs[i] - baseOffset);
+        }
+        meanX /= pointCount;
+        meanY /= pointCount;
+        if (pointCount >= 2) {
+            float sumXY = 0;
+            float sumXX = 0;
+            for (uint8_t i = 0; i < pointCount; i++) {
+                float x = (float)(int64_t)(pointLocalUs[i] - baseLocal) - meanX;
+                float y = (float)(pointOffsetUs[i] - baseOffset) - meanY;
+                sumXY += x * y;
+                sumXX += x * x;
+            }
+            float slope = sumXX > 0 ? sumXY / sumXX * 1e9f : 0;
+            driftPpb = (int32_t)(slope > MAX_DRIFT_PPB ? MAX_DRIFT_PPB : slope < -MAX_DRIFT_PPB ? -MAX_DRIFT_PPB : slope);
+        }
+        referenceLocalUs = baseLocal + (int64_t)meanX;
+        offsetUs = baseOffset + (int64_t)meanY;
+    }
+};
+
+#endif // CLOCK_SYNC_HPP
@@ -3,6 +3,55 @@
 
 #include <Arduino.h>
 
+/**
+ * Feature Flags
+ * Override from platformio.ini build_flags (e.g. -DWHEEL_ENCODERS_ENABLED=1)
+ */
+// Closed-loop track speed control using wheel encoders on D8/D9
+#ifndef WHEEL_ENCODERS_ENABLED
+#define WHEEL_ENCODERS_ENABLED 0
+#endif
+// Battery voltage monitoring and power governor (divider on GPIO5)
+#ifndef BATTERY_MONITOR_ENABLED
+#define BATTERY_MONITOR_ENABLED 0
+#endif
+// Non-blocking LED output through RMT (0 = FastLED.show())
+#ifndef LED_ASYNC_OUTPUT_ENABLED
+#define LED_ASYNC_OUTPUT_ENABLED 1
+#endif
+// Animations from the "assets" flash partition instead of the app image
+#ifndef ASSET_PARTITION_ENABLED
+#define ASSET_PARTITION_ENABLED 0
+#endif
+// Trace of received commands in the "trace" flash partition
+#ifndef TRACE_RECORDER_ENABLED
+#define TRACE_RECORDER_ENABLED 0
+#endif
+// Fleet clock from TIME_BEACON packets: animations in phase, MOVE_AT commands
+#ifndef CLOCK_SYNC_ENABLED
+#define CLOCK_SYNC_ENABLED 0
+#endif
+// This robot broadcasts the fleet time (one per fleet; needs CLOCK_SYNC_ENABLED)
+#ifndef CLOCK_SYNC_SOURCE
+#define CLOCK_SYNC_SOURCE 0
+#endif
+// Robot ID and groups in NVS; FLEET_COMMAND packets address robots by them
+#ifndef FLEET_ADDRESSING_ENABLED
+#define FLEET_ADDRESSING_ENABLED 0
+#endif
+// One controller at a time: control leases, priorities and takeover
+#ifndef CONTROL_ARBITER_ENABLED
+#define CONTROL_ARBITER_ENABLED 0
+#endif
+// State samples sent to the controller (TELEMETRY packets)
+#ifndef TELEMETRY_ENABLED
+#define TELEMETRY_ENABLED 0
+#endif
+// Telemetry samples per second (1-100; batched above 10)
+#ifndef TELEMETRY_RATE_HZ
+#define TELEMETRY_RATE_HZ 10
+#endif
+
 /**
  * Direction Constants
  * Using enum class for type safety and namespace isolation
@@ -0,0 +1,204 @@
+#ifndef CONTROL_ARBITER_HPP
+#define CONTROL_ARBITER_HPP
+
+#include <atomic>
+#include <esp_now.h>
+#include <esp_timer.h>
+#include <string.h>
+#include "handoff.hpp"
+#include "protocol.h"
+#include "uplink.hpp"
+
+/**
+ * ControlArbiter Class
+ *
+ * Decides which controller the robot listens to when several are in range
+ * (see "Control Arbitration" in protocol.h). Every received packet goes
+ * through admit() first thing in the receive callback, so packets from
+ * other controllers are counted and dropped before any motor, animation
+ * or trace work.
+ *
+ * Senders are kept in a fixed table of MAX_SENDERS entries looked up by
+ * MAC address; when it is full, the sender heard from least recently
+ * (never the owner) is replaced. Replies are queued for the main loop,
+ * which broadcasts them with update().
+ */
+class ControlArbiter {
+public:
+    /**
+     * Packet counts since start
+     */
+    struct Stats {
+        uint32_t accepted;  // Packets from the owner (or taking free control)
+        uint32_t rejected;  // Packets and claims from other controllers
+        uint32_t takeovers; // Claims that took control from another owner
+    };
+
+    ControlArbiter() = default;
+
+    /**
+     * Register the broadcast peer for replies
+     *
+     * @return true if initialization successful, false otherwise
+     */
+    bool begin() {
+        return Uplink::addBroadcastPeer();
+    }
+
+    /**
+     * Check a received packet (from the receive callback, before handling it)
+     * Claims and releases are handled here and never admitted, nor are other
+     * robots' replies.
+     *
+     * @param mac Sender MAC address
+     * @param data Packet data
+     * @param len Packet length
+     * @return true if the packet comes from the controller in charge
+     */
+    bool admit(const uint8_t* mac, const uint8_t* data, int len) {
+        if (len > 1 && data[0] == (uint8_t)PacketType::CONTROL_REPLY) {
+            // Another robot answering its controller
+            return false;
+        }
+        uint64_t nowUs = (uint64_t)esp_timer_get_time();
+        int8_t index = lookup(mac, nowUs);
+        if (len > 1 && data[0] == (uint8_t)PacketType::CONTROL_CLAIM) {
+            claim(index, data, len, nowUs);
+            return false;
+        }
+        if (len > 1 && data[0] == (uint8_t)PacketType::CONTROL_RELEASE) {
+            if (index == owner) {
+                owner = NO_OWNER;
+                queueReply(index, ControlStatus::RELEASED, 0);
+            }
+            return false;
+        }
+        if (index != owner && leaseActive(nowUs)) {
+            senders[index].rejected++;
+            rejected.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (index != owner) {
+            // Free control: the first controller to send takes it
+            owner = index;
+            ownerPriority = 0;
+            leaseUs = CONTROL_LEASE_DEFAULT_MS * 1000ULL;
+        }
+        leaseEndUs = nowUs + leaseUs;
+        accepted.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * Broadcast queued replies (from the main loop)
+     */
+    void update() {
+        ControlReply reply;
+        while (replies.pop(reply)) {
+            esp_now_send(ESPNOW_BROADCAST_MAC, (const uint8_t*)&reply, sizeof(reply));
+        }
+    }
+
+    /**
+     * Get the packet counts
+     */
+    Stats getStats() const {
+        return {accepted.load(std::memory_order_relaxed), rejected.load(std::memory_order_relaxed),
+                takeovers.load(std::memory_order_relaxed)};
+    }
+
+private:
+    static constexpr uint8_t MAX_SENDERS = 8;
+    static constexpr int8_t NO_OWNER = -1;
+
+    struct Sender {
+        uint8_t mac[ESP_NOW_ETH_ALEN];
+        uint64_t lastSeenUs;
+        uint32_t rejected;
+        bool used;
+    };
+
+    // Receive callback only
+    Sender senders[MAX_SENDERS] = {};
+    int8_t owner = NO_OWNER;
+    uint8_t ownerPriority = 0;
+    uint64_t leaseUs = 0;
+    uint64_t leaseEndUs = 0;
+
+    Handoff<ControlReply, 8> replies;
+    std::atomic<uint32_t> accepted{0};
+    std::atomic<uint32_t> rejected{0};
+    std::atomic<uint32_t> takeovers{0};
+
+    bool leaseActive(uint64_t nowUs) const {
+        return owner != NO_OWNER && nowUs < leaseEndUs;
+    }
+
+    /**
+     * Find a sender, or add it in place of the least recently heard one
+     *
+     * @return Table index
+     */
+    int8_t lookup(const uint8_t* mac, uint64_t nowUs) {
+        int8_t oldest = NO_OWNER;
+        for (int8_t i = 0; i < MAX_SENDERS; i++) {
+            if (senders[i].used && memcmp(senders[i].mac, mac, ESP_NOW_ETH_ALEN) == 0) {
+                senders[i].lastSeenUs = nowUs;
+                return i;
+            }
+            if (i != owner && (oldest == NO_OWNER || !senders[i].used ||
+                               (senders[oldest].used && senders[i].lastSeenUs < senders[oldest].lastSeenUs))) {
+                oldest = i;
+            }
+        }
+        Sender& sender = senders[oldest];
+        memcpy(sender.mac, mac, ESP_NOW_ETH_ALEN);
+        sender.lastSeenUs = nowUs;
+        sender.rejected = 0;
+        sender.used = true;
+        return oldest;
+    }
+
+    /**
+     * Handle a CONTROL_CLAIM: grant it, or deny it with the owner's time left
+     */
+    void claim(int8_t index, const uint8_t* data, int len, uint64_t nowUs) {
+        if (len != sizeof(ControlClaim)) {
+            return;
+        }
+        ControlClaim request;
+        memcpy(&request, data, sizeof(request));
+        bool active = leaseActive(nowUs);
+        if (active && index != owner && request.priority <= ownerPriority) {
+            senders[index].rejected++;
+            rejected.fetch_add(1, std::memory_order_relaxed);
+            queueReply(index, ControlStatus::DENIED, (uint16_t)((leaseEndUs - nowUs) / 1000));
+            return;
+        }
+        int8_t previous = active && index != owner ? owner : NO_OWNER;
+        uint16_t leaseMs = request.leaseMs == 0 ? CONTROL_LEASE_DEFAULT_MS
+                           : request.leaseMs > CONTROL_LEASE_MAX_MS ? CONTROL_LEASE_MAX_MS
+                                                                    : request.leaseMs;
+        owner = index;
+        ownerPriority = request.priority;
+        leaseUs = leaseMs * 1000ULL;
+        leaseEndUs = nowUs + leaseUs;
+        if (previous != NO_OWNER) {
+            takeovers.fetch_add(1, std::memory_order_relaxed);
+            queueReply(previous, ControlStatus::REVOKED, 0);
+        }
+        queueReply(index, ControlStatus::GRANTED, leaseMs);
+    }
+
+    void queueReply(int8_t index, ControlStatus status, uint16_t leaseMs) {
+        ControlReply reply = {};
+        reply.type = PacketType::CONTROL_REPLY;
+        memcpy(reply.controller, senders[index].mac, ESP_NOW_ETH_ALEN);
+        reply.status = status;
+        reply.ownerPriority = owner == NO_OWNER ? 0 : ownerPriority;
+        reply.leaseMs = leaseMs;
+        replies.push(reply);
+    }
+};
+
+#endif // CONTROL_ARBITER_HPP
@@ -0,0 +1,31 @@
+#ifndef CRC32_HPP
+#define CRC32_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * CRC-32 (IEEE 802.3, as zlib's crc32 and Python's zlib.crc32)
+ *
+ * Uses a 16-entry nibble table: small enough to keep in flash and fast
+ * enough to check an asset pack at boot.
+ *
+ * @param data Data to check
+ * @param len Length in bytes
+ * @param crc CRC of the preceding data, to continue a running CRC
+ * @return CRC of everything so far
+ */
+inline uint32_t crc32(const uint8_t* data, size_t len, uint32_t crc = 0) {
+    static const uint32_t TABLE[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+    };
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) {
+        crc = TABLE[(crc ^ data[i]) & 0x0F] ^ (crc >> 4);
+        crc = TABLE[(crc ^ (data[i] >> 4)) & 0x0F] ^ (crc >> 4);
+    }
+    return ~crc;
+}
+
+#endif // CRC32_HPP
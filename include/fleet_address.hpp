@@ -0,0 +1,151 @@
+#ifndef FLEET_ADDRESS_HPP
+#define FLEET_ADDRESS_HPP
+
+#include <atomic>
+#include <esp_now.h>
+#include <Preferences.h>
+#include <string.h>
+#include "constants.h"
+#include "protocol.h"
+
+/**
+ * FleetAddress Class
+ *
+ * This robot's ID and groups (see "Fleet Addressing" in protocol.h), and
+ * the lookup of its slot in FLEET_COMMAND packets. The slot is found from
+ * the packet header alone: by subtraction for a robot ID, or from the
+ * lowest set bit of the addressed groups, so the cost does not grow with
+ * the number of slots.
+ *
+ * IDENTITY_SET takes effect at once in the receive callback; the main loop
+ * writes it to NVS (which blocks while the flash is written) with update().
+ */
+class FleetAddress {
+public:
+    FleetAddress() = default;
+
+    /**
+     * Load the ID and groups stored in NVS
+     *
+     * @return true if initialization successful, false otherwise
+     */
+    bool begin() {
+        Preferences preferences;
+        if (!preferences.begin(NVS_NAMESPACE, true)) {
+            // Nothing stored yet
+            return true;
+        }
+        robotId.store(preferences.getUChar("id", ROBOT_ID_NONE));
+        groups.store(preferences.getUInt("groups", 0));
+        preferences.end();
+        return true;
+    }
+
+    /**
+     * Take an IDENTITY_SET packet (from the receive callback)
+     * Broadcast packets are ignored, so a fleet cannot be given one ID.
+     *
+     * @param info Receive information (destination address)
+     * @param data Packet data
+     * @param len Packet length
+     */
+    void handleIdentity(const esp_now_recv_info_t* info, const uint8_t* data, int len) {
+        if (len != sizeof(IdentitySet) || memcmp(info->des_addr, ESPNOW_BROADCAST_MAC, ESP_NOW_ETH_ALEN) == 0) {
+            return;
+        }
+        IdentitySet identity;
+        memcpy(&identity, data, sizeof(identity));
+        robotId.store(identity.robotId);
+        groups.store(identity.groups);
+        unsaved.store(true);
+    }
+
+    /**
+     * Find this robot's command in a FLEET_COMMAND packet
+     *
+     * @param data Packet data
+     * @param len Packet length
+     * @param direction Set to the command for this robot
+     * @return true if the packet has a command for this robot
+     */
+    bool commandFor(const uint8_t* data, int len, Direction& direction) const {
+        if (len < (int)sizeof(FleetCommand)) {
+            return false;
+        }
+        FleetCommand command;
+        memcpy(&command, data, sizeof(command));
+        if (len != (int)sizeof(FleetCommand) + command.count) {
+            return false;
+        }
+        int slot = slotIndex(command);
+        if (slot < 0 || data[sizeof(FleetCommand) + slot] == FLEET_SLOT_SKIP) {
+            return false;
+        }
+        direction = (Direction)data[sizeof(FleetCommand) + slot];
+        return true;
+    }
+
+    /**
+     * Store a changed ID and groups in NVS (from the main loop)
+     */
+    void update() {
+        if (!unsaved.exchange(false)) {
+            return;
+        }
+        Preferences preferences;
+        if (!preferences.begin(NVS_NAMESPACE, false)) {
+            return;
+        }
+        preferences.putUChar("id", robotId.load());
+        preferences.putUInt("groups", groups.load());
+        preferences.end();
+    }
+
+    /**
+     * Get the robot ID (ROBOT_ID_NONE if not assigned)
+     */
+    uint8_t getRobotId() const {
+        return robotId.load();
+    }
+
+    /**
+     * Get the groups (bit n set: member of group n)
+     */
+    uint32_t getGroups() const {
+        return groups.load();
+    }
+
+private:
+    static constexpr const char* NVS_NAMESPACE = "fleet";
+
+    std::atomic<uint8_t> robotId{ROBOT_ID_NONE};
+    std::atomic<uint32_t> groups{0};
+    // Set in the receive callback, cleared when stored
+    std::atomic<bool> unsaved{false};
+
+    /**
+     * Slot of this robot in a fleet command
+     *
+     * @return Slot index, or -1 if the packet does not address this robot
+     */
+    int slotIndex(const FleetCommand& command) const {
+        if (command.mode == FleetSlotMode::ROBOT) {
+            uint8_t id = robotId.load();
+            if (id == ROBOT_ID_NONE || id < command.first || id - command.first >= command.count) {
+                return -1;
+            }
+            return id - command.first;
+        }
+        if (command.mode == FleetSlotMode::GROUP && command.first < FLEET_GROUP_COUNT) {
+            // Member groups among the addressed ones, as slot bits
+            uint32_t member = groups.load() >> command.first;
+            if (command.count < FLEET_GROUP_COUNT) {
+                member &= (1u << command.count) - 1;
+            }
+            return member ? __builtin_ctz(member) : -1;
+        }
+        return -1;
+    }
+};
+
+#endif // FLEET_ADDRESS_HPP
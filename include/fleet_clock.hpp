@@ -0,0 +1,208 @@
+#ifndef FLEET_CLOCK_HPP
+#define FLEET_CLOCK_HPP
+
+#include <atomic>
+#include <esp_now.h>
+#include <esp_timer.h>
+#include <string.h>
+#include "clock_sync.hpp"
+#include "constants.h"
+#include "handoff.hpp"
+#include "protocol.h"
+#include "uplink.hpp"
+
+/**
+ * FleetClock Class
+ *
+ * Shared clock of a fleet of robots for synchronized shows (see "Fleet
+ * Time" in protocol.h). Beacons are time-stamped in the ESP-NOW receive
+ * callback and handed to the main loop, which feeds them to ClockSync and
+ * reads the fleet time for the animations from it.
+ *
+ * MOVE_AT commands are handed over the same way; the main loop converts
+ * the start time to the local clock and arms a one-shot esp_timer, so the
+ * move starts within the timer's precision rather than the render
+ * interval. Send MOVE_AT at least a few render intervals ahead. The move
+ * callback therefore runs in the esp_timer task (or in the main loop when
+ * the move is already due) and must serialize with other commands.
+ *
+ * With CLOCK_SYNC_SOURCE, this robot's clock is the fleet clock and it
+ * broadcasts the beacons.
+ */
+class FleetClock {
+public:
+    // Called with the direction of a MOVE_AT command when its time comes
+    // (from the esp_timer task or the main loop)
+    using MoveCallback = void (*)(Direction direction);
+
+    FleetClock() = default;
+
+    /**
+     * Create the move timer (and start sending beacons on the source)
+     *
+     * @param onMove Called to execute a scheduled move
+     * @return true if initialization successful, false otherwise
+     */
+    bool begin(MoveCallback onMove) {
+        moveCallback = onMove;
+        esp_timer_create_args_t timerArgs = {};
+        timerArgs.callback = &FleetClock::onMoveTimer;
+        timerArgs.arg = this;
+        timerArgs.dispatch_method = ESP_TIMER_TASK;
+        timerArgs.name = "move";
+        if (esp_timer_create(&timerArgs, &moveTimer) != ESP_OK) {
+            return false;
+        }
+#if CLOCK_SYNC_SOURCE
+        sync.setReference();
+        if (!Uplink::addBroadcastPeer()) {
+            return false;
+        }
+        timerArgs.callback = &FleetClock::onBeaconTimer;
+        timerArgs.name = "beacon";
+        if (esp_timer_create(&timerArgs, &beaconTimer) != ESP_OK) {
+            return false;
+        }
+        return esp_timer_start_periodic(beaconTimer, BEACON_INTERVAL_US) == ESP_OK;
+#else
+        return true;
+#endif
+    }
+
+    /**
+     * Take a TIME_BEACON packet (from the receive callback)
+     *
+     * @param data Packet data
+     * @param len Packet length
+     */
+    void handleBeacon(const uint8_t* data, int len) {
+        // Stamp first: time spent here would count as delay
+        uint64_t localUs = (uint64_t)esp_timer_get_time();
+        if (len != sizeof(TimeBeacon)) {
+            return;
+        }
+        TimeBeacon beacon;
+        memcpy(&beacon, data, sizeof(beacon));
+        samples.push({beacon.timeUs, localUs});
+    }
+
+    /**
+     * Take a MOVE_AT packet (from the receive callback)
+     *
+     * @param data Packet data
+     * @param len Packet length
+     */
+    void handleMoveAt(const uint8_t* data, int len) {
+        if (len != sizeof(MoveAt)) {
+            return;
+        }
+        MoveAt move;
+        memcpy(&move, data, sizeof(move));
+        moves.push({move.startUs, move.direction});
+    }
+
+    /**
+     * Apply received beacons and schedule received moves (from the main loop)
+     */
+    void update() {
+        Sample sample;
+        while (samples.pop(sample)) {
+            if (sync.addSample(sample.sourceUs, sample.localUs)) {
+                // Fleet time stepped: it may go back this once
+                stepped = true;
+                lastFleetUs = 0;
+            }
+        }
+        Move move;
+        while (moves.pop(move)) {
+            esp_timer_stop(moveTimer);
+            uint64_t nowUs = (uint64_t)esp_timer_get_time();
+            uint64_t startUs = sync.toLocal(move.startUs);
+            if (startUs <= nowUs) {
+                moveCallback((Direction)move.direction);
+                continue;
+            }
+            scheduledDirection = move.direction;
+            esp_timer_start_once(moveTimer, startUs - nowUs);
+        }
+    }
+
+    /**
+     * Get the fleet time for the animations (from the main loop)
+     * Never goes back, except once when the fleet time steps (see takeStep()).
+     *
+     * @return Fleet time (milliseconds); the local time until a beacon arrives
+     */
+    uint32_t nowMs() {
+        uint64_t fleetUs = sync.toFleet((uint64_t)esp_timer_get_time());
+        if (fleetUs < lastFleetUs) {
+            fleetUs = lastFleetUs;
+        }
+        lastFleetUs = fleetUs;
+        return (uint32_t)(fleetUs / 1000);
+    }
+
+    /**
+     * Check whether the fleet time stepped since the last call
+     * (first beacon, or the source restarted)
+     */
+    bool takeStep() {
+        bool result = stepped;
+        stepped = false;
+        return result;
+    }
+
+    /**
+     * Get the clock estimate
+     */
+    const ClockSync& getSync() const {
+        return sync;
+    }
+
+private:
+    // Beacon interval of the source
+    static constexpr uint64_t BEACON_INTERVAL_US = 100000;
+
+    struct Sample {
+        uint64_t sourceUs;
+        uint64_t localUs;
+    };
+
+    struct Move {
+        uint64_t startUs;
+        uint8_t direction;
+    };
+
+    ClockSync sync;
+    Handoff<Sample, 8> samples;
+    Handoff<Move, 4> moves;
+    MoveCallback moveCallback = nullptr;
+    esp_timer_handle_t moveTimer = nullptr;
+    std::atomic<uint8_t> scheduledDirection{0};
+    // Last fleet time returned by nowMs() (main loop only)
+    uint64_t lastFleetUs = 0;
+    bool stepped = false;
+#if CLOCK_SYNC_SOURCE
+    esp_timer_handle_t beaconTimer = nullptr;
+    uint8_t beaconSequence = 0;
+
+    static void onBeaconTimer(void* arg) {
+        static_cast<FleetClock*>(arg)->sendBeacon();
+    }
+
+    void sendBeacon() {
+        TimeBeacon beacon = {PacketType::TIME_BEACON, beaconSequence++, (uint64_t)esp_timer_get_time()};
+        esp_now_send(ESPNOW_BROADCAST_MAC, (const uint8_t*)&beacon, sizeof(beacon));
+    }
+#endif
+
+    /**
+     * Timer callback: the scheduled move is due
+     */
+    static void onMoveTimer(void* arg) {
+        auto* clock = static_cast<FleetClock*>(arg);
+        clock->moveCallback((Direction)clock->scheduledDirection.load());
+    }
+};
+
+#endif // FLEET_CLOCK_HPP
@@ -0,0 +1,176 @@
+#ifndef FRAME_BLEND_HPP
+#define FRAME_BLEND_HPP
+
+#include <array>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "asset_format.h"
+#include "frame_decoder.hpp"
+#include "rgb565.hpp"
+
+/**
+ * Build the RGB565 component -> linear light table for a component width
+ * (gamma 2 approximation of sRGB, 0 to 4095)
+ */
+template <uint8_t Bits>
+constexpr std::array<uint16_t, 1 << Bits> buildLinearTable() {
+    constexpr uint32_t max = (1u << Bits) - 1;
+    std::array<uint16_t, 1 << Bits> table = {};
+    for (uint32_t c = 0; c <= max; c++) {
+        table[c] = (uint16_t)((c * c * 4095 + max * max / 2) / (max * max));
+    }
+    return table;
+}
+
+/**
+ * Build the linear light (0 to 4095) -> 8-bit component table,
+ * the rounded inverse of the linear tables
+ */
+constexpr std::array<uint8_t, 4096> buildEncodeTable() {
+    std::array<uint8_t, 4096> table = {};
+    uint32_t value = 0;
+    for (uint32_t light = 0; light < 4096; light++) {
+        // Round: next value once light reaches the midpoint (value + 0.5)^2
+        while (value < 255 && (2 * value + 1) * (2 * value + 1) * 4095 <= 4 * 65025 * light) {
+            value++;
+        }
+        table[light] = (uint8_t)value;
+    }
+    return table;
+}
+
+inline constexpr std::array<uint16_t, 32> linearLight5 = buildLinearTable<5>();
+inline constexpr std::array<uint16_t, 64> linearLight6 = buildLinearTable<6>();
+inline constexpr std::array<uint8_t, 4096> encodeLight = buildEncodeTable();
+
+/**
+ * FrameBlend Class
+ *
+ * Crossfades between two RGB frames with packed integer (SWAR) math: each
+ * 32-bit word holds four channel bytes, split into two words of two 16-bit
+ * lanes (even and odd bytes). One multiply then scales two channels at
+ * once, so a word of four channels costs four multiplies instead of eight
+ * multiply-and-shift steps. With weights adding up to 256, a lane holds at
+ * most 255 x 256 and never carries into the next one.
+ *
+ * interpolate() synthesizes in-between frames of an RGB565 animation in
+ * linear light, so a pixel fading from one color to another does not dip
+ * in brightness halfway. Components are linearized through small tables,
+ * then blended two pixels at a time: each 32-bit word holds the same
+ * component of both pixels in 16-bit lanes (12-bit light x 4-bit weight
+ * fits a lane). Pixel pairs that are equal in both frames, most of a
+ * typical frame, are converted directly.
+ *
+ * No hardware dependencies: used by LedDisplay and checked on the host
+ * (host/asset_bench).
+ */
+class FrameBlend {
+public:
+    // Blend amount that shows only the new frame
+    static constexpr uint16_t FULL = 256;
+    // Interpolation steps between two source frames
+    static constexpr uint8_t STEPS = 16;
+
+    /**
+     * Blend a frame over a previous one, in place
+     * to = (from x (256 - amount) + to x amount) / 256, per channel byte
+     *
+     * @param from Previous frame
+     * @param to New frame; receives the blend
+     * @param bytes Frame size in bytes
+     * @param amount Weight of the new frame (0 = previous only, 256 = new only)
+     */
+    static void crossfade(const uint8_t* from, uint8_t* to, size_t bytes, uint16_t amount) {
+        if (amount >= FULL) {
+            return;
+        }
+        const uint32_t weight = amount;
+        const uint32_t inverse = FULL - amount;
+        size_t i = 0;
+        for (; i + 4 <= bytes; i += 4) {
+            uint32_t a;
+            uint32_t b;
+            memcpy(&a, from + i, 4);
+            memcpy(&b, to + i, 4);
+            uint32_t even = (((a & 0x00FF00FF) * inverse + (b & 0x00FF00FF) * weight) >> 8) & 0x00FF00FF;
+            uint32_t odd = (((a >> 8) & 0x00FF00FF) * inverse + ((b >> 8) & 0x00FF00FF) * weight) & 0xFF00FF00;
+            uint32_t blended = even | odd;
+            memcpy(to + i, &blended, 4);
+        }
+        for (; i < bytes; i++) {
+            to[i] = (uint8_t)((from[i] * inverse + to[i] * weight) >> 8);
+        }
+    }
+
+    /**
+     * Decode an in-between frame of two frames, remapped to LED order
+     *
+     * Only uncompressed RGB565 frames can be interpolated; at amount 0 or
+     * STEPS, the source frame is decoded as is.
+     *
+     * @param from Earlier frame
+     * @param to Later frame
+     * @param amount Position between the frames (0 = from, STEPS = to)
+     * @param ledIndex Display pixel -> LED index table (pixelCount entries)
+     * @param rgb Output, 3 bytes per LED in R, G, B order
+     * @return false if the frames cannot be interpolated (nothing written)
+     */
+    static bool interpolate(const AssetFrame& from, const AssetFrame& to, uint8_t amount,
+                            const uint16_t* ledIndex, uint8_t* rgb) {
+        if (amount == 0 || amount >= STEPS) {
+            return FrameDecoder::decode(amount == 0 ? from : to, ledIndex, rgb);
+        }
+        if (from.format != PixelFormat::RGB565 || from.compression != Compression::NONE ||
+            to.format != PixelFormat::RGB565 || to.compression != Compression::NONE ||
+            from.pixelCount != to.pixelCount || from.pixelCount % 2) {
+            return false;
+        }
+        const uint32_t weight = amount;
+        const uint32_t inverse = STEPS - amount;
+        for (size_t i = 0; i < from.pixelCount; i += 2) {
+            uint32_t a = from.words[i / 2];
+            uint32_t b = to.words[i / 2];
+            uint8_t* first = rgb + ledIndex[i] * 3;
+            uint8_t* second = rgb + ledIndex[i + 1] * 3;
+            if (a == b) {
+                Rgb565::toRgb((uint16_t)a, first);
+                Rgb565::toRgb((uint16_t)(a >> 16), second);
+                continue;
+            }
+            // One component of both pixels per word, 12-bit light in 16-bit lanes
+            uint32_t red = mix(lanes5(a >> 11), lanes5(b >> 11), inverse, weight);
+            uint32_t green = mix(lanes6(a >> 5), lanes6(b >> 5), inverse, weight);
+            uint32_t blue = mix(lanes5(a), lanes5(b), inverse, weight);
+            first[0] = encodeLight[red & 0xFFFF];
+            first[1] = encodeLight[green & 0xFFFF];
+            first[2] = encodeLight[blue & 0xFFFF];
+            second[0] = encodeLight[red >> 16];
+            second[1] = encodeLight[green >> 16];
+            second[2] = encodeLight[blue >> 16];
+        }
+        return true;
+    }
+
+private:
+    /**
+     * Linear light of a 5- or 6-bit component of both pixels of a word
+     * (component shifted to bit 0 of each half)
+     */
+    static uint32_t lanes5(uint32_t pair) {
+        return linearLight5[pair & 0x1F] | (uint32_t)linearLight5[(pair >> 16) & 0x1F] << 16;
+    }
+
+    static uint32_t lanes6(uint32_t pair) {
+        return linearLight6[pair & 0x3F] | (uint32_t)linearLight6[(pair >> 16) & 0x3F] << 16;
+    }
+
+    /**
+     * Weighted average of two lane pairs (weights add up to STEPS)
+     */
+    static uint32_t mix(uint32_t a, uint32_t b, uint32_t inverse, uint32_t weight) {
+        return ((a * inverse + b * weight) >> 4) & 0x0FFF0FFF;
+    }
+};
+
+#endif // FRAME_BLEND_HPP
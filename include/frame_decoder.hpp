@@ -0,0 +1,116 @@
+#ifndef FRAME_DECODER_HPP
+#define FRAME_DECODER_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "asset_format.h"
+#include "rgb565.hpp"
+
+/**
+ * FrameDecoder Class
+ *
+ * Decodes an animation frame in any of the asset formats (see
+ * asset_format.h) straight into 8-bit RGB LED data, remapping pixels to
+ * LED order in the same pass. Every format is read one aligned word at a
+ * time.
+ *
+ * No hardware dependencies: the same code is benchmarked on the host
+ * (host/asset_bench).
+ */
+class FrameDecoder {
+public:
+    /**
+     * Decode a frame
+     *
+     * @param frame Encoded frame
+     * @param ledIndex Display pixel -> LED index table (frame.pixelCount entries)
+     * @param rgb Output, 3 bytes per LED in R, G, B order
+     * @return true if the frame decoded to exactly pixelCount pixels
+     */
+    static bool decode(const AssetFrame& frame, const uint16_t* ledIndex, uint8_t* rgb) {
+        const uint32_t* words = frame.words;
+        const size_t count = frame.pixelCount;
+
+        if (frame.compression == Compression::NONE) {
+            if (frame.format == PixelFormat::RGB565) {
+                if (count % 2) {
+                    return false;
+                }
+                Rgb565::convertFrame(words, count, ledIndex, rgb);
+            } else {
+                for (size_t i = 0; i < count; i++) {
+                    storeRgb888(*words++, rgb + ledIndex[i] * 3);
+                }
+            }
+            return true;
+        }
+
+        // Run-length encoded: one run per word
+        const bool rgb565 = frame.format == PixelFormat::RGB565;
+        size_t i = 0;
+        while (i < count) {
+            uint32_t run = *words++;
+            size_t length = rgb565 ? run >> 16 : run >> 24;
+            if (length == 0 || length > count - i) {
+                return false;
+            }
+            uint8_t pixel[3];
+            if (rgb565) {
+                Rgb565::toRgb((uint16_t)run, pixel);
+            } else {
+                storeRgb888(run, pixel);
+            }
+            for (size_t end = i + length; i < end; i++) {
+                uint8_t* out = rgb + ledIndex[i] * 3;
+                out[0] = pixel[0];
+                out[1] = pixel[1];
+                out[2] = pixel[2];
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Expand an RGB565 frame into uncompressed RGB565 words (display order)
+     *
+     * @param frame Encoded RGB565 frame (pixelCount even)
+     * @param words Output, pixelCount / 2 words
+     * @return false if the frame is not RGB565 or is malformed
+     */
+    static bool unpack565(const AssetFrame& frame, uint32_t* words) {
+        const size_t count = frame.pixelCount;
+        if (frame.format != PixelFormat::RGB565 || count % 2) {
+            return false;
+        }
+        if (frame.compression == Compression::NONE) {
+            memcpy(words, frame.words, count * 2);
+            return true;
+        }
+        const uint32_t* runs = frame.words;
+        size_t i = 0;
+        while (i < count) {
+            uint32_t run = *runs++;
+            size_t length = run >> 16;
+            if (length == 0 || length > count - i) {
+                return false;
+            }
+            // Two pixels per word, first pixel in the low half
+            uint32_t pixel = run & 0xFFFF;
+            for (size_t end = i + length; i < end; i++) {
+                uint32_t& word = words[i / 2];
+                word = i % 2 ? (word & 0xFFFF) | (pixel << 16) : pixel;
+            }
+        }
+        return true;
+    }
+
+private:
+    static void storeRgb888(uint32_t pixel, uint8_t* out) {
+        out[0] = (uint8_t)(pixel >> 16);
+        out[1] = (uint8_t)(pixel >> 8);
+        out[2] = (uint8_t)pixel;
+    }
+};
+
+#endif // FRAME_DECODER_HPP
@@ -0,0 +1,155 @@
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#include <stdint.h>
+
+/**
+ * Glyph Atlas
+ *
+ * 1-bpp 5x7 font for printable ASCII (0x20-0x7E), stored column by column:
+ * one byte per glyph column, bit 0 = top row. Glyphs are proportional
+ * (empty columns at either side are left out), so the whole atlas is
+ * 421 bytes of columns plus an offset table, and stays in flash.
+ * Columns are the unit the text marquee scrolls by (see TextMarquee).
+ */
+
+// Glyph size (rows, and columns of the widest glyph)
+static constexpr uint8_t GLYPH_HEIGHT = 7;
+static constexpr uint8_t GLYPH_MAX_WIDTH = 5;
+// First character in the atlas and number of glyphs
+static constexpr char GLYPH_FIRST = 0x20;
+static constexpr uint8_t GLYPH_COUNT = 95;
+// Glyph shown for characters outside the atlas
+static constexpr char GLYPH_FALLBACK = '?';
+
+// Glyph columns, in character order
+const uint8_t glyphColumns[] = {
+    0x00, 0x00,  // space
+    0x5F,  // '!'
+    0x07, 0x00, 0x07,  // '"'
+    0x14, 0x7F, 0x14, 0x7F, 0x14,  // '#'
+    0x24, 0x2A, 0x7F, 0x2A, 0x12,  // '$'
+    0x23, 0x13, 0x08, 0x64, 0x62,  // '%'
+    0x36, 0x49, 0x55, 0x22, 0x50,  // '&'
+    0x05, 0x03,  // '\''
+    0x1C, 0x22, 0x41,  // '('
+    0x41, 0x22, 0x1C,  // ')'
+    0x14, 0x08, 0x3E, 0x08, 0x14,  // '*'
+    0x08, 0x08, 0x3E, 0x08, 0x08,  // '+'
+    0x50, 0x30,  // ','
+    0x08, 0x08, 0x08, 0x08, 0x08,  // '-'
+    0x60, 0x60,  // '.'
+    0x20, 0x10, 0x08, 0x04, 0x02,  // '/'
+    0x3E, 0x51, 0x49, 0x45, 0x3E,  // '0'
+    0x42, 0x7F, 0x40,  // '1'
+    0x42, 0x61, 0x51, 0x49, 0x46,  // '2'
+    0x21, 0x41, 0x45, 0x4B, 0x31,  // '3'
+    0x18, 0x14, 0x12, 0x7F, 0x10,  // '4'
+    0x27, 0x45, 0x45, 0x45, 0x39,  // '5'
+    0x3C, 0x4A, 0x49, 0x49, 0x30,  // '6'
+    0x01, 0x71, 0x09, 0x05, 0x03,  // '7'
+    0x36, 0x49, 0x49, 0x49, 0x36,  // '8'
+    0x06, 0x49, 0x49, 0x29, 0x1E,  // '9'
+    0x36, 0x36,  // ':'
+    0x56, 0x36,  // ';'
+    0x08, 0x14, 0x22, 0x41,  // '<'
+    0x14, 0x14, 0x14, 0x14, 0x14,  // '='
+    0x41, 0x22, 0x14, 0x08,  // '>'
+    0x02, 0x01, 0x51, 0x09, 0x06,  // '?'
+    0x32, 0x49, 0x79, 0x41, 0x3E,  // '@'
+    0x7E, 0x11, 0x11, 0x11, 0x7E,  // 'A'
+    0x7F, 0x49, 0x49, 0x49, 0x36,  // 'B'
+    0x3E, 0x41, 0x41, 0x41, 0x22,  // 'C'
+    0x7F, 0x41, 0x41, 0x22, 0x1C,  // 'D'
+    0x7F, 0x49, 0x49, 0x49, 0x41,  // 'E'
+    0x7F, 0x09, 0x09, 0x09, 0x01,  // 'F'
+    0x3E, 0x41, 0x49, 0x49, 0x7A,  // 'G'
+    0x7F, 0x08, 0x08, 0x08, 0x7F,  // 'H'
+    0x41, 0x7F, 0x41,  // 'I'
+    0x20, 0x40, 0x41, 0x3F, 0x01,  // 'J'
+    0x7F, 0x08, 0x14, 0x22, 0x41,  // 'K'
+    0x7F, 0x40, 0x40, 0x40, 0x40,  // 'L'
+    0x7F, 0x02, 0x0C, 0x02, 0x7F,  // 'M'
+    0x7F, 0x04, 0x08, 0x10, 0x7F,  // 'N'
+    0x3E, 0x41, 0x41, 0x41, 0x3E,  // 'O'
+    0x7F, 0x09, 0x09, 0x09, 0x06,  // 'P'
+    0x3E, 0x41, 0x51, 0x21, 0x5E,  // 'Q'
+    0x7F, 0x09, 0x19, 0x29, 0x46,  // 'R'
+    0x46, 0x49, 0x49, 0x49, 0x31,  // 'S'
+    0x01, 0x01, 0x7F, 0x01, 0x01,  // 'T'
+    0x3F, 0x40, 0x40, 0x40, 0x3F,  // 'U'
+    0x1F, 0x20, 0x40, 0x20, 0x1F,  // 'V'
+    0x3F, 0x40, 0x38, 0x40, 0x3F,  // 'W'
+    0x63, 0x14, 0x08, 0x14, 0x63,  // 'X'
+    0x07, 0x08, 0x70, 0x08, 0x07,  // 'Y'
+    0x61, 0x51, 0x49, 0x45, 0x43,  // 'Z'
+    0x7F, 0x41, 0x41,  // '['
+    0x02, 0x04, 0x08, 0x10, 0x20,  // backslash
+    0x41, 0x41, 0x7F,  // ']'
+    0x04, 0x02, 0x01, 0x02, 0x04,  // '^'
+    0x40, 0x40, 0x40, 0x40, 0x40,  // '_'
+    0x01, 0x02, 0x04,  // '`'
+    0x20, 0x54, 0x54, 0x54, 0x78,  // 'a'
+    0x7F, 0x48, 0x44, 0x44, 0x38,  // 'b'
+    0x38, 0x44, 0x44, 0x44, 0x20,  // 'c'
+    0x38, 0x44, 0x44, 0x48, 0x7F,  // 'd'
+    0x38, 0x54, 0x54, 0x54, 0x18,  // 'e'
+    0x08, 0x7E, 0x09, 0x01, 0x02,  // 'f'
+    0x0C, 0x52, 0x52, 0x52, 0x3E,  // 'g'
+    0x7F, 0x08, 0x04, 0x04, 0x78,  // 'h'
+    0x44, 0x7D, 0x40,  // 'i'
+    0x20, 0x40, 0x44, 0x3D,  // 'j'
+    0x7F, 0x10, 0x28, 0x44,  // 'k'
+    0x41, 0x7F, 0x40,  // 'l'
+    0x7C, 0x04, 0x18, 0x04, 0x78,  // 'm'
+    0x7C, 0x08, 0x04, 0x04, 0x78,  // 'n'
+    0x38, 0x44, 0x44, 0x44, 0x38,  // 'o'
+    0x7C, 0x14, 0x14, 0x14, 0x08,  // 'p'
+    0x08, 0x14, 0x14, 0x18, 0x7C,  // 'q'
+    0x7C, 0x08, 0x04, 0x04, 0x08,  // 'r'
+    0x48, 0x54, 0x54, 0x54, 0x20,  // 's'
+    0x04, 0x3F, 0x44, 0x40, 0x20,  // 't'
+    0x3C, 0x40, 0x40, 0x20, 0x7C,  // 'u'
+    0x1C, 0x20, 0x40, 0x20, 0x1C,  // 'v'
+    0x3C, 0x40, 0x30, 0x40, 0x3C,  // 'w'
+    0x44, 0x28, 0x10, 0x28, 0x44,  // 'x'
+    0x0C, 0x50, 0x50, 0x50, 0x3C,  // 'y'
+    0x44, 0x64, 0x54, 0x4C, 0x44,  // 'z'
+    0x08, 0x36, 0x41,  // '{'
+    0x7F,  // '|'
+    0x41, 0x36, 0x08,  // '}'
+    0x08, 0x04, 0x08, 0x10, 0x08,  // '~'
+};
+
+// First column of each glyph in glyphColumns (GLYPH_COUNT + 1 entries;
+// a glyph's width is the difference to the next offset)
+const uint16_t glyphOffsets[GLYPH_COUNT + 1] = {
+    0, 2, 3, 6, 11, 16, 21, 26, 28, 31, 34, 39, 44, 46, 51, 53, 58, 63, 66, 71, 76, 81, 86, 91, 96,
+    101, 106, 108, 110, 114, 119, 123, 128, 133, 138, 143, 148, 153, 158, 163, 168, 173, 176, 181,
+    186, 191, 196, 201, 206, 211, 216, 221, 226, 231, 236, 241, 246, 251, 256, 261, 264, 269, 272,
+    277, 282, 285, 290, 295, 300, 305, 310, 315, 320, 325, 328, 332, 336, 339, 344, 349, 354, 359,
+    364, 369, 374, 379, 384, 389, 394, 399, 404, 409, 412, 413, 416, 421,
+};
+
+/**
+ * Glyph of a character
+ */
+struct Glyph {
+    const uint8_t* columns;
+    uint8_t width;
+};
+
+/**
+ * Look up the glyph of a character
+ *
+ * @param c Character (outside printable ASCII: GLYPH_FALLBACK)
+ */
+inline Glyph findGlyph(char c) {
+    uint8_t index = (uint8_t)(c - GLYPH_FIRST);
+    if (index >= GLYPH_COUNT) {
+        index = GLYPH_FALLBACK - GLYPH_FIRST;
+    }
+    return {glyphColumns + glyphOffsets[index], (uint8_t)(glyphOffsets[index + 1] - glyphOffsets[index])};
+}
+
+#endif // GLYPH_ATLAS_H
@@ -0,0 +1,55 @@
+#ifndef HANDOFF_HPP
+#define HANDOFF_HPP
+
+#include <atomic>
+#include <stdint.h>
+
+/**
+ * Handoff Class
+ *
+ * Single-producer, single-consumer queue of SIZE - 1 entries, for passing
+ * small records from one task to another (e.g. from the ESP-NOW receive
+ * callback to the main loop) without locks or heap use. When full, new
+ * entries are dropped.
+ */
+template <typename T, uint8_t SIZE>
+class Handoff {
+public:
+    /**
+     * Add an entry (producer only)
+     *
+     * @return true if added, false if the queue is full
+     */
+    bool push(const T& entry) {
+        uint8_t head = this->head.load(std::memory_order_relaxed);
+        uint8_t next = (uint8_t)((head + 1) % SIZE);
+        if (next == tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        entries[head] = entry;
+        this->head.store(next, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Take the oldest entry (consumer only)
+     *
+     * @return true if an entry was taken
+     */
+    bool pop(T& entry) {
+        uint8_t tail = this->tail.load(std::memory_order_relaxed);
+        if (tail == head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        entry = entries[tail];
+        this->tail.store((uint8_t)((tail + 1) % SIZE), std::memory_order_release);
+        return true;
+    }
+
+private:
+    T entries[SIZE];
+    std::atomic<uint8_t> head{0};
+    std::atomic<uint8_t> tail{0};
+};
+
+#endif // HANDOFF_HPP
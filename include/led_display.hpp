@@ -3,23 +3,78 @@
 
 #include <FastLED.h>
 #include <LovyanGFX.hpp>
+#include <utility>
+#include "constants.h"
+#include "led_layout.hpp"
+#include "asset_format.h"
+#include "frame_blend.hpp"
+#include "frame_decoder.hpp"
+#include "output_lut.hpp"
+#if LED_ASYNC_OUTPUT_ENABLED
+#include <atomic>
+#include "rmt_led_output.hpp"
+#include "ws2812_encoder.hpp"
+#endif
 
 /**
  * LedDisplay Class
  * 
- * Controls a 16x16 WS2812 LED matrix display using the FastLED library.
- * The display shows animated arrow graphics rendered by LovyanGFX.
- * 
+ * Controls a WS2812 LED matrix display using the FastLED library.
+ * Prerendered images are converted straight from flash (showFrame) and
+ * text is drawn from its column masks (showMarqueeAsync); the LovyanGFX
+ * sprite path (show) is used only for dynamically drawn content.
+ *
  * LED Matrix Layout:
- * The LEDs are arranged in a zigzag pattern where even rows run left-to-right
- * and odd rows run right-to-left. This is a common wiring pattern for LED matrices
- * to minimize wire length.
+ * The mapping from display pixels to the LED chain is given by the Layout
+ * policy (see led_layout.hpp): serpentine or progressive rows, panel rotation
+ * and mirroring, and tiling of several chained panels. The mapping is a
+ * constexpr table, so every layout costs one lookup per pixel.
+ *
+ * @tparam Width Display width in pixels
+ * @tparam Height Display height in pixels
+ * @tparam Layout PanelLayout<...> describing the wiring
+ *
+ * Power Budget:
+ * Before each frame is sent, its current draw is estimated from the channel
+ * sum of leds[] and the brightness is set to the highest value that keeps
+ * the LED current within the power budget. Mostly-black frames are shown
+ * brighter, full frames dimmer, and the peak current stays the same.
+ *
+ * Output Levels:
+ * leds[] holds frame values; gamma, brightness and color correction are
+ * applied only on the way out, through OutputLut's fused gamma/correction
+ * tables and one brightness multiply, instead of FastLED's scaling. The fraction of a level lost to
+ * 8-bit output is carried to the next frame per LED (temporal dithering),
+ * which keeps dim shades apart at low brightness. Gamma only lowers
+ * values, so the channel-sum current estimate stays an upper bound.
+ *
+ * Output Backends:
+ * With LED_ASYNC_OUTPUT_ENABLED, frames are encoded into RMT symbols and sent
+ * by RmtLedOutput without blocking (showAsync), double-buffered so the next
+ * frame can be rendered and encoded while the previous one is on the wire.
+ * Otherwise FastLED.show() sends the frame and blocks until done.
+ *
+ * Parallel Outputs:
+ * A chain of panels can be split across several data pins (Layout::OUTPUTS).
+ * Each output drives a contiguous range of whole panels and all outputs
+ * send at the same time, so the refresh time is set by the largest segment
+ * instead of the whole chain (see host/refresh_model for projections).
+ * The ESP32-C6 has two RMT TX channels, so up to two outputs are supported.
+ *
+ * Crossfades:
+ * holdFrame() keeps the frame on display; until the crossfade amount is
+ * back at FrameBlend::FULL, each new frame is blended over the held one
+ * right before it is sent (see FrameBlend).
  */
+template <uint16_t Width, uint16_t Height, typename Layout>
 class LedDisplay {
+    static_assert(Layout::WIDTH == Width && Layout::HEIGHT == Height,
+                  "Layout size must match the display size");
+
 public:
     // LED matrix dimensions
-    static constexpr uint8_t LED_MATRIX_HEIGHT = 16;
-    static constexpr uint8_t LED_MATRIX_WIDTH = 16;
+    static constexpr uint16_t LED_MATRIX_HEIGHT = Height;
+    static constexpr uint16_t LED_MATRIX_WIDTH = Width;
 
     LedDisplay() = default;
 
@@ -27,52 +82,360 @@ public:
      * Initialize the LED matrix
      */
     void begin() {
-        // Apply color correction for more natural white balance
-        auto correction = CRGB(0xFF, 0xFF, 0xF3);
-        FastLED.addLeds<WS2812B, LED_DIN, GRB>(leds, LED_MATRIX_NUM_LEDS).setCorrection(correction);
-        FastLED.setBrightness(LED_BRIGHTNESS);
+#if LED_ASYNC_OUTPUT_ENABLED
+        for (uint8_t i = 0; i < Layout::OUTPUTS; i++) {
+            if (!outputs[i].begin(LED_DIN_PINS[i])) {
+                Serial.printf("RMT LED output %u initialization failed\n", i);
+            }
+            outputs[i].setDoneCallback(&LedDisplay::onOutputDone, this);
+        }
+#else
+        addControllers(std::make_index_sequence<Layout::OUTPUTS>());
+        // Levels are final: OutputLut applies brightness and dithering
+        FastLED.setBrightness(255);
+        FastLED.setDither(DISABLE_DITHER);
+#endif
+    }
+
+    /**
+     * Limit the LED brightness (e.g. when the battery is low)
+     * Takes effect on the next show().
+     *
+     * @param scale Fraction of the maximum brightness (255 = full)
+     */
+    void setBrightnessLimit(uint8_t scale) {
+        brightnessCeiling = (uint8_t)((MAX_BRIGHTNESS * (scale + 1)) >> 8);
+    }
+
+    /**
+     * Set the LED current budget used to choose the brightness of each frame
+     *
+     * @param milliamps Maximum current for lit LEDs (mA, excluding idle current)
+     */
+    void setPowerBudget(uint16_t milliamps) {
+        powerBudget = milliamps;
+    }
+
+    /**
+     * Get the estimated LED current of the last frame
+     *
+     * @return Current for lit LEDs at the chosen brightness (mA)
+     */
+    uint16_t getEstimatedCurrent() const {
+        return estimatedCurrent;
+    }
+
+    /**
+     * Keep the frame currently shown as the start of a crossfade
+     */
+    void holdFrame() {
+        memcpy(heldFrame, leds, sizeof(heldFrame));
+    }
+
+    /**
+     * Set how much of each new frame is shown over the held frame
+     * Takes effect on the next show().
+     *
+     * @param amount 0 = held frame only, FrameBlend::FULL = new frame only
+     */
+    void setCrossfade(uint16_t amount) {
+        crossfade = amount;
+    }
+
+    /**
+     * Display a prerendered animation frame on the LED matrix
+     * Returns after the frame has been sent.
+     *
+     * @param frame Encoded frame of Width x Height pixels (see asset_format.h)
+     */
+    void showFrame(const AssetFrame& frame) {
+        showFrameAsync(frame);
+        waitForIdle();
+    }
+
+    /**
+     * Start displaying a prerendered animation frame on the LED matrix
+     *
+     * The frame is read directly from flash and decoded and remapped into
+     * leds[] in a single pass, without going through a sprite. Returns as
+     * soon as the transfer has started, like showAsync().
+     *
+     * @param frame Encoded frame of Width x Height pixels (see asset_format.h)
+     */
+    void showFrameAsync(const AssetFrame& frame) {
+        static_assert(sizeof(CRGB) == 3, "CRGB must be packed R, G, B bytes");
+        if (frame.pixelCount != LED_MATRIX_NUM_LEDS ||
+            !FrameDecoder::decode(frame, layoutTable<Layout>.data(), reinterpret_cast<uint8_t*>(leds))) {
+            return;
+        }
+        present();
+    }
+
+    /**
+     * Interpolate an in-between frame of two prerendered frames into leds[]
+     *
+     * Interpolates in linear light (see FrameBlend::interpolate()) but sends
+     * nothing, so the caller can time the interpolation apart from the
+     * transfer. Start the transfer with presentAsync().
+     *
+     * @param from Earlier frame
+     * @param to Later frame
+     * @param amount Position between the frames (0 = from, FrameBlend::STEPS = to)
+     * @return false if the frames cannot be interpolated (leds[] unchanged)
+     */
+    bool blendFrames(const AssetFrame& from, const AssetFrame& to, uint8_t amount) {
+        return from.pixelCount == LED_MATRIX_NUM_LEDS &&
+               FrameBlend::interpolate(from, to, amount, layoutTable<Layout>.data(), reinterpret_cast<uint8_t*>(leds));
+    }
+
+    /**
+     * Start displaying the frame prepared by blendFrames()
+     * Returns as soon as the transfer has started, like showAsync().
+     */
+    void presentAsync() {
+        present();
+    }
+
+    /**
+     * Start displaying the visible part of a text marquee
+     * Returns as soon as the transfer has started, like showAsync().
+     *
+     * @param marquee TextMarquee of Width x Height pixels
+     */
+    template <typename Marquee>
+    void showMarqueeAsync(const Marquee& marquee) {
+        marquee.render(layoutTable<Layout>.data(), reinterpret_cast<uint8_t*>(leds));
+        present();
     }
 
     /**
      * Display sprite contents on the LED matrix
+     * Returns after the frame has been sent.
      * 
      * @param sprite LovyanGFX sprite containing the image to display
      */
     void show(LGFX_Sprite& sprite) {
+        showAsync(sprite);
+        waitForIdle();
+    }
+
+    /**
+     * Start displaying sprite contents on the LED matrix
+     * With the asynchronous backend this returns as soon as the transfer has
+     * started; otherwise it behaves like show().
+     *
+     * @param sprite LovyanGFX sprite containing the image to display
+     */
+    void showAsync(LGFX_Sprite& sprite) {
         // Iterate through each pixel in the sprite
-        for (auto y = 0; y < LED_MATRIX_WIDTH; y++) {
-            for (auto x = 0; x < LED_MATRIX_WIDTH; x++) {
+        const uint16_t* ledIndex = layoutTable<Layout>.data();
+        for (uint16_t y = 0; y < LED_MATRIX_HEIGHT; y++) {
+            for (uint16_t x = 0; x < LED_MATRIX_WIDTH; x++) {
                 // Read pixel color from sprite (RGB888 format)
                 auto rgb888 = sprite.readPixelRGB(x, y);
-                // Convert to FastLED CRGB format
-                auto rgb = CRGB(rgb888.r, rgb888.g, rgb888.b);
-
-                // Rotate coordinates 90° (swap x and y)
-                auto ix = y;
-                auto iy = x;
-                // Map to zigzag LED array index
-                // Even rows: left to right, Odd rows: right to left
-                leds[(iy % 2 ? LED_MATRIX_WIDTH - ix - 1 : ix) + iy * LED_MATRIX_WIDTH] = rgb;
+                // Convert to FastLED CRGB format and store at the mapped LED
+                leds[*ledIndex++] = CRGB(rgb888.r, rgb888.g, rgb888.b);
             }
         }
+        present();
+    }
 
-        // Update the physical LED matrix
-        FastLED.show();
+    /**
+     * Wait until the last frame has been sent to the LEDs
+     *
+     * @return true if idle, false on timeout
+     */
+    bool waitForIdle() {
+#if LED_ASYNC_OUTPUT_ENABLED
+        bool idle = true;
+        for (auto& output : outputs) {
+            idle = output.waitForIdle(FRAME_TIMEOUT_MS) && idle;
+        }
+        return idle;
+#else
+        return true;
+#endif
+    }
+
+#if LED_ASYNC_OUTPUT_ENABLED
+    /**
+     * Register a frame-sent notification (runs in interrupt context)
+     * Called once all outputs have finished sending the frame.
+     *
+     * @param callback Function to call, or nullptr
+     * @param arg Argument passed to the callback
+     */
+    void setFrameDoneCallback(RmtLedOutput::DoneCallback callback, void* arg) {
+        frameDoneArg = arg;
+        frameDoneCallback = callback;
     }
+#endif
 
 private:
     /**
      * LED Matrix Configuration
      */
-    // Data input pin for LED matrix
-    static constexpr uint8_t LED_DIN = D7;
+    // Data pins, one per output (the first output drives the start of the chain)
+    static constexpr uint8_t LED_DIN_PINS[] = {D7, D6};
+    static_assert(sizeof(LED_DIN_PINS) == LED_MAX_OUTPUTS, "One LED data pin per output");
+    static_assert(Layout::OUTPUTS <= sizeof(LED_DIN_PINS), "Not enough LED data pins for the layout");
     // Total number of LEDs in the matrix
     static constexpr uint16_t LED_MATRIX_NUM_LEDS = LED_MATRIX_WIDTH * LED_MATRIX_HEIGHT;
-    // LED brightness level (0-255, set to ~5% to reduce power consumption)
-    static constexpr uint8_t LED_BRIGHTNESS = 13;
+    // Highest brightness used for sparse frames (0-255, ~38%)
+    static constexpr uint8_t MAX_BRIGHTNESS = 96;
+    // Default current budget for lit LEDs (a full white frame at the old
+    // fixed brightness of 13 drew about 550 mA)
+    static constexpr uint16_t DEFAULT_POWER_BUDGET_MA = 300;
+    // WS2812B current per color channel at full value (mA, average of R/G/B)
+    static constexpr uint32_t MA_PER_CHANNEL = 14;
+    // Color correction for more natural white balance (R, G, B)
+    static constexpr uint8_t COLOR_CORRECTION[3] = {0xFF, 0xFF, 0xF3};
+    // Gamma from frame values to LED light
+    static constexpr float OUTPUT_GAMMA = 2.2f;
+
+    // LED array buffer (word aligned for the channel sum)
+    alignas(4) CRGB leds[LED_MATRIX_NUM_LEDS];
+    // Start of the current crossfade and the weight of new frames
+    alignas(4) uint8_t heldFrame[sizeof(leds)];
+    uint16_t crossfade = FrameBlend::FULL;
+    // Fused gamma/correction tables and carried dithering fractions
+    OutputLut outputLut{OUTPUT_GAMMA};
+    uint8_t ditherError[sizeof(leds)] = {};
+    // Brightness limit set by the power governor
+    uint8_t brightnessCeiling = MAX_BRIGHTNESS;
+    uint16_t powerBudget = DEFAULT_POWER_BUDGET_MA;
+    uint16_t estimatedCurrent = 0;
+
+#if LED_ASYNC_OUTPUT_ENABLED
+    // Encoded frame size (all segments, each with a reset symbol) and send
+    // timeout of one segment (256 LEDs take 7.7-8.3 ms)
+    static constexpr size_t FRAME_SYMBOLS =
+        LED_MATRIX_NUM_LEDS * Ws2812Encoder::SYMBOLS_PER_LED + Layout::OUTPUTS;
+    static constexpr uint32_t FRAME_TIMEOUT_MS = 50;
+
+    RmtLedOutput outputs[Layout::OUTPUTS];
+    // Double-buffered encoded frames
+    uint32_t frameSymbols[2][FRAME_SYMBOLS];
+    uint8_t backBuffer = 0;
+    // Outputs still sending the current frame
+    std::atomic<uint8_t> pendingOutputs{0};
+    RmtLedOutput::DoneCallback frameDoneCallback = nullptr;
+    void* frameDoneArg = nullptr;
+
+    /**
+     * Position of an output's segment in the encoded frame
+     */
+    static constexpr size_t segmentOffset(uint8_t output) {
+        return Layout::segment(output).first * Ws2812Encoder::SYMBOLS_PER_LED + output;
+    }
+
+    /**
+     * Output-done interrupt: notify once the last segment has been sent
+     */
+    static void IRAM_ATTR onOutputDone(void* arg) {
+        auto* self = static_cast<LedDisplay*>(arg);
+        if (self->pendingOutputs.fetch_sub(1) == 1 && self->frameDoneCallback) {
+            self->frameDoneCallback(self->frameDoneArg);
+        }
+    }
+#else
+    // LED levels handed to FastLED
+    CRGB outputLeds[LED_MATRIX_NUM_LEDS];
+
+    /**
+     * Register one FastLED controller per output
+     * FastLED's RMT driver sends the controllers of one show() in parallel.
+     */
+    template <size_t... Output>
+    void addControllers(std::index_sequence<Output...>) {
+        (FastLED.addLeds<WS2812B, LED_DIN_PINS[Output], GRB>(outputLeds + Layout::segment(Output).first,
+                                                             Layout::segment(Output).count),
+         ...);
+    }
+#endif
+
+    /**
+     * Send the contents of leds[] to the LED matrix
+     */
+    void present() {
+        FrameBlend::crossfade(heldFrame, reinterpret_cast<uint8_t*>(leds), sizeof(leds), crossfade);
+        // Choose the brightness for this frame's power draw
+        uint8_t brightness = selectBrightness(sumChannels());
+        outputLut.setScale(brightness, COLOR_CORRECTION);
+
+#if LED_ASYNC_OUTPUT_ENABLED
+        // Encode into the buffer that is not on the wire, then send it
+        // Each segment is followed by its own reset symbol
+        uint32_t* symbols = frameSymbols[backBuffer];
+        for (uint8_t i = 0; i < Layout::OUTPUTS; i++) {
+            LedSegment segment = Layout::segment(i);
+            Ws2812Encoder::encode(reinterpret_cast<const uint8_t*>(leds + segment.first), segment.count, outputLut,
+                                  ditherError + segment.first * 3, symbols + segmentOffset(i));
+        }
+        waitForIdle();
+        // Start all outputs back to back so the segments are sent in parallel
+        pendingOutputs = Layout::OUTPUTS;
+        for (uint8_t i = 0; i < Layout::OUTPUTS; i++) {
+            outputs[i].transmit(symbols + segmentOffset(i), Ws2812Encoder::frameSymbols(Layout::segment(i).count));
+        }
+        backBuffer ^= 1;
+#else
+        outputLut.map(reinterpret_cast<const uint8_t*>(leds), LED_MATRIX_NUM_LEDS, ditherError,
+                      reinterpret_cast<uint8_t*>(outputLeds));
+        // Update the physical LED matrix
+        FastLED.show();
+#endif
+    }
 
-    // LED array buffer
-    CRGB leds[LED_MATRIX_NUM_LEDS];
+    /**
+     * Sum all color channel values in leds[]
+     *
+     * Reads the buffer as 32-bit words and adds bytes in SWAR fashion: the
+     * even and odd bytes of each word are masked into two 16-bit lanes and
+     * added in a single operation. Lanes are flushed before they can overflow
+     * (64 words x 2 x 255 < 65536).
+     *
+     * @return Sum of R, G and B over all LEDs
+     */
+    uint32_t sumChannels() const {
+        static_assert(sizeof(leds) % 4 == 0, "LED buffer must be a whole number of words");
+        constexpr uint16_t WORDS = sizeof(leds) / 4;
+        constexpr uint16_t FLUSH_INTERVAL = 64;
+
+        const auto* bytes = reinterpret_cast<const uint8_t*>(leds);
+        uint32_t total = 0;
+        for (uint16_t start = 0; start < WORDS; start += FLUSH_INTERVAL) {
+            uint16_t end = start + FLUSH_INTERVAL < WORDS ? start + FLUSH_INTERVAL : WORDS;
+            uint32_t lanes = 0;
+            for (uint16_t i = start; i < end; i++) {
+                uint32_t word;
+                memcpy(&word, bytes + i * 4, 4);
+                lanes += (word & 0x00FF00FF) + ((word >> 8) & 0x00FF00FF);
+            }
+            total += (lanes & 0xFFFF) + (lanes >> 16);
+        }
+        return total;
+    }
+
+    /**
+     * Choose the highest brightness whose current fits the power budget
+     *
+     * @param channelSum Sum of R, G and B over all LEDs
+     * @return Brightness (0-255)
+     */
+    uint8_t selectBrightness(uint32_t channelSum) {
+        // Current at full brightness (mA x 255)
+        uint32_t fullCurrent = channelSum * MA_PER_CHANNEL;
+        uint32_t brightness = brightnessCeiling;
+        if (fullCurrent * brightness > (uint32_t)powerBudget * 255 * 255) {
+            brightness = (uint32_t)powerBudget * 255 * 255 / fullCurrent;
+        }
+        estimatedCurrent = (uint16_t)(fullCurrent * brightness / (255 * 255));
+        return (uint8_t)brightness;
+    }
 };
 
+// The robot's single 16x16 panel
+using RobotLedDisplay = LedDisplay<16, 16, RobotPanelLayout>;
+
 #endif // LED_DISPLAY_HPP
@@ -0,0 +1,221 @@
+#ifndef LED_LAYOUT_HPP
+#define LED_LAYOUT_HPP
+
+#include <array>
+#include <stdint.h>
+
+/**
+ * LED Matrix Layout Policies
+ *
+ * Describe how display pixels (x to the right, y down, as drawn in the
+ * sprite) map to positions in the LED chain. A layout is assembled from
+ * policies at compile time:
+ *
+ * - Order:       wiring inside one panel (Serpentine or Progressive rows)
+ * - Orientation: rotation and mirroring of each panel
+ * - Tiling:      N x M panels chained together
+ * - Outputs:     number of data pins the chain is split across
+ *
+ * For each layout, layoutTable<Layout> is a constexpr table from display
+ * pixel (y * WIDTH + x) to LED index, so every layout costs a single table
+ * lookup per pixel at run time.
+ */
+
+/**
+ * Row order inside a panel: even rows left-to-right, odd rows right-to-left
+ */
+struct Serpentine {
+    static constexpr uint16_t index(uint16_t px, uint16_t py, uint16_t panelWidth) {
+        return py * panelWidth + (py % 2 ? panelWidth - 1 - px : px);
+    }
+};
+
+/**
+ * Row order inside a panel: every row left-to-right
+ */
+struct Progressive {
+    static constexpr uint16_t index(uint16_t px, uint16_t py, uint16_t panelWidth) {
+        return py * panelWidth + px;
+    }
+};
+
+/**
+ * Panel Rotation (clockwise, display -> panel)
+ */
+enum class Rotation : uint8_t {
+    R0 = 0,
+    R90 = 1,
+    R180 = 2,
+    R270 = 3
+};
+
+/**
+ * Panel orientation: rotation followed by mirroring in panel coordinates
+ *
+ * @tparam Rot Rotation of the panel
+ * @tparam MirrorX Mirror panel columns
+ * @tparam MirrorY Mirror panel rows
+ */
+template <Rotation Rot = Rotation::R0, bool MirrorX = false, bool MirrorY = false>
+struct Orientation {
+    // Rotated panels swap their width and height on the display
+    static constexpr bool SWAPS_AXES = Rot == Rotation::R90 || Rot == Rotation::R270;
+
+    /**
+     * Map tile-local display coordinates to panel coordinates
+     *
+     * @param lx, ly Display coordinates inside the tile
+     * @param tileWidth, tileHeight Tile size on the display
+     * @param px, py Receive panel column and row
+     */
+    static constexpr void map(uint16_t lx, uint16_t ly, uint16_t tileWidth, uint16_t tileHeight,
+                              uint16_t& px, uint16_t& py) {
+        switch (Rot) {
+        case Rotation::R90:
+            px = ly;
+            py = tileWidth - 1 - lx;
+            break;
+        case Rotation::R180:
+            px = tileWidth - 1 - lx;
+            py = tileHeight - 1 - ly;
+            break;
+        case Rotation::R270:
+            px = tileHeight - 1 - ly;
+            py = lx;
+            break;
+        default:
+            px = lx;
+            py = ly;
+            break;
+        }
+        uint16_t panelWidth = SWAPS_AXES ? tileHeight : tileWidth;
+        uint16_t panelHeight = SWAPS_AXES ? tileWidth : tileHeight;
+        if (MirrorX) {
+            px = panelWidth - 1 - px;
+        }
+        if (MirrorY) {
+            py = panelHeight - 1 - py;
+        }
+    }
+};
+
+/**
+ * Panel chaining: TilesX x TilesY panels, chained row by row from the top left
+ *
+ * @tparam TilesX Panels per row
+ * @tparam TilesY Panel rows
+ * @tparam SerpentineChain Odd panel rows are chained right-to-left
+ */
+template <uint8_t TilesX = 1, uint8_t TilesY = 1, bool SerpentineChain = false>
+struct Tiling {
+    static constexpr uint8_t TILES_X = TilesX;
+    static constexpr uint8_t TILES_Y = TilesY;
+
+    static constexpr uint16_t tileIndex(uint16_t tx, uint16_t ty) {
+        return ty * TilesX + (SerpentineChain && ty % 2 ? TilesX - 1 - tx : tx);
+    }
+};
+
+/**
+ * Range of the LED chain driven by one data output
+ */
+struct LedSegment {
+    uint16_t first; // Index of the first LED in leds[]
+    uint16_t count; // Number of LEDs
+};
+
+// Data outputs the robot can drive in parallel (one RMT TX channel and
+// data pin each on the ESP32-C6)
+static constexpr uint8_t LED_MAX_OUTPUTS = 2;
+
+/**
+ * Split a chain of panels across several outputs
+ * Panels are distributed as evenly as possible; earlier outputs get the
+ * extra panel when the split is uneven. Each output drives a contiguous
+ * range of the chain, so the refresh time is set by the largest segment.
+ *
+ * @param panelCount Number of panels in the chain
+ * @param panelLeds LEDs per panel
+ * @param outputs Number of outputs
+ * @param output Output to get the segment of
+ * @return LED range of the output
+ */
+constexpr LedSegment outputSegment(uint16_t panelCount, uint16_t panelLeds, uint8_t outputs, uint8_t output) {
+    uint16_t base = panelCount / outputs;
+    uint16_t extra = panelCount % outputs;
+    uint16_t firstPanel = output * base + (output < extra ? output : extra);
+    uint16_t panels = base + (output < extra ? 1 : 0);
+    return {(uint16_t)(firstPanel * panelLeds), (uint16_t)(panels * panelLeds)};
+}
+
+/**
+ * Complete layout of one or more identical panels
+ *
+ * @tparam PanelWidth LEDs per panel row (as wired)
+ * @tparam PanelHeight LED rows per panel (as wired)
+ * @tparam Order Serpentine or Progressive
+ * @tparam PanelOrientation Orientation<...>
+ * @tparam PanelTiling Tiling<...>
+ * @tparam Outputs Number of data outputs driven in parallel
+ */
+template <uint16_t PanelWidth, uint16_t PanelHeight, typename Order = Serpentine,
+          typename PanelOrientation = Orientation<>, typename PanelTiling = Tiling<>, uint8_t Outputs = 1>
+struct PanelLayout {
+    static constexpr uint16_t PANEL_LEDS = PanelWidth * PanelHeight;
+    static constexpr uint16_t PANEL_COUNT = PanelTiling::TILES_X * PanelTiling::TILES_Y;
+    static constexpr uint8_t OUTPUTS = Outputs;
+    static_assert(Outputs >= 1 && Outputs <= PANEL_COUNT, "Each output needs at least one panel");
+    // Size of one panel on the display
+    static constexpr uint16_t TILE_WIDTH = PanelOrientation::SWAPS_AXES ? PanelHeight : PanelWidth;
+    static constexpr uint16_t TILE_HEIGHT = PanelOrientation::SWAPS_AXES ? PanelWidth : PanelHeight;
+    // Size of the whole display
+    static constexpr uint16_t WIDTH = TILE_WIDTH * PanelTiling::TILES_X;
+    static constexpr uint16_t HEIGHT = TILE_HEIGHT * PanelTiling::TILES_Y;
+    static constexpr uint16_t LED_COUNT = WIDTH * HEIGHT;
+
+    /**
+     * LED index of a display pixel (compile-time; use layoutTable at run time)
+     */
+    static constexpr uint16_t index(uint16_t x, uint16_t y) {
+        uint16_t tile = PanelTiling::tileIndex(x / TILE_WIDTH, y / TILE_HEIGHT);
+        uint16_t px = 0;
+        uint16_t py = 0;
+        PanelOrientation::map(x % TILE_WIDTH, y % TILE_HEIGHT, TILE_WIDTH, TILE_HEIGHT, px, py);
+        return tile * PANEL_LEDS + Order::index(px, py, PanelWidth);
+    }
+
+    /**
+     * LED range driven by one output
+     *
+     * @param output Output number (0 to OUTPUTS - 1)
+     */
+    static constexpr LedSegment segment(uint8_t output) {
+        return outputSegment(PANEL_COUNT, PANEL_LEDS, Outputs, output);
+    }
+};
+
+/**
+ * Build the display pixel -> LED index table of a layout
+ */
+template <typename Layout>
+constexpr std::array<uint16_t, Layout::LED_COUNT> buildLayoutTable() {
+    std::array<uint16_t, Layout::LED_COUNT> table = {};
+    for (uint16_t y = 0; y < Layout::HEIGHT; y++) {
+        for (uint16_t x = 0; x < Layout::WIDTH; x++) {
+            table[y * Layout::WIDTH + x] = Layout::index(x, y);
+        }
+    }
+    return table;
+}
+
+// Display pixel (y * WIDTH + x) -> LED index, evaluated at compile time
+template <typename Layout>
+inline constexpr std::array<uint16_t, Layout::LED_COUNT> layoutTable = buildLayoutTable<Layout>();
+
+/**
+ * Layout of the robot's 16x16 panel: serpentine rows, mounted so that
+ * display columns run along the LED rows (rotated 90° and mirrored)
+ */
+using RobotPanelLayout = PanelLayout<16, 16, Serpentine, Orientation<Rotation::R90, false, true>>;
+
+#endif // LED_LAYOUT_HPP
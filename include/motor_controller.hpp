@@ -1,6 +1,8 @@
 #ifndef MOTOR_CONTROLLER_HPP
 #define MOTOR_CONTROLLER_HPP
 
+#include <atomic>
+
 /**
  * MotorController Class
  * 
@@ -47,6 +49,7 @@ public:
      * @param direction Movement direction from constants.h
      */
     void executeCommand(Direction direction) {
+        activeDirection = direction;
         switch (direction) {
         case Direction::STOP:
             stop();
@@ -65,6 +68,7 @@ public:
             break;
         default:
             // Unknown command: stop for safety
+            activeDirection = Direction::STOP;
             stop();
             break;
         }
@@ -74,6 +78,8 @@ public:
      * Stop both motors
      */
     void stop() {
+        activeSpeed = MotorSpeed{0, 0};
+        appliedDuty = MotorSpeed{0, 0};
         digitalWrite(AIN1, LOW);
         digitalWrite(AIN2, LOW);
         digitalWrite(BIN1, LOW);
@@ -84,6 +90,7 @@ public:
      * Move the robot forward
      */
     void moveForward() {
+        activeSpeed = SPEED_FORWARD;
         setMotorSpeed(SPEED_FORWARD.motorA, SPEED_FORWARD.motorB);
         digitalWrite(AIN1, HIGH);
         digitalWrite(AIN2, LOW);
@@ -95,6 +102,7 @@ public:
      * Move the robot backward
      */
     void moveBackward() {
+        activeSpeed = SPEED_BACKWARD;
         setMotorSpeed(SPEED_BACKWARD.motorA, SPEED_BACKWARD.motorB);
         digitalWrite(AIN1, LOW);
         digitalWrite(AIN2, HIGH);
@@ -106,6 +114,7 @@ public:
      * Turn the robot left
      */
     void turnLeft() {
+        activeSpeed = SPEED_TURN_LEFT;
         setMotorSpeed(SPEED_TURN_LEFT.motorA, SPEED_TURN_LEFT.motorB);
         digitalWrite(AIN1, LOW);
         digitalWrite(AIN2, HIGH);
@@ -117,6 +126,7 @@ public:
      * Turn the robot right
      */
     void turnRight() {
+        activeSpeed = SPEED_TURN_RIGHT;
         setMotorSpeed(SPEED_TURN_RIGHT.motorA, SPEED_TURN_RIGHT.motorB);
         digitalWrite(AIN1, HIGH);
         digitalWrite(AIN2, LOW);
@@ -124,6 +134,65 @@ public:
         digitalWrite(BIN2, LOW);
     }
 
+    /**
+     * Get the open-loop PWM duties of the command being executed
+     *
+     * @return Duties set by the last command ({0, 0} when stopped)
+     */
+    MotorSpeed getActiveSpeed() const {
+        return activeSpeed.load();
+    }
+
+    /**
+     * Get the PWM duties written to the driver
+     * Unlike getActiveSpeed(), these include the duty limit and, under
+     * closed-loop control, come from the speed loop.
+     *
+     * @return Duties the motors are running at ({0, 0} when stopped)
+     */
+    MotorSpeed getAppliedDuty() const {
+        return appliedDuty.load();
+    }
+
+    /**
+     * Get the direction of the command being executed
+     *
+     * @return Direction set by the last command
+     */
+    Direction getActiveDirection() const {
+        return activeDirection.load();
+    }
+
+    /**
+     * Override the PWM duties without changing motor directions
+     * Used by closed-loop speed control, which calls this every period; the
+     * duty limit is applied on top.
+     *
+     * @param speedA PWM value for motor A (0-255)
+     * @param speedB PWM value for motor B (0-255)
+     */
+    void applyDuty(uint8_t speedA, uint8_t speedB) {
+        closedLoop.store(true);
+        setMotorSpeed(speedA, speedB);
+    }
+
+    /**
+     * Scale all PWM duties down (e.g. when the battery is low)
+     * Both motors are scaled by the same factor so the robot keeps its line.
+     * Open-loop duties are rescaled at once; under closed-loop control the
+     * speed loop applies the new limit with its next duty, so its output is
+     * never replaced by the open-loop duty.
+     *
+     * @param scale Fraction of the commanded duty (255 = full)
+     */
+    void setDutyLimit(uint8_t scale) {
+        dutyLimit.store(scale);
+        MotorSpeed speed = activeSpeed.load();
+        if (!closedLoop.load() && (speed.motorA != 0 || speed.motorB != 0)) {
+            setMotorSpeed(speed.motorA, speed.motorB);
+        }
+    }
+
 private:
     /**
      * Motor Control Pin Definitions
@@ -141,6 +210,17 @@ private:
     // Motor B PWM control (speed control)
     static constexpr uint8_t PWMB = D5;
 
+    // Direction and open-loop duties of the current command (also read by
+    // the pose estimator and telemetry from the esp_timer task)
+    std::atomic<Direction> activeDirection{Direction::STOP};
+    std::atomic<MotorSpeed> activeSpeed{MotorSpeed{0, 0}};
+    // Duties last written to the PWM pins (after the duty limit)
+    std::atomic<MotorSpeed> appliedDuty{MotorSpeed{0, 0}};
+    // PWM scale set by the power governor (255 = full)
+    std::atomic<uint8_t> dutyLimit{255};
+    // Duties come from the speed loop (see applyDuty)
+    std::atomic<bool> closedLoop{false};
+
     /**
      * Set motor speeds using PWM
      * 
@@ -148,8 +228,11 @@ private:
      * @param speedB PWM value for motor B (0-255)
      */
     void setMotorSpeed(uint8_t speedA, uint8_t speedB) {
-        analogWrite(PWMA, speedA);
-        analogWrite(PWMB, speedB);
+        uint8_t limit = dutyLimit.load();
+        MotorSpeed duty = {(uint8_t)((speedA * (limit + 1)) >> 8), (uint8_t)((speedB * (limit + 1)) >> 8)};
+        appliedDuty = duty;
+        analogWrite(PWMA, duty.motorA);
+        analogWrite(PWMB, duty.motorB);
     }
 };
 
@@ -0,0 +1,212 @@
+#ifndef ODOMETRY_HPP
+#define ODOMETRY_HPP
+
+#include <stdint.h>
+#include "constants.h"
+
+/**
+ * Odometry Class
+ *
+ * Dead-reckoning pose estimator for the skid-steer crawler using integer
+ * arithmetic only. Each update takes the distance travelled by the left and
+ * right tracks and integrates the pose at the midpoint heading.
+ *
+ * Fixed-point Representation:
+ * - Heading: 32-bit binary angle (2^32 = one full turn), wraps naturally
+ * - Position: micrometers in Q15
+ *
+ * Each update still rounds: the heading step to one binary angle unit, the
+ * midpoint distance to 0.5 um, and TrackModel::fromDuty() to 1 um per
+ * track. At 50 Hz that is at most about 50 um/s per track, far below the
+ * error of the PWM track model (see TrackModel); the sine table adds less
+ * than 0.01%.
+ */
+class Odometry {
+public:
+    /**
+     * Pose in reporting units
+     */
+    struct Pose {
+        int32_t x;        // Forward of start position (mm)
+        int32_t y;        // Left of start position (mm)
+        uint16_t heading; // Counter-clockwise from start (65536 = 360 degrees)
+    };
+
+    /**
+     * Chassis Geometry
+     */
+    // Distance between track centers (micrometers)
+    static constexpr int32_t TRACK_GAUGE_UM = 85000;
+    // Fraction of differential track motion that becomes rotation (skid loss)
+    static constexpr double TURN_EFFICIENCY = 0.7;
+
+    Odometry() = default;
+
+    /**
+     * Integrate one step of track motion
+     *
+     * @param leftUm Distance travelled by the left track (micrometers)
+     * @param rightUm Distance travelled by the right track (micrometers)
+     */
+    void update(int32_t leftUm, int32_t rightUm) {
+        int32_t turn = (int32_t)(((int64_t)(rightUm - leftUm) * HEADING_PER_UM_Q8) >> 8);
+        int32_t distance = (leftUm + rightUm) / 2;
+
+        uint32_t midHeading = heading + (uint32_t)(turn / 2);
+        x += (int64_t)distance * cosQ15(midHeading);
+        y += (int64_t)distance * sinQ15(midHeading);
+        heading += (uint32_t)turn;
+    }
+
+    /**
+     * Get the current pose estimate
+     *
+     * @return Pose in millimeters and 16-bit binary angle
+     */
+    Pose getPose() const {
+        return {(int32_t)(x / (1000 << 15)), (int32_t)(y / (1000 << 15)), (uint16_t)(heading >> 16)};
+    }
+
+    /**
+     * Reset the pose to the origin
+     */
+    void reset() {
+        x = 0;
+        y = 0;
+        heading = 0;
+    }
+
+    /**
+     * Sine of a binary angle
+     *
+     * @param angle 32-bit binary angle
+     * @return sin(angle) in Q15
+     */
+    static int32_t sinQ15(uint32_t angle) {
+        uint32_t quadrant = angle >> 30;
+        // Position within the quadrant: 6-bit table index + 16-bit fraction
+        uint32_t position = (angle >> 8) & 0x3FFFFF;
+        if (quadrant & 1) {
+            position = (64u << 16) - position;
+        }
+
+        uint32_t index = position >> 16;
+        int32_t value = SINE_TABLE[index];
+        if (index < 64) {
+            uint32_t fraction = position & 0xFFFF;
+            value += ((SINE_TABLE[index + 1] - value) * (int32_t)fraction) >> 16;
+        }
+        return quadrant & 2 ? -value : value;
+    }
+
+    /**
+     * Cosine of a binary angle
+     *
+     * @param angle 32-bit binary angle
+     * @return cos(angle) in Q15
+     */
+    static int32_t cosQ15(uint32_t angle) {
+        return sinQ15(angle + (1u << 30));
+    }
+
+private:
+    // Binary angle units per micrometer of track difference (Q8)
+    static constexpr int64_t HEADING_PER_UM_Q8 =
+        (int64_t)(4294967296.0 / (2.0 * 3.14159265358979 * TRACK_GAUGE_UM) * TURN_EFFICIENCY * 256.0);
+
+    // First quadrant of sin() in Q15, 64 steps
+    static constexpr int16_t SINE_TABLE[65] = {
+        0, 804, 1608, 2410, 3212, 4011, 4808, 5602,
+        6393, 7179, 7962, 8739, 9512, 10278, 11039, 11793,
+        12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+        18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+        23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+        27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+        30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+        32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+        32767,
+    };
+
+    int64_t x = 0;         // Micrometers, Q15
+    int64_t y = 0;         // Micrometers, Q15
+    uint32_t heading = 0;  // Binary angle
+};
+
+/**
+ * TrackModel Class
+ *
+ * Converts what the firmware knows about the tracks into travelled distance
+ * for Odometry: either encoder counts, or (without encoders) the applied PWM
+ * duties through a linear speed model.
+ *
+ * Motor A drives the left track and motor B the right track.
+ *
+ * The PWM model constants are nominal starting values, not measurements:
+ * motor B's higher deadband reflects its stiffer gearbox (see
+ * MotorController::SPEED_FORWARD). Calibrate both motors the same way on
+ * the floor: drive one track at two duties for a fixed time, measure the
+ * distance, and take the deadband and speed gain from the line through
+ * the two points. The model is linear per motor and ignores how skid load
+ * slows the tracks while turning, so the pose stays approximate.
+ */
+class TrackModel {
+public:
+    /**
+     * Calibration (nominal; measure on the floor and adjust)
+     */
+    // Track travel per encoder pulse (micrometers)
+    static constexpr int32_t UM_PER_COUNT = 196;
+    // Duty below which a motor does not move
+    static constexpr int32_t DEADBAND_A = 20;
+    static constexpr int32_t DEADBAND_B = 100;
+    // Track speed per duty step above the deadband (micrometers per second)
+    static constexpr int32_t UM_PER_S_PER_DUTY_A = 1360;
+    static constexpr int32_t UM_PER_S_PER_DUTY_B = 970;
+
+    /**
+     * Get the direction of each track for a command
+     *
+     * @param direction Movement direction from constants.h
+     * @param left Receives +1 (forward), -1 (backward) or 0 for the left track
+     * @param right Receives the same for the right track
+     */
+    static void trackSigns(Direction direction, int8_t& left, int8_t& right) {
+        switch (direction) {
+        case Direction::FORWARD:  left = 1;  right = 1;  break;
+        case Direction::BACKWARD: left = -1; right = -1; break;
+        case Direction::LEFT:     left = -1; right = 1;  break;
+        case Direction::RIGHT:    left = 1;  right = -1; break;
+        default:                  left = 0;  right = 0;  break;
+        }
+    }
+
+    /**
+     * Track distance from encoder counts
+     *
+     * @param counts Pulses during the step
+     * @param sign Track direction (+1, -1 or 0)
+     * @return Distance (micrometers)
+     */
+    static int32_t fromCounts(uint16_t counts, int8_t sign) {
+        return (int32_t)counts * UM_PER_COUNT * sign;
+    }
+
+    /**
+     * Track distance from applied PWM duty
+     *
+     * @param duty PWM duty (0-255)
+     * @param deadband Duty below which the motor does not move
+     * @param umPerSPerDuty Speed gain above the deadband
+     * @param sign Track direction (+1, -1 or 0)
+     * @param periodUs Step length (microseconds)
+     * @return Distance (micrometers)
+     */
+    static int32_t fromDuty(uint8_t duty, int32_t deadband, int32_t umPerSPerDuty, int8_t sign, uint32_t periodUs) {
+        if (duty <= deadband) {
+            return 0;
+        }
+        return (int32_t)((int64_t)(duty - deadband) * umPerSPerDuty * periodUs / 1000000) * sign;
+    }
+};
+
+#endif // ODOMETRY_HPP
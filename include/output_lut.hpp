@@ -0,0 +1,107 @@
+#ifndef OUTPUT_LUT_HPP
+#define OUTPUT_LUT_HPP
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * OutputLut Class
+ *
+ * Maps frame values to LED drive levels with one table lookup and one
+ * multiply per channel: gamma and color correction are fused into a
+ * per-channel table of 8.8 fixed-point levels at full brightness, built
+ * once, and the brightness of each frame scales the looked-up level. The
+ * brightness can change every frame (see LedDisplay's power budget)
+ * without touching the tables. The fraction that an 8-bit LED cannot show
+ * is carried over to the next frame per LED and channel (temporal error
+ * diffusion), so at low brightness a dim shade alternates between
+ * neighbouring levels instead of collapsing onto one of them.
+ *
+ * No hardware dependencies: used by LedDisplay and checked on the host
+ * (host/ws2812_check).
+ */
+class OutputLut {
+public:
+    /**
+     * @param gamma Exponent from frame values to LED light (1 = linear)
+     */
+    explicit OutputLut(float gamma) {
+        for (uint16_t value = 0; value < 256; value++) {
+            gammaTable[value] = (uint16_t)lroundf(powf(value / 255.0f, gamma) * 65535.0f);
+        }
+    }
+
+    /**
+     * Set the brightness and color correction
+     * The tables are only rebuilt when the correction changes, which it is
+     * expected not to do.
+     *
+     * @param brightness Brightness (0-255)
+     * @param correction Per-channel correction (R, G, B; 255 = full)
+     */
+    void setScale(uint8_t brightness, const uint8_t correction[3]) {
+        if (!built || memcmp(correction, currentCorrection, sizeof(currentCorrection)) != 0) {
+            for (uint8_t c = 0; c < 3; c++) {
+                // 8.8 level = light x correction (255.0 at full scale)
+                uint32_t scale = 255u * (correction[c] + 1);
+                for (uint16_t value = 0; value < 256; value++) {
+                    levels[c][value] = (uint16_t)((gammaTable[value] * scale + 32767) / 65535);
+                }
+            }
+            memcpy(currentCorrection, correction, sizeof(currentCorrection));
+            built = true;
+        }
+        // brightness / 255 in 0.16 fixed point (65536 at full brightness)
+        brightnessScale = ((uint32_t)brightness * 65536 + 127) / 255;
+    }
+
+    /**
+     * Map one channel value to its LED level for this frame
+     *
+     * @param channel Channel (0 = R, 1 = G, 2 = B)
+     * @param value Frame value
+     * @param error This LED channel's carried fraction, updated
+     * @return LED level (0-255)
+     */
+    uint8_t map(uint8_t channel, uint8_t value, uint8_t& error) const {
+        uint32_t level = getLevel(channel, value) + error;
+        error = (uint8_t)level;
+        return (uint8_t)(level >> 8);
+    }
+
+    /**
+     * Map a frame of RGB pixels
+     *
+     * @param rgb Pixel data, 3 bytes per LED in R, G, B order
+     * @param ledCount Number of LEDs
+     * @param error Carried fractions, 3 bytes per LED
+     * @param out LED levels, 3 bytes per LED in R, G, B order
+     */
+    void map(const uint8_t* rgb, size_t ledCount, uint8_t* error, uint8_t* out) const {
+        for (size_t i = 0; i < ledCount * 3; i += 3) {
+            out[i] = map(0, rgb[i], error[i]);
+            out[i + 1] = map(1, rgb[i + 1], error[i + 1]);
+            out[i + 2] = map(2, rgb[i + 2], error[i + 2]);
+        }
+    }
+
+    /**
+     * Get the 8.8 fixed-point level of a channel value (before dithering)
+     */
+    uint16_t getLevel(uint8_t channel, uint8_t value) const {
+        return (uint16_t)((levels[channel][value] * brightnessScale + 32768) >> 16);
+    }
+
+private:
+    // Frame value -> light (0-65535)
+    uint16_t gammaTable[256];
+    // Per channel: frame value -> LED level at full brightness (8.8 fixed point)
+    uint16_t levels[3][256] = {};
+    uint8_t currentCorrection[3] = {};
+    uint32_t brightnessScale = 0;
+    bool built = false;
+};
+
+#endif // OUTPUT_LUT_HPP
@@ -0,0 +1,82 @@
+#ifndef PARTITION_FLASH_HPP
+#define PARTITION_FLASH_HPP
+
+#include <Arduino.h>
+#include <esp_partition.h>
+
+/**
+ * PartitionFlash Class
+ *
+ * Flash access to a custom data partition (see partitions.csv), with
+ * offsets relative to the partition start. This is the Flash interface
+ * used by AssetSlots, AssetWriter and TraceLog (NorFlash on the host).
+ * map() gives read access through the flash cache, one range at a time.
+ */
+class PartitionFlash {
+public:
+    /**
+     * @param subtype Data partition subtype
+     * @param label Partition label
+     */
+    PartitionFlash(uint8_t subtype, const char* label) : subtype(subtype), label(label) {}
+
+    /**
+     * Find the partition
+     *
+     * @return true if the partition exists
+     */
+    bool begin() {
+        partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)subtype, label);
+        return partition != nullptr;
+    }
+
+    const esp_partition_t* getPartition() const {
+        return partition;
+    }
+
+    size_t size() const {
+        return partition ? partition->size : 0;
+    }
+
+    bool read(size_t offset, void* data, size_t len) {
+        return esp_partition_read(partition, offset, data, len) == ESP_OK;
+    }
+
+    bool write(size_t offset, const void* data, size_t len) {
+        return esp_partition_write(partition, offset, data, len) == ESP_OK;
+    }
+
+    bool erase(size_t offset, size_t len) {
+        return esp_partition_erase_range(partition, offset, len) == ESP_OK;
+    }
+
+    /**
+     * Map a range into the address space (unmaps the previous one)
+     *
+     * @return Start of the range, or nullptr if it could not be mapped
+     */
+    const void* map(size_t offset, size_t len) {
+        unmap();
+        const void* data = nullptr;
+        if (esp_partition_mmap(partition, offset, len, ESP_PARTITION_MMAP_DATA, &data, &mapping) != ESP_OK) {
+            mapping = 0;
+            return nullptr;
+        }
+        return data;
+    }
+
+    void unmap() {
+        if (mapping) {
+            esp_partition_munmap(mapping);
+            mapping = 0;
+        }
+    }
+
+private:
+    uint8_t subtype;
+    const char* label;
+    const esp_partition_t* partition = nullptr;
+    esp_partition_mmap_handle_t mapping = 0;
+};
+
+#endif // PARTITION_FLASH_HPP
@@ -0,0 +1,133 @@
+#ifndef POSE_ESTIMATOR_HPP
+#define POSE_ESTIMATOR_HPP
+
+#include <esp_timer.h>
+#include "constants.h"
+#include "motor_controller.hpp"
+#include "odometry.hpp"
+#include "protocol.h"
+#include "uplink.hpp"
+#if WHEEL_ENCODERS_ENABLED
+#include "wheel_speed_loop.hpp"
+#endif
+
+/**
+ * PoseEstimator Class
+ *
+ * Updates the dead-reckoning pose at a fixed rate and periodically reports
+ * it to the controller over ESP-NOW.
+ * Track motion comes from the wheel encoders when they are enabled, and
+ * otherwise from the applied PWM duties through TrackModel.
+ */
+class PoseEstimator {
+public:
+#if WHEEL_ENCODERS_ENABLED
+    PoseEstimator(MotorController& motors, Uplink& uplink, WheelSpeedLoop& speedLoop)
+        : motors(motors), uplink(uplink), speedLoop(speedLoop) {}
+#else
+    PoseEstimator(MotorController& motors, Uplink& uplink) : motors(motors), uplink(uplink) {}
+#endif
+
+    /**
+     * Start the periodic update timer
+     *
+     * @return true if initialization successful, false otherwise
+     */
+    bool begin() {
+        esp_timer_create_args_t timerArgs = {};
+        timerArgs.callback = &PoseEstimator::onTimer;
+        timerArgs.arg = this;
+        timerArgs.dispatch_method = ESP_TIMER_TASK;
+        timerArgs.name = "pose";
+        if (esp_timer_create(&timerArgs, &timer) != ESP_OK) {
+            return false;
+        }
+        return esp_timer_start_periodic(timer, UPDATE_PERIOD_US) == ESP_OK;
+    }
+
+    /**
+     * Get the latest pose estimate
+     */
+    Odometry::Pose getPose() const {
+        return odometry.getPose();
+    }
+
+private:
+    // Pose update period (20 ms = 50 Hz)
+    static constexpr uint32_t UPDATE_PERIOD_US = 20000;
+    // Send a report every N updates (25 = 2 reports per second)
+    static constexpr uint8_t REPORT_INTERVAL = 25;
+
+    MotorController& motors;
+    Uplink& uplink;
+#if WHEEL_ENCODERS_ENABLED
+    WheelSpeedLoop& speedLoop;
+    uint32_t lastCountsA = 0;
+    uint32_t lastCountsB = 0;
+#endif
+    Odometry odometry;
+    esp_timer_handle_t timer = nullptr;
+    uint8_t updatesSinceReport = 0;
+    uint8_t sequence = 0;
+
+    /**
+     * Timer callback trampoline
+     *
+     * @param arg Pointer to the PoseEstimator instance
+     */
+    static void onTimer(void* arg) {
+        static_cast<PoseEstimator*>(arg)->updateStep();
+    }
+
+    /**
+     * One update period: integrate track motion, report when due
+     */
+    void updateStep() {
+        auto direction = motors.getActiveDirection();
+        int8_t signLeft;
+        int8_t signRight;
+        TrackModel::trackSigns(direction, signLeft, signRight);
+
+#if WHEEL_ENCODERS_ENABLED
+        uint32_t countsA;
+        uint32_t countsB;
+        speedLoop.getTotalCounts(countsA, countsB);
+        odometry.update(TrackModel::fromCounts((uint16_t)(countsA - lastCountsA), signLeft),
+                        TrackModel::fromCounts((uint16_t)(countsB - lastCountsB), signRight));
+        lastCountsA = countsA;
+        lastCountsB = countsB;
+#else
+        auto duty = motors.getAppliedDuty();
+        odometry.update(
+            TrackModel::fromDuty(duty.motorA, TrackModel::DEADBAND_A, TrackModel::UM_PER_S_PER_DUTY_A,
+                                 signLeft, UPDATE_PERIOD_US),
+            TrackModel::fromDuty(duty.motorB, TrackModel::DEADBAND_B, TrackModel::UM_PER_S_PER_DUTY_B,
+                                 signRight, UPDATE_PERIOD_US));
+#endif
+
+        if (++updatesSinceReport >= REPORT_INTERVAL) {
+            updatesSinceReport = 0;
+            sendReport(direction);
+        }
+    }
+
+    /**
+     * Send the current pose to the controller
+     *
+     * @param direction Direction being executed
+     */
+    void sendReport(Direction direction) {
+        auto pose = odometry.getPose();
+        PoseReport report = {};
+        report.type = PacketType::POSE_REPORT;
+        report.sequence = sequence++;
+        report.x = pose.x;
+        report.y = pose.y;
+        report.heading = pose.heading;
+        report.direction = (uint8_t)direction;
+        report.source = WHEEL_ENCODERS_ENABLED;
+        uplink.send(&report, sizeof(report));
+    }
+};
+
+#endif // POSE_ESTIMATOR_HPP
@@ -0,0 +1,139 @@
+#ifndef POWER_GOVERNOR_HPP
+#define POWER_GOVERNOR_HPP
+
+#include <stdint.h>
+
+/**
+ * PowerGovernor Class
+ *
+ * Derates the LED panel and the motors as the battery voltage sags, so a
+ * motor start with the LEDs lit does not pull the pack into brownout.
+ * It also estimates the state of charge of the 4-cell Ni-MH pack.
+ *
+ * The governor works on filtered pack voltage and only reports a change
+ * when the power level actually moves, with hysteresis between levels, so
+ * consumers are updated rarely instead of polling every frame.
+ */
+class PowerGovernor {
+public:
+    /**
+     * Output limits for one power level
+     */
+    struct Limits {
+        uint8_t ledScale;   // LED brightness scale (255 = full)
+        uint8_t motorScale; // Motor PWM scale (255 = full)
+    };
+
+    PowerGovernor() = default;
+
+    /**
+     * Feed a new pack voltage sample (already decimated)
+     *
+     * @param millivolts Pack voltage (mV)
+     * @return true if the power level changed
+     */
+    bool update(uint16_t millivolts) {
+        // First-order low-pass, time constant = 8 samples
+        if (filtered == 0) {
+            filtered = (uint32_t)millivolts << FILTER_SHIFT;
+        } else {
+            filtered += (uint32_t)millivolts - (filtered >> FILTER_SHIFT);
+        }
+
+        uint16_t voltage = getMillivolts();
+        uint8_t newLevel = level;
+        // Step down immediately, step up only after recovering past the hysteresis
+        while (newLevel + 1 < LEVEL_COUNT && voltage < LEVELS[newLevel].millivolts) {
+            newLevel++;
+        }
+        while (newLevel > 0 && voltage >= LEVELS[newLevel - 1].millivolts + HYSTERESIS_MV) {
+            newLevel--;
+        }
+
+        if (newLevel == level) {
+            return false;
+        }
+        level = newLevel;
+        return true;
+    }
+
+    /**
+     * Get the limits for the current power level
+     */
+    Limits getLimits() const {
+        return LEVELS[level].limits;
+    }
+
+    /**
+     * Get the current power level (0 = full power)
+     */
+    uint8_t getLevel() const {
+        return level;
+    }
+
+    /**
+     * Get the filtered pack voltage
+     *
+     * @return Pack voltage (mV)
+     */
+    uint16_t getMillivolts() const {
+        return (uint16_t)(filtered >> FILTER_SHIFT);
+    }
+
+    /**
+     * Estimate the state of charge from the filtered voltage
+     * (approximate: Ni-MH has a flat discharge curve)
+     *
+     * @return State of charge (0-100 %)
+     */
+    uint8_t getStateOfCharge() const {
+        uint16_t voltage = getMillivolts();
+        if (voltage >= SOC_CURVE[0].millivolts) {
+            return SOC_CURVE[0].percent;
+        }
+        for (uint8_t i = 1; i < SOC_POINTS; i++) {
+            if (voltage >= SOC_CURVE[i].millivolts) {
+                const auto& high = SOC_CURVE[i - 1];
+                const auto& low = SOC_CURVE[i];
+                return low.percent + (voltage - low.millivolts) * (high.percent - low.percent) /
+                                         (high.millivolts - low.millivolts);
+            }
+        }
+        return 0;
+    }
+
+private:
+    struct Level {
+        uint16_t millivolts; // Minimum pack voltage to stay at this level
+        Limits limits;
+    };
+
+    struct SocPoint {
+        uint16_t millivolts;
+        uint8_t percent;
+    };
+
+    static constexpr uint8_t FILTER_SHIFT = 3;
+    static constexpr uint16_t HYSTERESIS_MV = 60;
+    static constexpr uint8_t LEVEL_COUNT = 5;
+    static constexpr uint8_t SOC_POINTS = 6;
+
+    // Minimum pack voltage for each level (4 x Ni-MH, 4.8 V nominal)
+    static constexpr Level LEVELS[LEVEL_COUNT] = {
+        {4700, {255, 255}}, // Full power
+        {4500, {192, 240}},
+        {4300, {128, 220}},
+        {4100, {64, 200}},
+        {0, {32, 180}},     // Critical: keep moving, LEDs barely lit
+    };
+
+    // Resting pack voltage vs state of charge
+    static constexpr SocPoint SOC_CURVE[SOC_POINTS] = {
+        {5400, 100}, {5100, 80}, {4960, 50}, {4800, 20}, {4600, 5}, {4400, 0},
+    };
+
+    uint32_t filtered = 0; // Voltage << FILTER_SHIFT
+    uint8_t level = 0;
+};
+
+#endif // POWER_GOVERNOR_HPP
@@ -0,0 +1,359 @@
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+#include <stdint.h>
+
+/**
+ * ESP-NOW Packet Definitions
+ *
+ * The remote controller sends a bare 1-byte Direction (see MessageStruct in
+ * main.cpp). All other packets start with a PacketType byte followed by a
+ * packed payload, and are always longer than one byte.
+ * ESP-NOW payloads are limited to 250 bytes.
+ */
+
+// Maximum ESP-NOW payload size
+static constexpr uint8_t ESPNOW_MAX_PAYLOAD = 250;
+
+// Destination address of packets sent to every robot in range
+static constexpr uint8_t ESPNOW_BROADCAST_MAC[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+/**
+ * Packet Type Constants
+ */
+enum class PacketType : uint8_t {
+    POSE_REPORT = 0x10,    // Robot -> controller: dead-reckoning pose
+    BATTERY_REPORT = 0x11, // Robot -> controller: battery voltage and charge
+    TELEMETRY = 0x12,      // Robot -> controller: batch of state samples
+    ASSET_BEGIN = 0x20,    // Controller -> robot: start an asset pack upload
+    ASSET_CHUNK = 0x21,    // Controller -> robot: one chunk of the pack
+    ASSET_ACK = 0x22,      // Robot -> controller: chunks stored so far
+    ASSET_STATUS = 0x23,   // Robot -> controller: upload rejected or finished
+    TEXT_SET = 0x30,       // Controller -> robot: scroll text on the display
+    TIME_BEACON = 0x40,    // Beacon source -> all robots: fleet time
+    MOVE_AT = 0x41,        // Controller -> robot: direction command at a fleet time
+    IDENTITY_SET = 0x50,   // Controller -> robot: robot ID and groups (unicast only)
+    FLEET_COMMAND = 0x51,  // Controller -> robots: direction commands for many robots
+    CONTROL_CLAIM = 0x60,  // Controller -> robot: take control at a priority
+    CONTROL_RELEASE = 0x61, // Controller -> robot: give up control
+    CONTROL_REPLY = 0x62,  // Robot -> controller: claim granted or denied, control lost
+};
+
+/**
+ * Pose Report (robot -> controller)
+ */
+struct __attribute__((packed)) PoseReport {
+    PacketType type;     // PacketType::POSE_REPORT
+    uint8_t sequence;    // Incremented for every report
+    int32_t x;           // Forward of start position (mm)
+    int32_t y;           // Left of start position (mm)
+    uint16_t heading;    // Counter-clockwise from start (65536 = 360 degrees)
+    uint8_t direction;   // Direction being executed
+    uint8_t source;      // 0 = PWM model, 1 = wheel encoders
+};
+
+/**
+ * Battery Report (robot -> controller)
+ */
+struct __attribute__((packed)) BatteryReport {
+    PacketType type;       // PacketType::BATTERY_REPORT
+    uint8_t sequence;      // Incremented for every report
+    uint16_t millivolts;   // Filtered pack voltage (mV)
+    uint8_t stateOfCharge; // Estimated state of charge (0-100 %)
+    uint8_t powerLevel;    // Power governor level (0 = full power)
+};
+
+/**
+ * Telemetry
+ *
+ * The robot samples its state at a fixed rate (see Telemetry) and sends
+ * the samples to the controller in batches: one sample per packet at low
+ * rates, and up to TELEMETRY_MAX_SAMPLES per packet when the rate is high.
+ * Samples are never resent; gaps in the sequence are lost packets.
+ */
+
+/**
+ * Telemetry Sample
+ * Counters are running totals that wrap; take differences between samples.
+ */
+struct __attribute__((packed)) TelemetrySample {
+    uint32_t timeMs;     // Robot time when taken (millis())
+    uint8_t direction;   // Direction being executed
+    uint8_t dutyA;       // PWM duty applied to motor A (0-255)
+    uint8_t dutyB;       // PWM duty applied to motor B (0-255)
+    uint8_t frames;      // Frames rendered since the previous sample
+    uint16_t frameAvgUs; // Average render time of those frames
+    uint16_t frameMaxUs; // Longest render time of those frames
+    uint32_t freeHeap;   // Free heap (bytes)
+    uint16_t rxPackets;  // Packets received
+    uint16_t rxRejected; // Packets from controllers not in charge (CONTROL_ARBITER_ENABLED)
+    uint16_t txFailed;   // Telemetry packets that could not be queued
+    int8_t rssi;         // Signal strength of the last received packet (dBm)
+};
+
+/**
+ * Telemetry (robot -> controller)
+ * Followed by `count` samples of `sampleSize` bytes each, oldest first.
+ */
+struct __attribute__((packed)) TelemetryBatch {
+    PacketType type;    // PacketType::TELEMETRY
+    uint8_t sequence;   // Incremented for every packet
+    uint8_t count;      // Number of samples
+    uint8_t sampleSize; // sizeof(TelemetrySample); newer fields are appended
+};
+
+// Most samples in one packet
+static constexpr uint8_t TELEMETRY_MAX_SAMPLES =
+    (ESPNOW_MAX_PAYLOAD - sizeof(TelemetryBatch)) / sizeof(TelemetrySample);
+
+/**
+ * Asset Pack Upload
+ *
+ * The controller streams an asset pack into the robot's "assets" partition
+ * in fixed-size chunks (see AssetReceiver):
+ * 1. ASSET_BEGIN announces the size and CRC; the robot answers with an
+ *    ASSET_ACK (base 0), or an ASSET_STATUS if it cannot take the pack.
+ * 2. ASSET_CHUNKs are sent with up to `window` chunks outstanding. Every
+ *    chunk carries a CRC over its header and data; corrupt chunks are
+ *    dropped.
+ * All fields but the chunk data are covered by the ESP-NOW frame check only.
+ * 3. ASSET_ACKs report the first missing chunk plus a bitmap of the chunks
+ *    received after it, so only lost chunks are sent again.
+ * 4. Once every chunk is in flash and the pack CRC matches, the robot
+ *    activates the pack and answers with ASSET_STATUS ACTIVATED.
+ */
+
+// Pack bytes per chunk (all chunks are full except the last)
+static constexpr uint8_t ASSET_CHUNK_SIZE = 240;
+// Maximum chunks outstanding (one bit each in AssetAck::received)
+static constexpr uint8_t ASSET_WINDOW = 32;
+
+/**
+ * Asset Upload Status Codes
+ */
+enum class AssetStatusCode : uint8_t {
+    ACTIVATED = 0,     // Pack stored and in use
+    TOO_LARGE = 1,     // Pack does not fit the free slot
+    CRC_MISMATCH = 2,  // Stored pack does not match the announced CRC
+    FLASH_ERROR = 3,   // Erase or write failed
+    INVALID_PACK = 4,  // Stored pack matches the CRC but is not a valid pack
+};
+
+/**
+ * Asset Begin (controller -> robot)
+ */
+struct __attribute__((packed)) AssetBegin {
+    PacketType type;      // PacketType::ASSET_BEGIN
+    uint16_t transferId;  // Chosen by the controller, repeated in every packet
+    uint32_t size;        // Pack size in bytes
+    uint32_t crc;         // CRC-32 of the whole pack
+    uint8_t window;       // Chunks the controller keeps in flight (1 to ASSET_WINDOW)
+};
+
+/**
+ * Asset Chunk (controller -> robot)
+ * Followed by the chunk data; its length is the packet length minus the header.
+ */
+struct __attribute__((packed)) AssetChunk {
+    PacketType type;      // PacketType::ASSET_CHUNK
+    uint16_t transferId;  // Transfer the chunk belongs to
+    uint16_t index;       // Chunk number (pack offset / ASSET_CHUNK_SIZE)
+    uint32_t crc;         // CRC-32 of transferId, index and the chunk data
+};
+
+/**
+ * Asset Acknowledgement (robot -> controller)
+ */
+struct __attribute__((packed)) AssetAck {
+    PacketType type;      // PacketType::ASSET_ACK
+    uint16_t transferId;  // Transfer being acknowledged
+    uint16_t base;        // All chunks before this one have been received
+    uint32_t received;    // Bit n set: chunk base + 1 + n has been received
+};
+
+/**
+ * Asset Status (robot -> controller)
+ */
+struct __attribute__((packed)) AssetStatus {
+    PacketType type;          // PacketType::ASSET_STATUS
+    uint16_t transferId;      // Transfer the status applies to
+    AssetStatusCode status;   // Result
+    uint32_t generation;      // Generation of the active pack
+};
+
+static_assert(sizeof(AssetChunk) + ASSET_CHUNK_SIZE <= ESPNOW_MAX_PAYLOAD, "Asset chunks must fit one packet");
+
+/**
+ * Text Display
+ *
+ * TEXT_SET replaces the arrows with a scrolling marquee of the given text
+ * (printable ASCII; other characters are shown as '?'). The text follows
+ * the header and runs to the end of the packet; an empty text returns the
+ * display to the arrows.
+ */
+
+// Longest text shown (longer texts are cut off)
+static constexpr uint8_t TEXT_MAX_LENGTH = 64;
+
+/**
+ * Text Set (controller -> robot)
+ * Followed by the text (not terminated).
+ */
+struct __attribute__((packed)) TextSet {
+    PacketType type;      // PacketType::TEXT_SET
+    uint8_t red;          // Text color
+    uint8_t green;
+    uint8_t blue;
+    uint8_t speed;        // Scroll speed (columns per second, 0 = default)
+};
+
+static_assert(sizeof(TextSet) + TEXT_MAX_LENGTH <= ESPNOW_MAX_PAYLOAD, "Text must fit one packet");
+
+/**
+ * Fleet Time
+ *
+ * One device (a robot built with CLOCK_SYNC_SOURCE, or the controller)
+ * broadcasts TIME_BEACON every 100 ms with its clock; every robot tracks
+ * that fleet clock (see ClockSync), runs its animations in phase with it
+ * and starts MOVE_AT commands when it reaches the given time. A broadcast
+ * reaches all robots at the same moment, so delays in sending it shift
+ * every robot alike.
+ */
+
+/**
+ * Time Beacon (broadcast)
+ */
+struct __attribute__((packed)) TimeBeacon {
+    PacketType type;  // PacketType::TIME_BEACON
+    uint8_t sequence; // Incremented for every beacon
+    uint64_t timeUs;  // Source clock when sent (microseconds)
+};
+
+/**
+ * Move At (controller -> robot)
+ * Replaces any move still waiting; a time already passed starts the move at once.
+ */
+struct __attribute__((packed)) MoveAt {
+    PacketType type;   // PacketType::MOVE_AT
+    uint8_t direction; // Direction to execute
+    uint64_t startUs;  // Fleet time to start (microseconds)
+};
+
+/**
+ * Fleet Addressing
+ *
+ * Each robot has an ID and a set of groups (a bitmask of up to 32 groups),
+ * kept in NVS and assigned by IDENTITY_SET, which a robot only accepts when
+ * it is sent to its own MAC address.
+ *
+ * FLEET_COMMAND carries one command slot per robot ID or per group number,
+ * for consecutive IDs (or groups) from `first`, so a single broadcast can
+ * command a whole fleet. Each slot is a Direction, or FLEET_SLOT_SKIP to
+ * leave that robot alone. In group mode, a robot in several of the
+ * addressed groups follows the lowest-numbered one.
+ *
+ * The bare 1-byte Direction still commands every robot that hears it.
+ */
+
+// Robot ID of a robot that has not been assigned one (no robot slot)
+static constexpr uint8_t ROBOT_ID_NONE = 0xFF;
+// Number of groups (bits in IdentitySet::groups)
+static constexpr uint8_t FLEET_GROUP_COUNT = 32;
+// Slot value: no command for this robot or group
+static constexpr uint8_t FLEET_SLOT_SKIP = 0xFF;
+
+/**
+ * Fleet Command Addressing Modes
+ */
+enum class FleetSlotMode : uint8_t {
+    ROBOT = 0, // Slot n is for robot ID first + n
+    GROUP = 1, // Slot n is for group first + n
+};
+
+/**
+ * Identity Set (controller -> robot, unicast)
+ */
+struct __attribute__((packed)) IdentitySet {
+    PacketType type;   // PacketType::IDENTITY_SET
+    uint8_t robotId;   // New robot ID (ROBOT_ID_NONE to clear)
+    uint32_t groups;   // Bit n set: member of group n
+};
+
+/**
+ * Fleet Command (controller -> robots, usually broadcast)
+ * Followed by `count` slots of one byte each.
+ */
+struct __attribute__((packed)) FleetCommand {
+    PacketType type;     // PacketType::FLEET_COMMAND
+    FleetSlotMode mode;  // What the slots are indexed by
+    uint8_t first;       // Robot ID or group number of the first slot
+    uint8_t count;       // Number of slots
+};
+
+// Most slots in one packet
+static constexpr uint8_t FLEET_MAX_SLOTS = ESPNOW_MAX_PAYLOAD - sizeof(FleetCommand);
+
+/**
+ * Control Arbitration
+ *
+ * With several controllers in range, a robot takes commands from one
+ * owner at a time (see ControlArbiter). Control is a lease: it lapses
+ * unless the owner keeps sending commands within the lease time.
+ * - A controller sending commands while nobody holds a lease becomes the
+ *   owner at priority 0; commands from anybody else are dropped.
+ * - CONTROL_CLAIM asks for control at a priority. It is granted if nobody
+ *   holds a lease, the claimant already does, or its priority is higher
+ *   than the owner's; the previous owner is told with CONTROL_REPLY
+ *   REVOKED. Otherwise the claimant gets DENIED with the time left on the
+ *   owner's lease.
+ * - CONTROL_RELEASE from the owner ends its lease at once.
+ * Replies are broadcast (no peer setup for every controller in range) and
+ * name the controller they are for; unacknowledged, so claims are resent
+ * until a reply arrives.
+ * Time beacons are never arbitrated.
+ */
+
+// Lease time when none is given (commands without a claim, or leaseMs 0)
+static constexpr uint16_t CONTROL_LEASE_DEFAULT_MS = 1000;
+// Longest lease a claim can ask for
+static constexpr uint16_t CONTROL_LEASE_MAX_MS = 10000;
+
+/**
+ * Control Reply Status Codes
+ */
+enum class ControlStatus : uint8_t {
+    GRANTED = 0,  // Claimant is the owner
+    DENIED = 1,   // Another controller holds a lease at the same or higher priority
+    REVOKED = 2,  // Sent to the previous owner: a higher priority claim took over
+    RELEASED = 3, // Lease ended by CONTROL_RELEASE
+};
+
+/**
+ * Control Claim (controller -> robot)
+ */
+struct __attribute__((packed)) ControlClaim {
+    PacketType type;  // PacketType::CONTROL_CLAIM
+    uint8_t priority; // Higher takes over lower (0 = same as unclaimed commands)
+    uint16_t leaseMs; // Lease time, renewed by every command (0 = default)
+};
+
+/**
+ * Control Release (controller -> robot)
+ */
+struct __attribute__((packed)) ControlRelease {
+    PacketType type;  // PacketType::CONTROL_RELEASE
+    uint8_t reserved; // 0 (keeps the packet longer than a bare Direction)
+};
+
+/**
+ * Control Reply (robot -> controller)
+ */
+struct __attribute__((packed)) ControlReply {
+    PacketType type;       // PacketType::CONTROL_REPLY
+    uint8_t controller[6]; // MAC address of the controller the reply is for
+    ControlStatus status;  // Result
+    uint8_t ownerPriority; // Priority of the owner after this reply
+    uint16_t leaseMs;      // GRANTED: lease time; DENIED: time left on the owner's lease
+};
+
+#endif // PROTOCOL_H
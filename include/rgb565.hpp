@@ -0,0 +1,62 @@
+#ifndef RGB565_HPP
+#define RGB565_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Rgb565 Class
+ *
+ * Converts prerendered RGB565 frames into 8-bit RGB LED data.
+ *
+ * Frames are stored two pixels per 32-bit word (first pixel in the low
+ * half), word aligned, so each pair of pixels takes a single aligned load
+ * from flash. Components are expanded to 8 bits by bit replication, which
+ * gives the same result as LovyanGFX's readPixelRGB.
+ *
+ * No hardware dependencies: the same code is benchmarked on the host
+ * (host/asset_bench).
+ */
+class Rgb565 {
+public:
+    /**
+     * Expand 5- and 6-bit color components to 8 bits
+     */
+    static constexpr uint8_t expand5(uint16_t value) {
+        return (uint8_t)((value << 3) | (value >> 2));
+    }
+
+    static constexpr uint8_t expand6(uint16_t value) {
+        return (uint8_t)((value << 2) | (value >> 4));
+    }
+
+    /**
+     * Convert a frame and remap it to LED order in one pass
+     *
+     * @param frame Pixel words in display order (pixelCount / 2 words)
+     * @param pixelCount Number of pixels (even)
+     * @param ledIndex Display pixel -> LED index table
+     * @param rgb Output, 3 bytes per LED in R, G, B order
+     */
+    static void convertFrame(const uint32_t* frame, size_t pixelCount, const uint16_t* ledIndex, uint8_t* rgb) {
+        for (size_t i = 0; i < pixelCount; i += 2) {
+            uint32_t pair = *frame++;
+            toRgb((uint16_t)pair, rgb + ledIndex[i] * 3);
+            toRgb((uint16_t)(pair >> 16), rgb + ledIndex[i + 1] * 3);
+        }
+    }
+
+    /**
+     * Convert one pixel
+     *
+     * @param pixel RGB565 value
+     * @param out Receives R, G, B bytes
+     */
+    static void toRgb(uint16_t pixel, uint8_t* out) {
+        out[0] = expand5(pixel >> 11);
+        out[1] = expand6((pixel >> 5) & 0x3F);
+        out[2] = expand5(pixel & 0x1F);
+    }
+};
+
+#endif // RGB565_HPP
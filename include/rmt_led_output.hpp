@@ -0,0 +1,127 @@
+#ifndef RMT_LED_OUTPUT_HPP
+#define RMT_LED_OUTPUT_HPP
+
+#include <driver/rmt_tx.h>
+#include "ws2812_encoder.hpp"
+
+/**
+ * RmtLedOutput Class
+ *
+ * Non-blocking WS2812B output on one RMT TX channel.
+ * transmit() starts sending a pre-encoded symbol buffer and returns at once;
+ * the RMT peripheral clocks the bits out and its interrupt refills the
+ * channel memory, so the CPU is free for the whole wire time (7.7-8.3 ms for
+ * 256 LEDs). Completion is signalled through a callback and waitForIdle().
+ *
+ * The symbol buffer must stay untouched until the transfer has completed.
+ */
+class RmtLedOutput {
+public:
+    // Called from the RMT interrupt when a frame has been sent
+    using DoneCallback = void (*)(void* arg);
+
+    RmtLedOutput() = default;
+
+    /**
+     * Create the RMT channel and encoder
+     *
+     * @param pin LED data output pin
+     * @return true if initialization successful, false otherwise
+     */
+    bool begin(uint8_t pin) {
+        rmt_tx_channel_config_t channelConfig = {};
+        channelConfig.gpio_num = (gpio_num_t)pin;
+        channelConfig.clk_src = RMT_CLK_SRC_DEFAULT;
+        channelConfig.resolution_hz = Ws2812Encoder::RESOLUTION_HZ;
+        channelConfig.mem_block_symbols = MEM_BLOCK_SYMBOLS;
+        channelConfig.trans_queue_depth = 1;
+        if (rmt_new_tx_channel(&channelConfig, &channel) != ESP_OK) {
+            return false;
+        }
+
+        rmt_copy_encoder_config_t encoderConfig = {};
+        if (rmt_new_copy_encoder(&encoderConfig, &encoder) != ESP_OK) {
+            return false;
+        }
+
+        rmt_tx_event_callbacks_t callbacks = {};
+        callbacks.on_trans_done = &RmtLedOutput::onTransDone;
+        if (rmt_tx_register_event_callbacks(channel, &callbacks, this) != ESP_OK) {
+            return false;
+        }
+        return rmt_enable(channel) == ESP_OK;
+    }
+
+    /**
+     * Start sending a frame (returns immediately)
+     *
+     * @param symbols Encoded frame (see Ws2812Encoder)
+     * @param count Number of symbols
+     * @return true if the transfer was started
+     */
+    bool transmit(const uint32_t* symbols, size_t count) {
+        rmt_transmit_config_t transmitConfig = {};
+        transmitConfig.loop_count = 0;
+        busy = true;
+        if (rmt_transmit(channel, encoder, symbols, count * sizeof(uint32_t), &transmitConfig) != ESP_OK) {
+            busy = false;
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Wait until the current frame has been sent
+     *
+     * @param timeoutMs Maximum wait (milliseconds)
+     * @return true if idle, false on timeout
+     */
+    bool waitForIdle(uint32_t timeoutMs) {
+        if (!busy) {
+            return true;
+        }
+        return rmt_tx_wait_all_done(channel, (int)timeoutMs) == ESP_OK;
+    }
+
+    /**
+     * Check whether a frame is still being sent
+     */
+    bool isBusy() const {
+        return busy;
+    }
+
+    /**
+     * Register a completion callback (runs in interrupt context)
+     *
+     * @param callback Function to call, or nullptr
+     * @param arg Argument passed to the callback
+     */
+    void setDoneCallback(DoneCallback callback, void* arg) {
+        doneArg = arg;
+        doneCallback = callback;
+    }
+
+private:
+    // RMT channel memory (symbols); refilled from the interrupt while sending
+    static constexpr size_t MEM_BLOCK_SYMBOLS = 48;
+
+    rmt_channel_handle_t channel = nullptr;
+    rmt_encoder_handle_t encoder = nullptr;
+    volatile bool busy = false;
+    DoneCallback doneCallback = nullptr;
+    void* doneArg = nullptr;
+
+    /**
+     * RMT transfer-done interrupt handler
+     */
+    static bool IRAM_ATTR onTransDone(rmt_channel_handle_t, const rmt_tx_done_event_data_t*, void* user) {
+        auto* self = static_cast<RmtLedOutput*>(user);
+        self->busy = false;
+        if (self->doneCallback) {
+            self->doneCallback(self->doneArg);
+        }
+        return false;
+    }
+};
+
+#endif // RMT_LED_OUTPUT_HPP
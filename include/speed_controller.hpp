@@ -0,0 +1,135 @@
+#ifndef SPEED_CONTROLLER_HPP
+#define SPEED_CONTROLLER_HPP
+
+#include <stdint.h>
+
+/**
+ * SpeedController Class
+ *
+ * Fixed-rate PI controller holding the target speed of both crawler tracks.
+ * Targets and measurements are expressed in encoder counts per control period,
+ * and the output is a PWM duty (0-255) for each motor.
+ *
+ * The open-loop duty of the current command is used as feedforward, so the
+ * integrator only has to absorb the difference between the two motors and the
+ * effect of battery voltage.
+ *
+ * This class has no hardware dependencies and is shared by the firmware and
+ * the host tuning tool (host/speed_tuning).
+ */
+class SpeedController {
+public:
+    /**
+     * Controller gains in Q8 fixed point (256 = 1.0 duty step per count)
+     */
+    struct Gains {
+        int16_t kp;
+        int16_t ki;
+    };
+
+    /**
+     * PWM duty for both motors
+     */
+    struct Duty {
+        uint8_t motorA;
+        uint8_t motorB;
+    };
+
+    static constexpr Gains DEFAULT_GAINS = {768, 160};
+
+    SpeedController() = default;
+
+    explicit SpeedController(Gains gains) : gains(gains) {}
+
+    /**
+     * Set target speeds and feedforward duties for both tracks
+     *
+     * @param countsA Target speed of motor A (counts per control period)
+     * @param countsB Target speed of motor B (counts per control period)
+     * @param feedforward Open-loop duty for the current command
+     */
+    void setTarget(uint16_t countsA, uint16_t countsB, Duty feedforward) {
+        trackA.target = countsA;
+        trackB.target = countsB;
+        trackA.feedforward = feedforward.motorA;
+        trackB.feedforward = feedforward.motorB;
+    }
+
+    /**
+     * Clear integrator state (call when the robot stops or reverses)
+     */
+    void reset() {
+        trackA.integral = 0;
+        trackB.integral = 0;
+    }
+
+    /**
+     * Run one control step
+     *
+     * @param measuredA Counts of motor A during the last control period
+     * @param measuredB Counts of motor B during the last control period
+     * @return PWM duty to apply to both motors
+     */
+    Duty update(uint16_t measuredA, uint16_t measuredB) {
+        return {step(trackA, measuredA), step(trackB, measuredB)};
+    }
+
+    void setGains(Gains newGains) {
+        gains = newGains;
+    }
+
+private:
+    // Integrator limit (Q8), keeps wind-up within one full duty range
+    static constexpr int32_t INTEGRAL_LIMIT = 255 << 8;
+
+    struct Track {
+        uint16_t target = 0;
+        uint8_t feedforward = 0;
+        int32_t integral = 0;
+    };
+
+    Gains gains = DEFAULT_GAINS;
+    Track trackA;
+    Track trackB;
+
+    /**
+     * PI step for a single track
+     *
+     * @param track Track state
+     * @param measured Measured counts during the last control period
+     * @return PWM duty (0-255)
+     */
+    uint8_t step(Track& track, uint16_t measured) {
+        if (track.target == 0) {
+            track.integral = 0;
+            return 0;
+        }
+
+        int32_t error = (int32_t)track.target - (int32_t)measured;
+        int32_t output = ((int32_t)track.feedforward << 8) + error * gains.kp + track.integral;
+
+        // Conditional integration: only integrate while the output is not
+        // saturated in the direction of the error (anti-windup)
+        bool saturatedHigh = output >= (255 << 8) && error > 0;
+        bool saturatedLow = output <= 0 && error < 0;
+        if (!saturatedHigh && !saturatedLow) {
+            track.integral += error * gains.ki;
+            if (track.integral > INTEGRAL_LIMIT) {
+                track.integral = INTEGRAL_LIMIT;
+            } else if (track.integral < -INTEGRAL_LIMIT) {
+                track.integral = -INTEGRAL_LIMIT;
+            }
+        }
+
+        output >>= 8;
+        if (output > 255) {
+            return 255;
+        }
+        if (output < 0) {
+            return 0;
+        }
+        return (uint8_t)output;
+    }
+};
+
+#endif // SPEED_CONTROLLER_HPP
@@ -0,0 +1,160 @@
+#ifndef TELEMETRY_HPP
+#define TELEMETRY_HPP
+
+#include <atomic>
+#include <esp_system.h>
+#include <esp_timer.h>
+#include "constants.h"
+#include "motor_controller.hpp"
+#include "protocol.h"
+#include "uplink.hpp"
+
+/**
+ * Telemetry Class
+ *
+ * Samples the robot's state at a fixed rate and sends the samples to the
+ * controller (see "Telemetry" in protocol.h). Sampling and sending run in
+ * the esp_timer task; Uplink::send() only queues the packet, so nothing
+ * here waits for the radio. The receive callback and the main loop only
+ * update counters with recordPacket() and recordFrame().
+ *
+ * Up to MAX_PACKETS_PER_SECOND, each sample goes out on its own; at higher
+ * rates, samples are collected and sent in batches so the packet rate
+ * stays there. Batches are dropped while no controller is known.
+ */
+class Telemetry {
+public:
+    Telemetry(MotorController& motors, Uplink& uplink) : motors(motors), uplink(uplink) {}
+
+    /**
+     * Start sampling
+     *
+     * @param rateHz Samples per second (1 to MAX_RATE_HZ)
+     * @return true if initialization successful, false otherwise
+     */
+    bool begin(uint16_t rateHz) {
+        rateHz = rateHz < 1 ? 1 : rateHz > MAX_RATE_HZ ? MAX_RATE_HZ : rateHz;
+        uint16_t perPacket = (rateHz + MAX_PACKETS_PER_SECOND - 1) / MAX_PACKETS_PER_SECOND;
+        samplesPerPacket = perPacket > TELEMETRY_MAX_SAMPLES ? TELEMETRY_MAX_SAMPLES : (uint8_t)perPacket;
+
+        esp_timer_create_args_t timerArgs = {};
+        timerArgs.callback = &Telemetry::onTimer;
+        timerArgs.arg = this;
+        timerArgs.dispatch_method = ESP_TIMER_TASK;
+        timerArgs.name = "telemetry";
+        if (esp_timer_create(&timerArgs, &timer) != ESP_OK) {
+            return false;
+        }
+        return esp_timer_start_periodic(timer, 1000000 / rateHz) == ESP_OK;
+    }
+
+    /**
+     * Count a received packet (from the receive callback)
+     *
+     * @param rssi Signal strength (dBm)
+     */
+    void recordPacket(int8_t rssi) {
+        rxPackets.fetch_add(1, std::memory_order_relaxed);
+        lastRssi.store(rssi, std::memory_order_relaxed);
+    }
+
+    /**
+     * Set the count of packets rejected by the control arbiter (from the main loop)
+     */
+    void setRejected(uint32_t count) {
+        rxRejected.store(count, std::memory_order_relaxed);
+    }
+
+    /**
+     * Add the time of one render (from the main loop)
+     *
+     * @param durationUs Update time (microseconds)
+     */
+    void recordFrame(uint32_t durationUs) {
+        frameCount.fetch_add(1, std::memory_order_relaxed);
+        frameTotalUs.fetch_add(durationUs, std::memory_order_relaxed);
+        if (durationUs > frameMaxUs.load(std::memory_order_relaxed)) {
+            frameMaxUs.store(durationUs, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Get the number of samples sent in each packet
+     */
+    uint8_t getSamplesPerPacket() const {
+        return samplesPerPacket;
+    }
+
+private:
+    static constexpr uint16_t MAX_RATE_HZ = 100;
+    static constexpr uint16_t MAX_PACKETS_PER_SECOND = 10;
+
+    MotorController& motors;
+    Uplink& uplink;
+    esp_timer_handle_t timer = nullptr;
+    uint8_t samplesPerPacket = 1;
+
+    // Counters from the receive callback and the main loop
+    std::atomic<uint32_t> rxPackets{0};
+    std::atomic<uint32_t> rxRejected{0};
+    std::atomic<int8_t> lastRssi{0};
+    std::atomic<uint32_t> frameCount{0};
+    std::atomic<uint32_t> frameTotalUs{0};
+    std::atomic<uint32_t> frameMaxUs{0};
+
+    // esp_timer task only
+    struct __attribute__((packed)) Packet {
+        TelemetryBatch header;
+        TelemetrySample samples[TELEMETRY_MAX_SAMPLES];
+    } packet = {};
+    uint8_t sequence = 0;
+    uint32_t txFailed = 0;
+
+    static_assert(sizeof(Packet) <= ESPNOW_MAX_PAYLOAD, "Telemetry batch must fit one packet");
+
+    /**
+     * Timer callback trampoline
+     *
+     * @param arg Pointer to the Telemetry instance
+     */
+    static void onTimer(void* arg) {
+        static_cast<Telemetry*>(arg)->sampleStep();
+    }
+
+    /**
+     * Take a sample; send the batch when full
+     */
+    void sampleStep() {
+        TelemetrySample& sample = packet.samples[packet.header.count++];
+        sample.timeMs = millis();
+        sample.direction = (uint8_t)motors.getActiveDirection();
+        auto duty = motors.getAppliedDuty();
+        sample.dutyA = duty.motorA;
+        sample.dutyB = duty.motorB;
+        uint32_t frames = frameCount.exchange(0, std::memory_order_relaxed);
+        uint32_t totalUs = frameTotalUs.exchange(0, std::memory_order_relaxed);
+        uint32_t maxUs = frameMaxUs.exchange(0, std::memory_order_relaxed);
+        sample.frames = (uint8_t)(frames < UINT8_MAX ? frames : UINT8_MAX);
+        sample.frameAvgUs = (uint16_t)(frames ? totalUs / frames : 0);
+        sample.frameMaxUs = (uint16_t)(maxUs < UINT16_MAX ? maxUs : UINT16_MAX);
+        sample.freeHeap = esp_get_free_heap_size();
+        sample.rxPackets = (uint16_t)rxPackets.load(std::memory_order_relaxed);
+        sample.rxRejected = (uint16_t)rxRejected.load(std::memory_order_relaxed);
+        sample.txFailed = (uint16_t)txFailed;
+        sample.rssi = lastRssi.load(std::memory_order_relaxed);
+        if (packet.header.count < samplesPerPacket) {
+            return;
+        }
+
+        packet.header.type = PacketType::TELEMETRY;
+        packet.header.sequence = sequence++;
+        packet.header.sampleSize = sizeof(TelemetrySample);
+        size_t len = sizeof(TelemetryBatch) + packet.header.count * sizeof(TelemetrySample);
+        if (uplink.hasController() && !uplink.send(&packet, len)) {
+            txFailed++;
+        }
+        packet.header.count = 0;
+    }
+};
+
+#endif // TELEMETRY_HPP
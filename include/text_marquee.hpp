@@ -0,0 +1,217 @@
+#ifndef TEXT_MARQUEE_HPP
+#define TEXT_MARQUEE_HPP
+
+#include <array>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "glyph_atlas.h"
+#include "protocol.h"
+
+/**
+ * Build the table that scales a glyph column vertically: bit i of the
+ * index becomes Scale bits starting at bit i x Scale
+ */
+template <uint8_t Scale>
+constexpr std::array<uint16_t, 1 << GLYPH_HEIGHT> buildColumnScaleTable() {
+    std::array<uint16_t, 1 << GLYPH_HEIGHT> table = {};
+    for (uint16_t column = 0; column < table.size(); column++) {
+        for (uint8_t bit = 0; bit < GLYPH_HEIGHT; bit++) {
+            if (column & (1u << bit)) {
+                table[column] |= (uint16_t)(((1u << Scale) - 1) << (bit * Scale));
+            }
+        }
+    }
+    return table;
+}
+
+/**
+ * TextMarquee Class
+ *
+ * Scrolls a line of text from right to left across the display, one
+ * display column per step. Glyphs come from the 1-bpp glyph atlas
+ * (glyph_atlas.h) drawn at Scale x Scale, centered vertically.
+ *
+ * The visible image is kept as a ring of Width column masks (bit y = row
+ * y). A scroll step only composes the newly exposed column at the right
+ * edge from the atlas, replacing the column that scrolled out at the left,
+ * instead of redrawing the whole string; render() then writes the ring to
+ * LED order through the layout table. After the last character the text
+ * scrolls off completely before it starts again.
+ *
+ * No hardware dependencies: used by AnimationController and benchmarked on
+ * the host (host/text_bench).
+ *
+ * @tparam Width Display width in pixels
+ * @tparam Height Display height in pixels (up to 16)
+ * @tparam Scale Pixels per glyph pixel
+ */
+template <uint8_t Width, uint8_t Height, uint8_t Scale = 2>
+class TextMarquee {
+    static_assert(Height <= 16, "Column masks are 16 bits");
+    static_assert(GLYPH_HEIGHT * Scale <= Height, "Scaled glyphs must fit the display height");
+
+public:
+    // Default scroll speed (display columns per second)
+    static constexpr uint8_t DEFAULT_SPEED = 24;
+    // Blank glyph columns between characters, and after the text
+    static constexpr uint8_t CHARACTER_GAP = 1;
+    static constexpr uint8_t END_GAP = (Width + Scale - 1) / Scale;
+
+    TextMarquee() = default;
+
+    /**
+     * Set the text and start it from the right edge of an empty display
+     *
+     * @param message Text (not terminated, cut to TEXT_MAX_LENGTH)
+     * @param messageLength Text length (0 = no text)
+     * @param red Text color
+     * @param green
+     * @param blue
+     * @param speed Scroll speed (display columns per second, 0 = default)
+     * @param nowMs Current time (milliseconds)
+     */
+    void setText(const char* message, size_t messageLength, uint8_t red, uint8_t green, uint8_t blue,
+                 uint8_t speed, uint32_t nowMs) {
+        length = (uint8_t)(messageLength < TEXT_MAX_LENGTH ? messageLength : TEXT_MAX_LENGTH);
+        memcpy(text, message, length);
+        color[0] = red;
+        color[1] = green;
+        color[2] = blue;
+        stepMs = 1000 / (speed ? speed : DEFAULT_SPEED);
+        restart(nowMs);
+    }
+
+    /**
+     * Start the text again from the right edge of an empty display
+     *
+     * @param nowMs Current time (milliseconds)
+     */
+    void restart(uint32_t nowMs) {
+        memset(columns, 0, sizeof(columns));
+        head = 0;
+        character = 0;
+        glyphColumn = 0;
+        repeat = 0;
+        scaled = 0;
+        lastStep = nowMs;
+    }
+
+    /**
+     * Check whether there is text to show
+     */
+    bool hasText() const {
+        return length > 0;
+    }
+
+    /**
+     * Scroll by the columns due at a given time
+     *
+     * @param nowMs Current time (milliseconds)
+     * @return true if the image changed
+     */
+    bool update(uint32_t nowMs) {
+        uint32_t due = (nowMs - lastStep) / stepMs;
+        if (due == 0) {
+            return false;
+        }
+        lastStep += due * stepMs;
+        // After a long gap, catch up by at most one screen width
+        if (due > Width) {
+            due = Width;
+        }
+        for (uint32_t i = 0; i < due; i++) {
+            step();
+        }
+        return true;
+    }
+
+    /**
+     * Scroll by one display column
+     */
+    void step() {
+        if (repeat == 0) {
+            scaled = (uint16_t)(scaleTable[nextGlyphColumn()] << ROW_OFFSET);
+        }
+        repeat = repeat + 1 < Scale ? repeat + 1 : 0;
+        // The new right-edge column replaces the left-edge one
+        columns[head] = scaled;
+        head = head + 1 < Width ? head + 1 : 0;
+    }
+
+    /**
+     * Write the visible image to LED data
+     *
+     * @param ledIndex Display pixel -> LED index table (Width x Height entries)
+     * @param rgb Output, 3 bytes per LED in R, G, B order
+     */
+    void render(const uint16_t* ledIndex, uint8_t* rgb) const {
+        uint8_t column = head;
+        for (uint8_t x = 0; x < Width; x++) {
+            uint16_t mask = columns[column];
+            column = column + 1 < Width ? column + 1 : 0;
+            for (uint8_t y = 0; y < Height; y++, mask >>= 1) {
+                uint8_t* out = rgb + ledIndex[y * Width + x] * 3;
+                if (mask & 1) {
+                    out[0] = color[0];
+                    out[1] = color[1];
+                    out[2] = color[2];
+                } else {
+                    out[0] = out[1] = out[2] = 0;
+                }
+            }
+        }
+    }
+
+    /**
+     * Get the mask of a visible column (bit y = row y)
+     *
+     * @param x Display column (0 = left edge)
+     */
+    uint16_t getColumn(uint8_t x) const {
+        return columns[(head + x) % Width];
+    }
+
+private:
+    // First row of the scaled glyphs
+    static constexpr uint8_t ROW_OFFSET = (Height - GLYPH_HEIGHT * Scale) / 2;
+    static constexpr std::array<uint16_t, 1 << GLYPH_HEIGHT> scaleTable = buildColumnScaleTable<Scale>();
+
+    char text[TEXT_MAX_LENGTH] = {};
+    uint8_t length = 0;
+    uint8_t color[3] = {};
+    uint32_t stepMs = 1000 / DEFAULT_SPEED;
+    uint32_t lastStep = 0;
+    // Visible columns; head is the left edge
+    uint16_t columns[Width] = {};
+    uint8_t head = 0;
+    // Scroll position: character, column within it (glyph, then gap) and
+    // copy of the current glyph column (0 to Scale - 1)
+    uint8_t character = 0;
+    uint8_t glyphColumn = 0;
+    uint8_t repeat = 0;
+    uint16_t scaled = 0;
+
+    /**
+     * Get the next glyph column of the text and advance
+     */
+    uint8_t nextGlyphColumn() {
+        if (character >= length) {
+            // Blank run after the text, then from the start again
+            if (++glyphColumn >= END_GAP) {
+                glyphColumn = 0;
+                character = 0;
+            }
+            return 0;
+        }
+        Glyph glyph = findGlyph(text[character]);
+        uint8_t bits = glyphColumn < glyph.width ? glyph.columns[glyphColumn] : 0;
+        if (++glyphColumn >= glyph.width + CHARACTER_GAP) {
+            glyphColumn = 0;
+            character++;
+        }
+        return bits & ((1u << GLYPH_HEIGHT) - 1);
+    }
+};
+
+#endif // TEXT_MARQUEE_HPP
@@ -0,0 +1,75 @@
+#ifndef TRACE_FORMAT_H
+#define TRACE_FORMAT_H
+
+#include <stdint.h>
+
+/**
+ * Command Trace Format
+ *
+ * The "trace" partition is a circular log of 256-byte pages (the flash
+ * program unit), 16 per 4 KB erase sector (see TraceLog):
+ *
+ *   | page header | record | record | ... | 0xFF (unused) |
+ *
+ * The page header holds a sequence number, incremented for every page, so
+ * the oldest and newest pages can be found after a restart or in a dump.
+ * Records never cross a page boundary; a record type of 0xFF (erased flash)
+ * ends the page. Each record is a TraceRecord header followed by `length`
+ * payload bytes as given for its type. All values are little-endian.
+ *
+ * Partition (partitions.csv):
+ * trace, data, 0x41, 0x2D0000, 64K
+ */
+
+// Flash program unit and erase unit
+static constexpr uint16_t TRACE_PAGE_SIZE = 256;
+static constexpr uint16_t TRACE_SECTOR_SIZE = 4096;
+static constexpr uint16_t TRACE_PAGE_MAGIC = 0x5254; // "TR"
+// Packet bytes kept per PACKET record (TEXT_SET fits; asset chunks are cut)
+static constexpr uint8_t TRACE_PACKET_BYTES = 72;
+
+/**
+ * Trace Record Types
+ */
+enum class TraceRecordType : uint8_t {
+    BOOT = 0x01,   // Firmware started (no payload)
+    PACKET = 0x02, // ESP-NOW packet received (TracePacket + packet bytes)
+    MOTOR = 0x03,  // Motor command applied (TraceMotor)
+    FRAMES = 0x04, // Render loop timing since the last FRAMES record (TraceFrames)
+    END = 0xFF,    // Erased flash: no more records in the page
+};
+
+struct __attribute__((packed)) TracePageHeader {
+    uint16_t magic;    // TRACE_PAGE_MAGIC
+    uint32_t sequence; // Incremented for every page written
+};
+
+struct __attribute__((packed)) TraceRecord {
+    TraceRecordType type;
+    uint8_t length;  // Payload bytes after this header
+    uint32_t timeMs; // millis() when the event happened
+};
+
+struct __attribute__((packed)) TracePacket {
+    uint8_t length; // Received length (packet bytes follow, at most TRACE_PACKET_BYTES)
+};
+
+struct __attribute__((packed)) TraceMotor {
+    uint8_t direction; // Direction being executed
+    uint8_t speedA;    // Open-loop PWM duties of the command
+    uint8_t speedB;
+};
+
+struct __attribute__((packed)) TraceFrames {
+    uint16_t frames;    // Frames rendered
+    uint16_t averageUs; // Average AnimationController::update time (us)
+    uint16_t maxUs;     // Longest update (us, saturated)
+    uint16_t dropped;   // Records lost because the trace queue was full
+};
+
+// Largest record: a packet record with a full packet copy
+static constexpr uint16_t TRACE_RECORD_MAX =
+    sizeof(TraceRecord) + sizeof(TracePacket) + TRACE_PACKET_BYTES;
+static_assert(sizeof(TracePageHeader) + TRACE_RECORD_MAX <= TRACE_PAGE_SIZE, "A record must fit one page");
+
+#endif // TRACE_FORMAT_H
@@ -0,0 +1,236 @@
+#ifndef TRACE_LOG_HPP
+#define TRACE_LOG_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "trace_format.h"
+
+/**
+ * TraceLog Class
+ *
+ * Appends trace records to a circular log of flash pages (see
+ * trace_format.h). Records are collected in a RAM copy of the current page
+ * and programmed in one page-sized write when the page is full; flush()
+ * programs a partly filled page early (only the bytes added since the last
+ * flush, which are still erased in flash), so little is lost at power-off.
+ * Entering a new sector erases it, dropping the oldest 16 pages.
+ *
+ * begin() finds the newest page by its sequence number and continues on
+ * the page after it, so each start of the firmware opens a new page.
+ *
+ * Flash operations block (a sector erase takes ~45 ms): call this from a
+ * background task only (see TraceRecorder).
+ *
+ * Works on any Flash type with size(), read(), write() and erase()
+ * (PartitionFlash on the robot, NorFlash on the host).
+ */
+template <typename Flash>
+class TraceLog {
+public:
+    static constexpr uint16_t PAGES_PER_SECTOR = TRACE_SECTOR_SIZE / TRACE_PAGE_SIZE;
+
+    explicit TraceLog(Flash& flash) : flash(flash) {}
+
+    /**
+     * Find the end of the log and open the page after it
+     *
+     * @return false if the partition is too small or cannot be read
+     */
+    bool begin() {
+        pageCount = flash.size() / TRACE_SECTOR_SIZE * PAGES_PER_SECTOR;
+        if (pageCount < 2 * PAGES_PER_SECTOR) {
+            return false;
+        }
+        bool found = false;
+        uint32_t newest = 0;
+        size_t newestPage = 0;
+        for (size_t i = 0; i < pageCount; i++) {
+            TracePageHeader header;
+            if (!flash.read(i * TRACE_PAGE_SIZE, &header, sizeof(header))) {
+                return false;
+            }
+            if (header.magic == TRACE_PAGE_MAGIC && header.sequence != UINT32_MAX &&
+                (!found || header.sequence > newest)) {
+                found = true;
+                newest = header.sequence;
+                newestPage = i;
+            }
+        }
+        page = found ? (newestPage + 1) % pageCount : 0;
+        sequence = found ? newest + 1 : 1;
+        // A page inside a sector is only programmed if it is still erased;
+        // otherwise continue at the next sector, which gets erased first
+        if (page % PAGES_PER_SECTOR != 0 && !isBlank(page)) {
+            page = (page / PAGES_PER_SECTOR + 1) * PAGES_PER_SECTOR % pageCount;
+        }
+        openPage();
+        return true;
+    }
+
+    /**
+     * Add a record (programs the current page first if the record does not fit)
+     *
+     * @param type Record type
+     * @param timeMs Event time (milliseconds)
+     * @param payload Record payload
+     * @param length Payload length
+     * @return false if a flash operation failed
+     */
+    bool add(TraceRecordType type, uint32_t timeMs, const void* payload, uint8_t length) {
+        if (sizeof(TraceRecord) + length > TRACE_PAGE_SIZE - sizeof(TracePageHeader)) {
+            return false;
+        }
+        bool ok = true;
+        if (used + sizeof(TraceRecord) + length > TRACE_PAGE_SIZE) {
+            ok = flush();
+            page = (page + 1) % pageCount;
+            sequence++;
+            openPage();
+        }
+        TraceRecord record = {type, length, timeMs};
+        memcpy(buffer + used, &record, sizeof(record));
+        memcpy(buffer + used + sizeof(record), payload, length);
+        used += sizeof(record) + length;
+        return ok;
+    }
+
+    /**
+     * Program the records added since the last flush
+     *
+     * @return false if a flash operation failed
+     */
+    bool flush() {
+        if (used == flushed) {
+            return true;
+        }
+        size_t offset = page * TRACE_PAGE_SIZE;
+        if (flushed == 0 && page % PAGES_PER_SECTOR == 0 && !flash.erase(offset, TRACE_SECTOR_SIZE)) {
+            return false;
+        }
+        bool ok = flash.write(offset + flushed, buffer + flushed, used - flushed);
+        flushed = used;
+        return ok;
+    }
+
+    /**
+     * Get the sequence number of the current page
+     */
+    uint32_t getSequence() const {
+        return sequence;
+    }
+
+private:
+    Flash& flash;
+    size_t pageCount = 0;
+    // Current page: flash position, RAM copy, bytes used and bytes programmed
+    size_t page = 0;
+    uint32_t sequence = 1;
+    uint8_t buffer[TRACE_PAGE_SIZE];
+    size_t used = 0;
+    size_t flushed = 0;
+
+    void openPage() {
+        memset(buffer, 0xFF, sizeof(buffer));
+        TracePageHeader header = {TRACE_PAGE_MAGIC, sequence};
+        memcpy(buffer, &header, sizeof(header));
+        used = sizeof(header);
+        flushed = 0;
+    }
+
+    bool isBlank(size_t index) {
+        uint8_t data[TRACE_PAGE_SIZE];
+        if (!flash.read(index * TRACE_PAGE_SIZE, data, sizeof(data))) {
+            return false;
+        }
+        for (uint8_t byte : data) {
+            if (byte != 0xFF) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+/**
+ * TraceReader Class
+ *
+ * Reads the records of a trace partition image (e.g. a dump of the
+ * partition) in the order they were written, from the oldest page still in
+ * the log to the newest. No allocation; used by the host replay tool.
+ */
+class TraceReader {
+public:
+    /**
+     * @param image Partition contents
+     * @param size Partition size
+     */
+    TraceReader(const uint8_t* image, size_t size) : image(image), pageCount(size / TRACE_PAGE_SIZE) {}
+
+    /**
+     * Call a visitor for every record, oldest first
+     *
+     * @param visit Called as visit(const TraceRecord& record, const uint8_t* payload)
+     * @return Number of pages read
+     */
+    template <typename Visitor>
+    size_t forEach(Visitor visit) const {
+        // Newest page, then back while the sequence numbers are consecutive
+        size_t newest = 0;
+        uint32_t newestSequence = 0;
+        bool found = false;
+        for (size_t i = 0; i < pageCount; i++) {
+            TracePageHeader header = readHeader(i);
+            if (isValid(header) && (!found || header.sequence > newestSequence)) {
+                found = true;
+                newest = i;
+                newestSequence = header.sequence;
+            }
+        }
+        if (!found) {
+            return 0;
+        }
+        size_t pages = 1;
+        size_t oldest = newest;
+        while (pages < pageCount) {
+            size_t previous = (oldest + pageCount - 1) % pageCount;
+            TracePageHeader header = readHeader(previous);
+            if (!isValid(header) || header.sequence != newestSequence - pages) {
+                break;
+            }
+            oldest = previous;
+            pages++;
+        }
+        for (size_t i = 0; i < pages; i++) {
+            const uint8_t* data = image + (oldest + i) % pageCount * TRACE_PAGE_SIZE;
+            size_t offset = sizeof(TracePageHeader);
+            while (offset + sizeof(TraceRecord) <= TRACE_PAGE_SIZE) {
+                TraceRecord record;
+                memcpy(&record, data + offset, sizeof(record));
+                size_t size = sizeof(record) + record.length;
+                if (record.type == TraceRecordType::END || offset + size > TRACE_PAGE_SIZE) {
+                    break;
+                }
+                visit(record, data + offset + sizeof(record));
+                offset += size;
+            }
+        }
+        return pages;
+    }
+
+private:
+    const uint8_t* image;
+    size_t pageCount;
+
+    TracePageHeader readHeader(size_t index) const {
+        TracePageHeader header;
+        memcpy(&header, image + index * TRACE_PAGE_SIZE, sizeof(header));
+        return header;
+    }
+
+    static bool isValid(const TracePageHeader& header) {
+        return header.magic == TRACE_PAGE_MAGIC && header.sequence != UINT32_MAX;
+    }
+};
+
+#endif // TRACE_LOG_HPP
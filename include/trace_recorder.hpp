@@ -0,0 +1,173 @@
+#ifndef TRACE_RECORDER_HPP
+#define TRACE_RECORDER_HPP
+
+#include <Arduino.h>
+#include <atomic>
+#include "constants.h"
+#include "motor_controller.hpp"
+#include "partition_flash.hpp"
+#include "trace_format.h"
+#include "trace_log.hpp"
+
+// Custom data partition subtype and label (see partitions.csv)
+static constexpr uint8_t TRACE_PARTITION_SUBTYPE = 0x41;
+static constexpr const char* TRACE_PARTITION_LABEL = "trace";
+
+/**
+ * TraceRecorder Class
+ *
+ * Keeps a trace of received packets, applied motor commands and render
+ * loop timing in the "trace" flash partition (see trace_format.h), so a
+ * field problem can be replayed on the host (host/trace_replay).
+ *
+ * The record functions only copy the event into a queue and never wait:
+ * when the queue is full the record is dropped and counted. A low-priority
+ * task drains the queue into a TraceLog, which programs whole pages and
+ * erases sectors as the log wraps. Records still in a partly filled page
+ * are programmed at least every FLUSH_INTERVAL_MS, so a power cut loses at
+ * most that much of the trace.
+ */
+class TraceRecorder {
+public:
+    TraceRecorder() : log(flash) {}
+
+    /**
+     * Open the trace partition and start the write task
+     *
+     * @return true if initialization successful, false otherwise
+     */
+    bool begin() {
+        if (!flash.begin() || !log.begin()) {
+            return false;
+        }
+        queue = xQueueCreate(QUEUE_DEPTH, sizeof(Entry));
+        if (!queue) {
+            return false;
+        }
+        record(TraceRecordType::BOOT, nullptr, 0);
+        framesStart = millis();
+        return xTaskCreate(&TraceRecorder::taskEntry, "trace", TASK_STACK_SIZE, this, TASK_PRIORITY, &task) ==
+               pdPASS;
+    }
+
+    /**
+     * Record a received ESP-NOW packet (from the receive callback)
+     *
+     * @param data Packet data
+     * @param len Packet length
+     */
+    void recordPacket(const uint8_t* data, int len) {
+        uint8_t payload[sizeof(TracePacket) + TRACE_PACKET_BYTES];
+        uint8_t kept = (uint8_t)(len < TRACE_PACKET_BYTES ? len : TRACE_PACKET_BYTES);
+        payload[0] = (uint8_t)len;
+        memcpy(payload + sizeof(TracePacket), data, kept);
+        record(TraceRecordType::PACKET, payload, sizeof(TracePacket) + kept);
+    }
+
+    /**
+     * Record the motor command being executed
+     *
+     * @param motors Motor controller after the command
+     */
+    void recordMotor(const MotorController& motors) {
+        MotorController::MotorSpeed speed = motors.getActiveSpeed();
+        TraceMotor motor = {(uint8_t)motors.getActiveDirection(), speed.motorA, speed.motorB};
+        record(TraceRecordType::MOTOR, &motor, sizeof(motor));
+    }
+
+    /**
+     * Record the time one render loop update took (from the main loop)
+     * A FRAMES record summarizes the updates every FRAMES_INTERVAL_MS.
+     *
+     * @param durationUs Update time (microseconds)
+     */
+    void recordFrame(uint32_t durationUs) {
+        frameCount++;
+        frameTotalUs += durationUs;
+        frameMaxUs = durationUs > frameMaxUs ? durationUs : frameMaxUs;
+        uint32_t now = millis();
+        if (now - framesStart < FRAMES_INTERVAL_MS) {
+            return;
+        }
+        TraceFrames frames = {};
+        frames.frames = (uint16_t)frameCount;
+        frames.averageUs = (uint16_t)(frameTotalUs / frameCount);
+        frames.maxUs = (uint16_t)(frameMaxUs < UINT16_MAX ? frameMaxUs : UINT16_MAX);
+        frames.dropped = (uint16_t)dropped.exchange(0);
+        record(TraceRecordType::FRAMES, &frames, sizeof(frames));
+        framesStart = now;
+        frameCount = 0;
+        frameTotalUs = 0;
+        frameMaxUs = 0;
+    }
+
+private:
+    // Events buffered for the write task (~2.5 KB)
+    static constexpr UBaseType_t QUEUE_DEPTH = 32;
+    static constexpr uint32_t TASK_STACK_SIZE = 3072;
+    static constexpr UBaseType_t TASK_PRIORITY = 1;
+    // Longest time records stay in RAM only
+    static constexpr uint32_t FLUSH_INTERVAL_MS = 2000;
+    // Render timing summary interval
+    static constexpr uint32_t FRAMES_INTERVAL_MS = 1000;
+
+    /**
+     * Event passed to the write task
+     */
+    struct Entry {
+        TraceRecordType type;
+        uint8_t length;
+        uint32_t timeMs;
+        uint8_t payload[sizeof(TracePacket) + TRACE_PACKET_BYTES];
+    };
+
+    PartitionFlash flash{TRACE_PARTITION_SUBTYPE, TRACE_PARTITION_LABEL};
+    TraceLog<PartitionFlash> log;
+    QueueHandle_t queue = nullptr;
+    TaskHandle_t task = nullptr;
+    std::atomic<uint32_t> dropped{0};
+    // Render timing since the last FRAMES record (main loop only)
+    uint32_t framesStart = 0;
+    uint32_t frameCount = 0;
+    uint32_t frameTotalUs = 0;
+    uint32_t frameMaxUs = 0;
+
+    void record(TraceRecordType type, const void* payload, uint8_t length) {
+        if (!queue) {
+            return;
+        }
+        Entry entry;
+        entry.type = type;
+        entry.length = length;
+        entry.timeMs = millis();
+        if (length > 0) {
+            memcpy(entry.payload, payload, length);
+        }
+        if (xQueueSend(queue, &entry, 0) != pdTRUE) {
+            dropped++;
+        }
+    }
+
+    static void taskEntry(void* arg) {
+        static_cast<TraceRecorder*>(arg)->run();
+    }
+
+    /**
+     * Write task: adds queued events to the log and flushes it periodically
+     */
+    void run() {
+        Entry entry;
+        uint32_t lastFlush = millis();
+        while (true) {
+            if (xQueueReceive(queue, &entry, pdMS_TO_TICKS(FLUSH_INTERVAL_MS)) == pdTRUE) {
+                log.add(entry.type, entry.timeMs, entry.payload, entry.length);
+            }
+            if (millis() - lastFlush >= FLUSH_INTERVAL_MS) {
+                log.flush();
+                lastFlush = millis();
+            }
+        }
+    }
+};
+
+#endif // TRACE_RECORDER_HPP
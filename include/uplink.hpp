@@ -0,0 +1,128 @@
+#ifndef UPLINK_HPP
+#define UPLINK_HPP
+
+#include <Arduino.h>
+#include <atomic>
+#include <esp_now.h>
+#include <string.h>
+#include "protocol.h"
+
+/**
+ * Uplink Class
+ *
+ * Sends packets from the robot back to its remote controller over ESP-NOW.
+ * The controller's MAC address is learned from the packets it sends, and it
+ * is registered as a peer lazily from the sending context, so the receive
+ * callback never does more than a copy. Packets are sent from several tasks
+ * (timers, the asset writer, the receive callback), so the MAC addresses
+ * are only copied under a critical section.
+ */
+class Uplink {
+public:
+    Uplink() = default;
+
+    /**
+     * Record the sender of a received command as the controller
+     * Safe to call from the ESP-NOW receive callback.
+     *
+     * @param mac Sender MAC address (6 bytes)
+     */
+    void setController(const uint8_t* mac) {
+        portENTER_CRITICAL(&lock);
+        if (state.load() == NO_CONTROLLER || memcmp(mac, controllerMac, ESP_NOW_ETH_ALEN) != 0) {
+            memcpy(controllerMac, mac, ESP_NOW_ETH_ALEN);
+            state.store(NEEDS_PEER);
+        }
+        portEXIT_CRITICAL(&lock);
+    }
+
+    /**
+     * Send a packet to the controller (non-blocking)
+     *
+     * @param data Packet data
+     * @param len Packet length (up to 250 bytes)
+     * @return true if the packet was queued for transmission
+     */
+    bool send(const void* data, size_t len) {
+        uint8_t expected = NEEDS_PEER;
+        if (state.compare_exchange_strong(expected, UPDATING)) {
+            bool registered = registerPeer();
+            // Try again with the next packet if the peer could not be added;
+            // leave NEEDS_PEER in place if the controller changed meanwhile
+            expected = UPDATING;
+            state.compare_exchange_strong(expected, registered ? READY : NEEDS_PEER);
+            if (!registered) {
+                return false;
+            }
+        } else if (expected != READY) {
+            return false;
+        }
+        uint8_t mac[ESP_NOW_ETH_ALEN];
+        portENTER_CRITICAL(&lock);
+        memcpy(mac, peerMac, ESP_NOW_ETH_ALEN);
+        portEXIT_CRITICAL(&lock);
+        return esp_now_send(mac, (const uint8_t*)data, len) == ESP_OK;
+    }
+
+    /**
+     * Check whether a controller has been seen
+     */
+    bool hasController() const {
+        return state.load() != NO_CONTROLLER;
+    }
+
+    /**
+     * Register the broadcast address as a peer, if not yet registered
+     *
+     * @return true if the broadcast peer is registered
+     */
+    static bool addBroadcastPeer() {
+        esp_now_peer_info_t peer = {};
+        memcpy(peer.peer_addr, ESPNOW_BROADCAST_MAC, ESP_NOW_ETH_ALEN);
+        peer.channel = 0; // Current WiFi channel
+        peer.encrypt = false;
+        return esp_now_is_peer_exist(peer.peer_addr) || esp_now_add_peer(&peer) == ESP_OK;
+    }
+
+private:
+    static constexpr uint8_t NO_CONTROLLER = 0;
+    static constexpr uint8_t UPDATING = 1;
+    static constexpr uint8_t NEEDS_PEER = 2;
+    static constexpr uint8_t READY = 3;
+
+    std::atomic<uint8_t> state{NO_CONTROLLER};
+    // Guards both addresses (copies only, never held across ESP-NOW calls)
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    uint8_t controllerMac[ESP_NOW_ETH_ALEN] = {};
+    uint8_t peerMac[ESP_NOW_ETH_ALEN] = {};
+
+    /**
+     * Replace the registered peer with the current controller
+     *
+     * @return true if the controller was added as a peer
+     */
+    bool registerPeer() {
+        uint8_t previous[ESP_NOW_ETH_ALEN];
+        esp_now_peer_info_t peer = {};
+        portENTER_CRITICAL(&lock);
+        memcpy(previous, peerMac, ESP_NOW_ETH_ALEN);
+        memcpy(peer.peer_addr, controllerMac, ESP_NOW_ETH_ALEN);
+        portEXIT_CRITICAL(&lock);
+
+        if (esp_now_is_peer_exist(previous)) {
+            esp_now_del_peer(previous);
+        }
+        peer.channel = 0;  // Current WiFi channel
+        peer.encrypt = false;
+        if (!esp_now_is_peer_exist(peer.peer_addr) && esp_now_add_peer(&peer) != ESP_OK) {
+            return false;
+        }
+
+        portENTER_CRITICAL(&lock);
+        memcpy(peerMac, peer.peer_addr, ESP_NOW_ETH_ALEN);
+        portEXIT_CRITICAL(&lock);
+        return true;
+    }
+};
+
+#endif // UPLINK_HPP
@@ -0,0 +1,111 @@
+#ifndef WHEEL_ENCODER_HPP
+#define WHEEL_ENCODER_HPP
+
+#include <driver/pulse_cnt.h>
+
+/**
+ * WheelEncoder Class
+ *
+ * Counts pulses from one single-channel encoder per track using the ESP32
+ * pulse counter (PCNT) peripheral, so no CPU time is spent per pulse.
+ * The encoders have no direction output; the direction of travel is
+ * already known from the command being executed.
+ *
+ * Encoder Connections:
+ * - D8: Motor A encoder output
+ * - D9: Motor B encoder output
+ */
+class WheelEncoder {
+public:
+    WheelEncoder() = default;
+
+    /**
+     * Initialize the pulse counter units
+     *
+     * @return true if initialization successful, false otherwise
+     */
+    bool begin() {
+        return initUnit(ENCODER_A, unitA) && initUnit(ENCODER_B, unitB);
+    }
+
+    /**
+     * Read the number of pulses counted since the previous call
+     *
+     * @param countsA Receives pulses of motor A
+     * @param countsB Receives pulses of motor B
+     */
+    void readDeltas(uint16_t& countsA, uint16_t& countsB) {
+        countsA = delta(unitA, lastCountA);
+        countsB = delta(unitB, lastCountB);
+    }
+
+private:
+    /**
+     * Encoder Pin Definitions
+     */
+    static constexpr uint8_t ENCODER_A = D8;
+    static constexpr uint8_t ENCODER_B = D9;
+    // Counter wraps to zero when it reaches this value
+    static constexpr int COUNT_LIMIT = 32767;
+    // Pulses shorter than this are treated as noise (nanoseconds)
+    static constexpr uint32_t GLITCH_FILTER_NS = 1000;
+
+    pcnt_unit_handle_t unitA = nullptr;
+    pcnt_unit_handle_t unitB = nullptr;
+    int lastCountA = 0;
+    int lastCountB = 0;
+
+    /**
+     * Configure one PCNT unit to count rising edges on a pin
+     *
+     * @param pin Encoder input pin
+     * @param unit Receives the created unit handle
+     * @return true if successful
+     */
+    bool initUnit(uint8_t pin, pcnt_unit_handle_t& unit) {
+        pcnt_unit_config_t unitConfig = {};
+        unitConfig.low_limit = -1;
+        unitConfig.high_limit = COUNT_LIMIT;
+        if (pcnt_new_unit(&unitConfig, &unit) != ESP_OK) {
+            return false;
+        }
+
+        pcnt_glitch_filter_config_t filterConfig = {};
+        filterConfig.max_glitch_ns = GLITCH_FILTER_NS;
+        pcnt_unit_set_glitch_filter(unit, &filterConfig);
+
+        pcnt_chan_config_t channelConfig = {};
+        channelConfig.edge_gpio_num = pin;
+        channelConfig.level_gpio_num = -1;
+        pcnt_channel_handle_t channel = nullptr;
+        if (pcnt_new_channel(unit, &channelConfig, &channel) != ESP_OK) {
+            return false;
+        }
+        pcnt_channel_set_edge_action(channel, PCNT_CHANNEL_EDGE_ACTION_INCREASE,
+                                     PCNT_CHANNEL_EDGE_ACTION_HOLD);
+
+        return pcnt_unit_enable(unit) == ESP_OK &&
+               pcnt_unit_clear_count(unit) == ESP_OK &&
+               pcnt_unit_start(unit) == ESP_OK;
+    }
+
+    /**
+     * Compute pulses since the last read, handling counter wrap-around
+     *
+     * @param unit PCNT unit to read
+     * @param lastCount Count at the previous read (updated)
+     * @return Number of new pulses
+     */
+    uint16_t delta(pcnt_unit_handle_t unit, int& lastCount) {
+        int count = 0;
+        pcnt_unit_get_count(unit, &count);
+        int diff = count - lastCount;
+        if (diff < 0) {
+            diff += COUNT_LIMIT;
+        }
+        lastCount = count;
+        return (uint16_t)diff;
+    }
+};
+
+#endif // WHEEL_ENCODER_HPP
@@ -0,0 +1,156 @@
+#ifndef WHEEL_SPEED_LOOP_HPP
+#define WHEEL_SPEED_LOOP_HPP
+
+#include <atomic>
+#include <esp_timer.h>
+#include "constants.h"
+#include "motor_controller.hpp"
+#include "speed_controller.hpp"
+#include "wheel_encoder.hpp"
+
+/**
+ * WheelSpeedLoop Class
+ *
+ * Runs the closed-loop track speed controller at a fixed rate.
+ * A periodic esp_timer (backed by the SYSTIMER hardware timer) reads the
+ * wheel encoders, runs the PI controller and updates the motor PWM duties.
+ * Direction pins are still set by MotorController::executeCommand.
+ *
+ * Only compiled in when WHEEL_ENCODERS_ENABLED is set.
+ */
+class WheelSpeedLoop {
+public:
+    /**
+     * Target Track Speeds (encoder counts per control period)
+     * Both tracks get the same target so the robot runs straight
+     * regardless of the motor asymmetry.
+     */
+    struct TrackTarget {
+        uint16_t motorA;
+        uint16_t motorB;
+    };
+
+    static constexpr TrackTarget TARGET_FORWARD = {12, 12};
+    static constexpr TrackTarget TARGET_BACKWARD = {10, 10};
+    static constexpr TrackTarget TARGET_TURN = {9, 9};
+
+    explicit WheelSpeedLoop(MotorController& motors) : motors(motors) {}
+
+    /**
+     * Initialize encoders and start the control timer
+     *
+     * @return true if initialization successful, false otherwise
+     */
+    bool begin() {
+        if (!encoder.begin()) {
+            return false;
+        }
+
+        esp_timer_create_args_t timerArgs = {};
+        timerArgs.callback = &WheelSpeedLoop::onTimer;
+        timerArgs.arg = this;
+        timerArgs.dispatch_method = ESP_TIMER_TASK;
+        timerArgs.name = "wheel_speed";
+        if (esp_timer_create(&timerArgs, &timer) != ESP_OK) {
+            return false;
+        }
+        return esp_timer_start_periodic(timer, CONTROL_PERIOD_US) == ESP_OK;
+    }
+
+    /**
+     * Notify the loop of a new movement command
+     * Safe to call from the ESP-NOW receive callback.
+     *
+     * @param direction Movement direction from constants.h
+     */
+    void setCommand(Direction direction) {
+        pendingDirection.store((uint8_t)direction);
+    }
+
+    /**
+     * Get the pulses counted on each track since start-up
+     * (wraps around; use differences between reads)
+     *
+     * @param countsA Receives total pulses of motor A
+     * @param countsB Receives total pulses of motor B
+     */
+    void getTotalCounts(uint32_t& countsA, uint32_t& countsB) const {
+        countsA = totalCountsA.load();
+        countsB = totalCountsB.load();
+    }
+
+private:
+    // Control period (10 ms = 100 Hz)
+    static constexpr uint64_t CONTROL_PERIOD_US = 10000;
+    // Marker for "no pending command"
+    static constexpr uint8_t NO_COMMAND = 0xFF;
+
+    MotorController& motors;
+    WheelEncoder encoder;
+    SpeedController controller;
+    esp_timer_handle_t timer = nullptr;
+    std::atomic<uint8_t> pendingDirection{NO_COMMAND};
+    std::atomic<uint32_t> totalCountsA{0};
+    std::atomic<uint32_t> totalCountsB{0};
+
+    /**
+     * Timer callback trampoline
+     *
+     * @param arg Pointer to the WheelSpeedLoop instance
+     */
+    static void onTimer(void* arg) {
+        static_cast<WheelSpeedLoop*>(arg)->controlStep();
+    }
+
+    /**
+     * One control period: apply new targets, read encoders, update PWM
+     */
+    void controlStep() {
+        uint8_t command = pendingDirection.exchange(NO_COMMAND);
+        if (command != NO_COMMAND) {
+            applyTarget((Direction)command);
+        }
+
+        uint16_t countsA;
+        uint16_t countsB;
+        encoder.readDeltas(countsA, countsB);
+        totalCountsA.fetch_add(countsA);
+        totalCountsB.fetch_add(countsB);
+
+        auto duty = controller.update(countsA, countsB);
+        auto active = motors.getActiveSpeed();
+        if (active.motorA != 0 || active.motorB != 0) {
+            motors.applyDuty(duty.motorA, duty.motorB);
+        }
+    }
+
+    /**
+     * Select target speeds for a command and restart the integrators
+     *
+     * @param direction Movement direction from constants.h
+     */
+    void applyTarget(Direction direction) {
+        TrackTarget target = {0, 0};
+        switch (direction) {
+        case Direction::FORWARD:
+            target = TARGET_FORWARD;
+            break;
+        case Direction::BACKWARD:
+            target = TARGET_BACKWARD;
+            break;
+        case Direction::LEFT:
+        case Direction::RIGHT:
+            target = TARGET_TURN;
+            break;
+        default:
+            break;
+        }
+
+        auto feedforward = motors.getActiveSpeed();
+        controller.reset();
+        controller.setTarget(target.motorA, target.motorB,
+                             {feedforward.motorA, feedforward.motorB});
+    }
+};
+
+#endif // WHEEL_SPEED_LOOP_HPP
@@ -0,0 +1,102 @@
+#ifndef WS2812_ENCODER_HPP
+#define WS2812_ENCODER_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include "output_lut.hpp"
+
+/**
+ * Build an RMT symbol word
+ *
+ * @param level0 Output level of the first half
+ * @param duration0 Length of the first half (ticks)
+ * @param level1 Output level of the second half
+ * @param duration1 Length of the second half (ticks)
+ * @return Symbol in rmt_symbol_word_t layout
+ */
+constexpr uint32_t rmtSymbol(uint8_t level0, uint16_t duration0, uint8_t level1, uint16_t duration1) {
+    return (uint32_t)(duration0 & 0x7FFF) | ((uint32_t)(level0 & 1) << 15) |
+           ((uint32_t)(duration1 & 0x7FFF) << 16) | ((uint32_t)(level1 & 1) << 31);
+}
+
+/**
+ * Ws2812Encoder Class
+ *
+ * Encodes a frame of RGB pixels into the RMT symbol stream that drives
+ * WS2812B LEDs: 24 bits per LED in GRB order, most significant bit first,
+ * followed by a reset (latch) period.
+ *
+ * Each RMT symbol is a 32-bit word holding two (level, duration) pairs,
+ * in the layout of ESP-IDF's rmt_symbol_word_t:
+ * - bits 0-14: duration0, bit 15: level0
+ * - bits 16-30: duration1, bit 31: level1
+ *
+ * The whole frame is encoded up front so the transfer can run from the
+ * buffer without CPU involvement. No hardware dependencies: the same code
+ * is checked against the WS2812B timing spec on the host (host/ws2812_check).
+ */
+class Ws2812Encoder {
+public:
+    // RMT tick rate (10 MHz = 0.1 us per tick)
+    static constexpr uint32_t RESOLUTION_HZ = 10000000;
+
+    /**
+     * Bit Timing (ticks)
+     * WS2812B: T0H 0.40 us, T0L 0.85 us, T1H 0.80 us, T1L 0.45 us (+/-0.15 us)
+     */
+    static constexpr uint16_t T0H = 4;
+    static constexpr uint16_t T0L = 8;
+    static constexpr uint16_t T1H = 8;
+    static constexpr uint16_t T1L = 5;
+    // Latch: line held low for 2 x 150 us (newer WS2812B need > 280 us)
+    static constexpr uint16_t RESET_HALF = 1500;
+
+    static constexpr size_t SYMBOLS_PER_LED = 24;
+
+    static constexpr uint32_t BIT0 = rmtSymbol(1, T0H, 0, T0L);
+    static constexpr uint32_t BIT1 = rmtSymbol(1, T1H, 0, T1L);
+    static constexpr uint32_t RESET = rmtSymbol(0, RESET_HALF, 0, RESET_HALF);
+
+    /**
+     * Number of symbols needed for a frame
+     *
+     * @param ledCount Number of LEDs
+     * @return Symbols including the reset symbol
+     */
+    static constexpr size_t frameSymbols(size_t ledCount) {
+        return ledCount * SYMBOLS_PER_LED + 1;
+    }
+
+    /**
+     * Encode a frame through fused output tables, with temporal dithering
+     *
+     * @param rgb Pixel data, 3 bytes per LED in R, G, B order
+     * @param ledCount Number of LEDs
+     * @param lut Gamma, brightness and correction tables
+     * @param error Carried fractions, 3 bytes per LED (updated)
+     * @param out Output buffer of frameSymbols(ledCount) words
+     */
+    static void encode(const uint8_t* rgb, size_t ledCount, const OutputLut& lut, uint8_t* error, uint32_t* out) {
+        for (size_t i = 0; i < ledCount; i++, rgb += 3, error += 3) {
+            out = encodeByte(lut.map(1, rgb[1], error[1]), out);
+            out = encodeByte(lut.map(0, rgb[0], error[0]), out);
+            out = encodeByte(lut.map(2, rgb[2], error[2]), out);
+        }
+        *out = RESET;
+    }
+
+private:
+    /**
+     * Encode one byte, most significant bit first
+     *
+     * @return Pointer past the 8 written symbols
+     */
+    static uint32_t* encodeByte(uint8_t value, uint32_t* out) {
+        for (uint8_t mask = 0x80; mask; mask >>= 1) {
+            *out++ = (value & mask) ? BIT1 : BIT0;
+        }
+        return out;
+    }
+};
+
+#endif // WS2812_ENCODER_HPP
@@ -0,0 +1,86 @@
+"""
+PlatformIO pre-build script: generate the animation assets
+
+Regenerates assets.h and the asset pack (assets.bin) from
+images/animations.json, skipping unchanged animations, and adds the
+header's directory to the include path of every env.
+
+For the firmware env it also adds an `upload_assets` target that writes
+the pack to the "assets" partition without reflashing the firmware:
+  pio run -t upload_assets
+
+The partition holds two pack slots (include/asset_slots.hpp); the upload
+erases both and writes the pack to slot 0 as generation 1.
+"""
+
+import csv
+import os
+import struct
+import sys
+import zlib
+
+Import("env")  # noqa: F821 (provided by PlatformIO)
+
+project_dir = env.subst("$PROJECT_DIR")  # noqa: F821
+sys.path.insert(0, os.path.join(project_dir, "scripts"))
+from generate_assets import generate  # noqa: E402
+
+generated_dir = os.path.join(env.subst("$PROJECT_BUILD_DIR"), "generated")  # noqa: F821
+pack_path = os.path.join(generated_dir, "assets.bin")
+generate(os.path.join(project_dir, "images", "animations.json"),
+         os.path.join(generated_dir, "assets.h"), pack_path)
+env.Append(CPPPATH=[generated_dir])  # noqa: F821
+
+
+def find_partition(label):
+    """Offset and size of a partition in partitions.csv"""
+    with open(os.path.join(project_dir, "partitions.csv")) as f:
+        for row in csv.reader(line for line in f if not line.startswith("#")):
+            if row and row[0].strip() == label:
+                return int(row[3], 0), int(row[4], 0)
+    raise ValueError(f"partition '{label}' not found in partitions.csv")
+
+
+# Slot layout (see AssetSlots)
+SLOT_MAGIC = 0x544F4C53
+SECTOR_SIZE = 4096
+
+
+def slot_capacity(partition_size):
+    """Largest pack one slot can hold"""
+    return partition_size // 2 // SECTOR_SIZE * SECTOR_SIZE - SECTOR_SIZE
+
+
+def slot_image(pack):
+    """Header sector + pack, as written by AssetWriter"""
+    fields = struct.pack("<III", SLOT_MAGIC, 1, len(pack))
+    header = fields + struct.pack("<I", zlib.crc32(fields))
+    return header.ljust(SECTOR_SIZE, b"\xff") + pack
+
+
+def upload_assets(target, source, env):
+    """Write the pack with esptool (port as for `pio run -t upload`)"""
+    offset, size = find_partition("assets")
+    image_path = os.path.join(generated_dir, "assets_slot.bin")
+    with open(pack_path, "rb") as f:
+        image = slot_image(f.read())
+    with open(image_path, "wb") as f:
+        f.write(image)
+    env.AutodetectUploadPort()
+    esptool = '"$PYTHONEXE" "$UPLOADER" --chip esp32c6 --port "$UPLOAD_PORT"'
+    # Clear both slots, so an older upload cannot have a newer generation
+    return (env.Execute(f"{esptool} erase_region 0x{offset:X} 0x{size:X}") or
+            env.Execute(f'{esptool} write_flash 0x{offset:X} "{image_path}"'))
+
+
+if env.get("PIOPLATFORM") != "native":  # noqa: F821
+    _, size = find_partition("assets")
+    if os.path.getsize(pack_path) > slot_capacity(size):
+        sys.exit(f"assets: pack is larger than an asset slot ({slot_capacity(size)} bytes)")
+    env.AddCustomTarget(  # noqa: F821
+        name="upload_assets",
+        dependencies=None,
+        actions=[upload_assets],
+        title="Upload Assets",
+        description="Write the animation pack to the assets partition",
+    )
@@ -0,0 +1,443 @@
+#!/usr/bin/env python3
+"""
+Animation Asset Generator
+
+Converts the PNG frame sequences listed in images/animations.json into a
+C++ header with the animation tables and a registry of animation names,
+and optionally into an asset pack for the flash asset partition (see
+include/asset_pack.hpp for the pack format). Runs before every PlatformIO
+build (scripts/build_assets.py) and can also be run by hand.
+
+Per animation, the config chooses:
+- frames:      file name pattern, e.g. "arrow_f{frame:02d}.png", and count
+- transform:   none, flip_h or flip_v
+- format:      rgb565 or rgb888
+- compression: none or rle
+- align:       frame start alignment in bytes (multiple of 4)
+- duration:    display time of each frame in ms, one value for all frames
+               or a list with one value per frame (default 100)
+- loop:        loop, pingpong or once (default loop)
+
+See include/asset_format.h for the word layout of each format. Identical
+frames are stored once. Encoded animations are cached next to the output
+keyed by the config entry and the size/mtime of their PNGs, so unchanged
+animations are not decoded again, and the header is only rewritten when
+its contents change (no needless recompiles).
+
+Usage:
+  python3 scripts/generate_assets.py [--config FILE] [--output FILE] [--pack FILE]
+
+Only the Python standard library is used (PNG decoding via zlib).
+"""
+
+import argparse
+import hashlib
+import json
+import os
+import re
+import struct
+import sys
+import zlib
+
+# Bump when the encoding changes to invalidate cached animations
+GENERATOR_VERSION = 2
+
+FORMATS = ("rgb565", "rgb888")
+COMPRESSIONS = ("none", "rle")
+TRANSFORMS = ("none", "flip_h", "flip_v")
+LOOP_MODES = ("loop", "pingpong", "once")
+# Longest run that fits in an RLE word
+MAX_RUN = {"rgb565": 0xFFFF, "rgb888": 0xFF}
+
+
+def read_png(path):
+    """Decode an 8-bit RGB or RGBA PNG into rows of (r, g, b) tuples"""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError(f"{path}: not a PNG file")
+
+    pos = 8
+    idat = b""
+    width = height = color_type = None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", body)
+            if depth != 8 or color_type not in (2, 6) or interlace:
+                raise ValueError(f"{path}: only 8-bit RGB/RGBA non-interlaced PNGs are supported")
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+
+    bpp = 3 if color_type == 2 else 4
+    stride = width * bpp
+    raw = zlib.decompress(idat)
+    rows = []
+    prev = bytearray(stride)
+    for y in range(height):
+        start = y * (stride + 1)
+        filter_type = raw[start]
+        line = bytearray(raw[start + 1:start + 1 + stride])
+        for x in range(stride):
+            a = line[x - bpp] if x >= bpp else 0
+            b = prev[x]
+            c = prev[x - bpp] if x >= bpp else 0
+            if filter_type == 1:
+                line[x] = (line[x] + a) & 0xFF
+            elif filter_type == 2:
+                line[x] = (line[x] + b) & 0xFF
+            elif filter_type == 3:
+                line[x] = (line[x] + (a + b) // 2) & 0xFF
+            elif filter_type == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                predictor = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[x] = (line[x] + predictor) & 0xFF
+        rows.append([tuple(line[x * bpp:x * bpp + 3]) for x in range(width)])
+        prev = line
+    return rows
+
+
+def transform(rows, kind):
+    if kind == "flip_v":
+        return rows[::-1]
+    if kind == "flip_h":
+        return [row[::-1] for row in rows]
+    return rows
+
+
+def to_pixels(rows, pixel_format):
+    """Pixel values in display order (RGB565 truncated, or 0xRRGGBB)"""
+    if pixel_format == "rgb565":
+        return [((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3) for row in rows for (r, g, b) in row]
+    return [(r << 16) | (g << 8) | b for row in rows for (r, g, b) in row]
+
+
+def encode(pixels, pixel_format, compression):
+    """Encode one frame into 32-bit words (see asset_format.h)"""
+    if compression == "rle":
+        shift = 16 if pixel_format == "rgb565" else 24
+        words = []
+        i = 0
+        while i < len(pixels):
+            length = 1
+            while (i + length < len(pixels) and pixels[i + length] == pixels[i]
+                   and length < MAX_RUN[pixel_format]):
+                length += 1
+            words.append((length << shift) | pixels[i])
+            i += length
+        return words
+    if pixel_format == "rgb565":
+        return [pixels[i] | (pixels[i + 1] << 16) for i in range(0, len(pixels), 2)]
+    return list(pixels)
+
+
+def load_config(path):
+    with open(path) as f:
+        config = json.load(f)
+    names = set()
+    for entry in config["animations"]:
+        entry.setdefault("transform", "none")
+        entry.setdefault("format", "rgb565")
+        entry.setdefault("compression", "none")
+        entry.setdefault("align", 4)
+        entry.setdefault("duration", 100)
+        entry.setdefault("loop", "loop")
+        name = entry["name"]
+        if not re.fullmatch(r"[a-z][a-z0-9_]*", name) or name in names:
+            raise ValueError(f"animation name '{name}' must be unique lower_snake_case")
+        names.add(name)
+        if entry["format"] not in FORMATS or entry["compression"] not in COMPRESSIONS:
+            raise ValueError(f"{name}: unknown format or compression")
+        if entry["transform"] not in TRANSFORMS:
+            raise ValueError(f"{name}: unknown transform")
+        if entry["align"] < 4 or entry["align"] % 4:
+            raise ValueError(f"{name}: align must be a multiple of 4 bytes")
+        if entry["loop"] not in LOOP_MODES:
+            raise ValueError(f"{name}: unknown loop mode")
+        durations = frame_durations(entry)
+        if len(durations) != entry["count"] or not all(isinstance(d, int) and 1 <= d <= 0xFFFF for d in durations):
+            raise ValueError(f"{name}: duration must be 1-65535 ms, once or per frame")
+    return config
+
+
+def frame_durations(entry):
+    """Display time of each frame (ms)"""
+    duration = entry["duration"]
+    return list(duration) if isinstance(duration, list) else [duration] * entry["count"]
+
+
+def frame_paths(entry, images):
+    return [os.path.join(images, entry["frames"].format(frame=n)) for n in range(entry["count"])]
+
+
+def cache_key(entry, paths):
+    """Hash of everything an encoded animation depends on"""
+    key = hashlib.sha1(json.dumps([GENERATOR_VERSION, entry], sort_keys=True).encode())
+    for path in paths:
+        stat = os.stat(path)
+        key.update(f"{os.path.basename(path)}:{stat.st_size}:{stat.st_mtime_ns}".encode())
+    return key.hexdigest()
+
+
+def encode_animation(entry, paths, width, height):
+    frames = []
+    for path in paths:
+        rows = read_png(path)
+        if len(rows) != height or len(rows[0]) != width:
+            raise ValueError(f"{path}: expected {width}x{height} pixels")
+        pixels = to_pixels(transform(rows, entry["transform"]), entry["format"])
+        frames.append(encode(pixels, entry["format"], entry["compression"]))
+    return frames
+
+
+def assemble(config, encoded):
+    """Lay out all frames in one word array, storing identical frames once"""
+    words = []
+    offsets = []
+    stored = {}
+    sizes = []
+    for entry, frames in zip(config["animations"], encoded):
+        align_words = entry["align"] // 4
+        start = len(words)
+        row = []
+        for frame in frames:
+            key = tuple(frame)
+            offset = stored.get(key)
+            if offset is None or offset % align_words:
+                words.extend([0] * (-len(words) % align_words))
+                offset = len(words)
+                stored[key] = offset
+                words.extend(frame)
+            row.append(offset)
+        offsets.append(row)
+        sizes.append((len(words) - start) * 4)
+    return words, offsets, sizes
+
+
+def identifier(name):
+    return name.upper()
+
+
+LOOP_IDENTIFIERS = {"loop": "LOOP", "pingpong": "PING_PONG", "once": "ONCE"}
+
+
+def render_header(config, words, offsets, sizes, source):
+    animations = config["animations"]
+    align = max(entry["align"] for entry in animations)
+    lines = [
+        "/**",
+        " * Animation Assets",
+        " *",
+        f" * Generated by scripts/generate_assets.py from {source} - do not edit.",
+        " * See asset_format.h for the frame encodings.",
+        " *",
+        " * Flash usage:",
+    ]
+    for entry, size in zip(animations, sizes):
+        lines.append(f" * - {entry['name']}: {size} bytes ({entry['format']}, {entry['compression']}, "
+                     f"align {entry['align']})")
+    offset_bytes = sum(len(row) for row in offsets) * 4
+    lines.append(f" * - total: {len(words) * 4} bytes + {offset_bytes} bytes of frame offsets")
+    lines += [
+        " */",
+        "",
+        "#ifndef ASSETS_H",
+        "#define ASSETS_H",
+        "",
+        "#include <string.h>",
+        '#include "asset_format.h"',
+        "",
+        "/**",
+        " * Animation ID Constants",
+        " */",
+        "enum class AnimationId : uint8_t {",
+    ]
+    for i, entry in enumerate(animations):
+        lines.append(f"    {identifier(entry['name'])} = {i},")
+    lines += [
+        "};",
+        "",
+        f"const uint8_t ANIMATION_COUNT = {len(animations)};",
+        f"const uint16_t ANIMATION_WIDTH = {config['width']};",
+        f"const uint16_t ANIMATION_HEIGHT = {config['height']};",
+        "",
+        "// Encoded frames of all animations",
+        f"alignas({align}) const uint32_t assetWords[{len(words)}] = {{",
+    ]
+    for i in range(0, len(words), 8):
+        lines.append("    " + " ".join(f"0x{w:08X}," for w in words[i:i + 8]))
+    lines += ["};", ""]
+    for entry, row in zip(animations, offsets):
+        lines.append(f"const uint32_t {entry['name']}FrameOffsets[{len(row)}] = {{")
+        for i in range(0, len(row), 12):
+            lines.append("    " + " ".join(f"{offset}," for offset in row[i:i + 12]))
+        lines.append("};")
+    for entry in animations:
+        durations = frame_durations(entry)
+        lines.append(f"const uint16_t {entry['name']}FrameDurations[{len(durations)}] = {{")
+        for i in range(0, len(durations), 12):
+            lines.append("    " + " ".join(f"{duration}," for duration in durations[i:i + 12]))
+        lines.append("};")
+    lines += [
+        "",
+        "// Animation registry, indexed by AnimationId",
+        "const AnimationAsset animationAssets[ANIMATION_COUNT] = {",
+    ]
+    for entry in animations:
+        lines.append(f"    {{\"{entry['name']}\", ANIMATION_WIDTH, ANIMATION_HEIGHT, {entry['count']}, "
+                     f"PixelFormat::{entry['format'].upper()}, Compression::{entry['compression'].upper()}, "
+                     f"assetWords, {entry['name']}FrameOffsets, {entry['name']}FrameDurations, "
+                     f"LoopMode::{LOOP_IDENTIFIERS[entry['loop']]}}},")
+    lines += [
+        "};",
+        "",
+        "/**",
+        " * Get an animation",
+        " */",
+        "inline const AnimationAsset& getAnimation(AnimationId id) {",
+        "    return animationAssets[(uint8_t)id];",
+        "}",
+        "",
+        "/**",
+        " * Look up an animation by name",
+        " *",
+        " * @return Animation, or nullptr if there is none with that name",
+        " */",
+        "inline const AnimationAsset* findAnimation(const char* name) {",
+        "    for (const auto& animation : animationAssets) {",
+        "        if (!strcmp(animation.name, name)) {",
+        "            return &animation;",
+        "        }",
+        "    }",
+        "    return nullptr;",
+        "}",
+        "",
+        "#endif // ASSETS_H",
+    ]
+    return "\n".join(lines) + "\n"
+
+
+PACK_MAGIC = 0x4B504E41  # "ANPK"
+PACK_VERSION = 2
+PACK_HEADER_SIZE = 16
+PACK_ENTRY_SIZE = 40
+PACK_NAME_LENGTH = 20
+
+
+def render_pack(config, words, offsets):
+    """Build the asset pack image (see include/asset_pack.hpp)"""
+    animations = config["animations"]
+    align = max(entry["align"] for entry in animations)
+    tables_start = PACK_HEADER_SIZE + PACK_ENTRY_SIZE * len(animations)
+    # Frame offset tables, then frame duration tables (each padded to 4 bytes)
+    tables_size = sum(4 * len(row) + 4 * ((len(row) + 1) // 2) for row in offsets)
+    data_start = tables_start + tables_size
+    data_start += -data_start % align
+    base_word = data_start // 4
+
+    entries = b""
+    tables = b""
+    duration_tables = b""
+    durations_start = tables_start + 4 * sum(len(row) for row in offsets)
+    for entry, row in zip(animations, offsets):
+        name = entry["name"].encode()
+        if len(name) >= PACK_NAME_LENGTH:
+            raise ValueError(f"{entry['name']}: name too long for the asset pack")
+        entries += struct.pack("<20sHHHBBB3xII", name, config["width"], config["height"], entry["count"],
+                               FORMATS.index(entry["format"]), COMPRESSIONS.index(entry["compression"]),
+                               LOOP_MODES.index(entry["loop"]), tables_start + len(tables),
+                               durations_start + len(duration_tables))
+        tables += struct.pack(f"<{len(row)}I", *[base_word + offset for offset in row])
+        durations = frame_durations(entry)
+        duration_tables += struct.pack(f"<{len(durations)}H", *durations)
+        duration_tables += b"\0" * (-len(duration_tables) % 4)
+    tables += duration_tables
+
+    body = entries + tables + b"\0" * (data_start - tables_start - tables_size)
+    body += struct.pack(f"<{len(words)}I", *words)
+    size = PACK_HEADER_SIZE + len(body)
+    header = struct.pack("<IHHII", PACK_MAGIC, PACK_VERSION, len(animations), size, zlib.crc32(body))
+    return header + body
+
+
+def write_if_changed(path, data):
+    """Write a file unless it already has this content; returns True if written"""
+    mode = "b" if isinstance(data, bytes) else ""
+    try:
+        with open(path, "r" + mode) as f:
+            if f.read() == data:
+                return False
+    except OSError:
+        pass
+    os.makedirs(os.path.dirname(os.path.abspath(path)), exist_ok=True)
+    with open(path, "w" + mode, **({} if mode else {"newline": "\n"})) as f:
+        f.write(data)
+    return True
+
+
+def generate(config_path, output_path, pack_path=None, log=print):
+    """
+    Regenerate the asset header (and pack) if needed
+
+    @return True if anything was written, False if all was up to date
+    """
+    config = load_config(config_path)
+    images = os.path.dirname(os.path.abspath(config_path))
+    cache_path = output_path + ".cache.json"
+    try:
+        with open(cache_path) as f:
+            cache = json.load(f)
+    except (OSError, ValueError):
+        cache = {}
+
+    encoded = []
+    new_cache = {}
+    for entry in config["animations"]:
+        paths = frame_paths(entry, images)
+        key = cache_key(entry, paths)
+        cached = cache.get(entry["name"])
+        if cached and cached["key"] == key:
+            frames = cached["frames"]
+        else:
+            log(f"assets: encoding {entry['name']} ({len(paths)} frames)")
+            frames = encode_animation(entry, paths, config["width"], config["height"])
+        encoded.append(frames)
+        new_cache[entry["name"]] = {"key": key, "frames": frames}
+
+    words, offsets, sizes = assemble(config, encoded)
+    source = os.path.relpath(config_path, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+    header = render_header(config, words, offsets, sizes, source.replace(os.sep, "/"))
+
+    changed = write_if_changed(output_path, header)
+    if changed:
+        log(f"assets: {output_path}: {len(config['animations'])} animations, {len(words) * 4} bytes")
+    if pack_path:
+        pack = render_pack(config, words, offsets)
+        if write_if_changed(pack_path, pack):
+            log(f"assets: {pack_path}: {len(pack)} bytes")
+            changed = True
+    if new_cache != cache:
+        with open(cache_path, "w") as f:
+            json.dump(new_cache, f)
+    return changed
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--config", default=os.path.join(root, "images", "animations.json"))
+    parser.add_argument("--output", default=os.path.join(root, ".pio", "build", "generated", "assets.h"))
+    parser.add_argument("--pack", help="also write an asset pack for the assets partition")
+    args = parser.parse_args()
+    if not generate(args.config, args.output, args.pack):
+        print(f"assets: {args.output} is up to date")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -19,7 +19,14 @@
  * Features:
  * - Real-time motor control based on received commands
  * - Animated arrow display showing current direction
- * - 12-frame animation cycle for smooth visual feedback
+ * - Time-based arrow animations, interpolated to the render rate, with
+ *   crossfades between directions
+ * - Scrolling text messages (TEXT_SET) in place of the arrows
+ * - Dead-reckoning pose reports back to the controller
+ * - Animation uploads over ESP-NOW (with ASSET_PARTITION_ENABLED)
+ * - Robot IDs and groups for fleet-wide broadcasts (with FLEET_ADDRESSING_ENABLED)
+ * - One controller at a time when several are in range (with CONTROL_ARBITER_ENABLED)
+ * - State samples sent to the controller (with TELEMETRY_ENABLED)
  */
 
 #include <FastLED.h>
@@ -30,6 +37,32 @@
 #include "motor_controller.hpp"
 #include "led_display.hpp"
 #include "animation_controller.hpp"
+#include "uplink.hpp"
+#include "pose_estimator.hpp"
+#if WHEEL_ENCODERS_ENABLED
+#include "wheel_speed_loop.hpp"
+#endif
+#if BATTERY_MONITOR_ENABLED
+#include "battery_monitor.hpp"
+#endif
+#if ASSET_PARTITION_ENABLED
+#include "asset_uploader.hpp"
+#endif
+#if TRACE_RECORDER_ENABLED
+#include "trace_recorder.hpp"
+#endif
+#if CLOCK_SYNC_ENABLED
+#include "fleet_clock.hpp"
+#endif
+#if FLEET_ADDRESSING_ENABLED
+#include "fleet_address.hpp"
+#endif
+#if CONTROL_ARBITER_ENABLED
+#include "control_arbiter.hpp"
+#endif
+#if TELEMETRY_ENABLED
+#include "telemetry.hpp"
+#endif
 
 /**
  * ESP-NOW Message Structure
@@ -44,32 +77,142 @@ typedef struct MessageStruct {
 MessageStruct messageData = {
     .direction = Direction::STOP
 };
-LGFX_Sprite arrowSprite;                 // 16x16 sprite for arrow rendering
+LGFX_Sprite arrowSprite;                 // 16x16 sprite for dynamic drawing
 MotorController motorController;         // Motor control interface
-LedDisplay ledDisplay;                   // LED matrix interface
+RobotLedDisplay ledDisplay;              // LED matrix interface
 AnimationController animationController; // Animation manager
+Uplink uplink;                           // Packets back to the controller
+#if WHEEL_ENCODERS_ENABLED
+WheelSpeedLoop wheelSpeedLoop(motorController); // Closed-loop track speed control
+PoseEstimator poseEstimator(motorController, uplink, wheelSpeedLoop); // Dead reckoning
+#else
+PoseEstimator poseEstimator(motorController, uplink); // Dead reckoning
+#endif
+#if BATTERY_MONITOR_ENABLED
+BatteryMonitor batteryMonitor(ledDisplay, motorController, uplink); // Battery and power governor
+#endif
+#if ASSET_PARTITION_ENABLED
+AssetUploader assetUploader(uplink); // Asset pack uploads over ESP-NOW
+#endif
+#if TRACE_RECORDER_ENABLED
+TraceRecorder traceRecorder; // Command trace in flash
+#endif
+#if CLOCK_SYNC_ENABLED
+FleetClock fleetClock; // Shared clock for synchronized shows
+#endif
+#if FLEET_ADDRESSING_ENABLED
+FleetAddress fleetAddress; // Robot ID and groups
+#endif
+#if CONTROL_ARBITER_ENABLED
+ControlArbiter controlArbiter; // Controller leases
+#endif
+#if TELEMETRY_ENABLED
+Telemetry telemetry(motorController, uplink); // State samples to the controller
+#endif
+
+// Serializes applyDirection(): commands come from the ESP-NOW receive
+// callback, the main loop and the MOVE_AT timer (esp_timer task)
+SemaphoreHandle_t commandMutex = nullptr;
+
+/**
+ * Execute a movement command
+ * Called from the ESP-NOW receive callback, or when a MOVE_AT command is due.
+ *
+ * @param direction Movement direction
+ */
+void applyDirection(Direction direction) {
+    xSemaphoreTake(commandMutex, portMAX_DELAY);
+    messageData.direction = direction;
+    Serial.printf("Received direction: %d\n", messageData.direction);
+
+    // Reset animation to start from first frame for new direction
+    animationController.reset();
+    // Execute motor control command
+    motorController.executeCommand(messageData.direction);
+#if TRACE_RECORDER_ENABLED
+    traceRecorder.recordMotor(motorController);
+#endif
+#if WHEEL_ENCODERS_ENABLED
+    wheelSpeedLoop.setCommand(messageData.direction);
+#endif
+    xSemaphoreGive(commandMutex);
+}
 
 /**
  * ESP-NOW Data Reception Callback
  *
- * @param esp_now_info Information about the sender (not used)
+ * @param esp_now_info Information about the sender
  * @param incomingData Pointer to received data buffer
  * @param len Length of received data in bytes
  */
 void OnDataRecv(const esp_now_recv_info_t *esp_now_info, const uint8_t *incomingData, int len) {
+#if TELEMETRY_ENABLED
+    telemetry.recordPacket(esp_now_info->rx_ctrl ? (int8_t)esp_now_info->rx_ctrl->rssi : 0);
+#endif
+#if CLOCK_SYNC_ENABLED
+    // Beacons first, so their receive time is taken without delay (not traced)
+    if (len > 0 && incomingData[0] == (uint8_t)PacketType::TIME_BEACON) {
+        fleetClock.handleBeacon(incomingData, len);
+        return;
+    }
+#endif
+#if CONTROL_ARBITER_ENABLED
+    // Drop packets from controllers not in charge (not traced, so replays match)
+    if (!controlArbiter.admit(esp_now_info->src_addr, incomingData, len)) {
+        return;
+    }
+#endif
+#if TRACE_RECORDER_ENABLED
+    traceRecorder.recordPacket(incomingData, len);
+#endif
+    // Typed packets (see protocol.h)
+    if (len > (int)sizeof(MessageStruct)) {
+        if (incomingData[0] == (uint8_t)PacketType::TEXT_SET) {
+            animationController.setText(incomingData, len);
+            return;
+        }
+#if CLOCK_SYNC_ENABLED
+        if (incomingData[0] == (uint8_t)PacketType::MOVE_AT) {
+            uplink.setController(esp_now_info->src_addr);
+            fleetClock.handleMoveAt(incomingData, len);
+            return;
+        }
+#endif
+#if FLEET_ADDRESSING_ENABLED
+        if (incomingData[0] == (uint8_t)PacketType::FLEET_COMMAND) {
+            Direction direction;
+            if (fleetAddress.commandFor(incomingData, len, direction)) {
+                uplink.setController(esp_now_info->src_addr);
+                applyDirection(direction);
+            }
+            return;
+        }
+        if (incomingData[0] == (uint8_t)PacketType::IDENTITY_SET) {
+            fleetAddress.handleIdentity(esp_now_info, incomingData, len);
+            return;
+        }
+#endif
+#if ASSET_PARTITION_ENABLED
+        // Asset upload packets: replies go to the uploading device
+        if (incomingData[0] == (uint8_t)PacketType::ASSET_BEGIN ||
+            incomingData[0] == (uint8_t)PacketType::ASSET_CHUNK) {
+            uplink.setController(esp_now_info->src_addr);
+            assetUploader.handle(incomingData, len);
+        }
+#endif
+        return;
+    }
     // Validate data size matches our message structure
     if (len != sizeof(MessageStruct)) {
         return;
     }
 
     // Copy received data into our structure
-    memcpy(&messageData, incomingData, len);
-    Serial.printf("Received direction: %d\n", messageData.direction);
-
-    // Reset animation to start from first frame for new direction
-    animationController.reset();
-    // Execute motor control command
-    motorController.executeCommand(messageData.direction);
+    MessageStruct message;
+    memcpy(&message, incomingData, len);
+    // Pose reports go back to whoever is driving the robot
+    uplink.setController(esp_now_info->src_addr);
+    applyDirection(message.direction);
 }
 
 /**
@@ -99,14 +242,40 @@ bool initESPNow() {
 void setup() {
     // Initialize serial communication for debugging
     Serial.begin(115200);
+    commandMutex = xSemaphoreCreateMutex();
 
     // Initialize motor controller pins and enable motor driver
     motorController.begin();
+#if WHEEL_ENCODERS_ENABLED
+    // Start closed-loop speed control (falls back to open-loop PWM on failure)
+    if (!wheelSpeedLoop.begin()) {
+        Serial.println("Wheel encoder initialization failed");
+    }
+#endif
 
     // Initialize LED matrix sprite and display
     arrowSprite.setColorDepth(16); // 16-bit color (RGB565)
     arrowSprite.createSprite(ledDisplay.LED_MATRIX_WIDTH, ledDisplay.LED_MATRIX_HEIGHT); // Create 16x16 pixel sprite
     ledDisplay.begin();
+    if (!animationController.begin()) {
+        Serial.println("Arrow animations missing");
+    }
+
+#if FLEET_ADDRESSING_ENABLED
+    // Load the robot ID and groups (before ESP-NOW delivers commands)
+    if (!fleetAddress.begin()) {
+        Serial.println("Fleet address initialization failed");
+    }
+    Serial.printf("Robot ID: %d, groups: 0x%08lx\n", fleetAddress.getRobotId(),
+                  (unsigned long)fleetAddress.getGroups());
+#endif
+
+#if TRACE_RECORDER_ENABLED
+    // Start recording received commands (before ESP-NOW delivers any)
+    if (!traceRecorder.begin()) {
+        Serial.println("Trace recorder initialization failed");
+    }
+#endif
 
     // Initialize ESP-NOW wireless communication
     if (!initESPNow()) {
@@ -117,6 +286,48 @@ void setup() {
         }
     }
 
+#if CONTROL_ARBITER_ENABLED
+    // Replies to control claims are broadcast
+    if (!controlArbiter.begin()) {
+        Serial.println("Control arbiter initialization failed");
+    }
+#endif
+
+#if ASSET_PARTITION_ENABLED
+    // Start the flash write task for asset uploads
+    if (!assetUploader.begin()) {
+        Serial.println("Asset uploader initialization failed");
+    }
+    assetUploader.setMappedSlot(animationController.getAssetSlot());
+#endif
+
+#if BATTERY_MONITOR_ENABLED
+    // Start battery sampling and power governor
+    if (!batteryMonitor.begin()) {
+        Serial.println("Battery monitor initialization failed");
+    }
+#endif
+
+#if CLOCK_SYNC_ENABLED
+    // Start tracking the fleet clock; arrows play in phase with it
+    if (!fleetClock.begin(applyDirection)) {
+        Serial.println("Fleet clock initialization failed");
+    }
+    animationController.setPhaseLocked(true);
+#endif
+
+    // Start dead reckoning and periodic pose reports
+    if (!poseEstimator.begin()) {
+        Serial.println("Pose estimator initialization failed");
+    }
+
+#if TELEMETRY_ENABLED
+    // Start sampling state for the controller
+    if (!telemetry.begin(TELEMETRY_RATE_HZ)) {
+        Serial.println("Telemetry initialization failed");
+    }
+#endif
+
     Serial.println("Setup complete - Robot ready");
 }
 
@@ -124,12 +335,54 @@ void setup() {
  * Main Loop Function
  */
 void loop() {
-    // Update animation frame and render arrow to sprite
-    animationController.update(arrowSprite, messageData.direction);
+#if ASSET_PARTITION_ENABLED
+    // Switch to a newly uploaded asset pack between frames
+    if (assetUploader.takeActivation()) {
+        if (!animationController.begin()) {
+            Serial.println("Arrow animations missing");
+        }
+        assetUploader.setMappedSlot(animationController.getAssetSlot());
+    }
+#endif
+
+#if CONTROL_ARBITER_ENABLED
+    // Answer control claims
+    controlArbiter.update();
+#if TELEMETRY_ENABLED
+    telemetry.setRejected(controlArbiter.getStats().rejected);
+#endif
+#endif
+
+#if FLEET_ADDRESSING_ENABLED
+    // Store a newly assigned robot ID and groups
+    fleetAddress.update();
+#endif
+
+#if CLOCK_SYNC_ENABLED
+    // Take received beacons and moves; animations run on the fleet clock
+    fleetClock.update();
+    if (fleetClock.takeStep()) {
+        animationController.reset();
+    }
+    uint32_t nowMs = fleetClock.nowMs();
+#else
+    uint32_t nowMs = millis();
+#endif
 
-    // Display sprite contents on LED matrix
-    ledDisplay.show(arrowSprite);
+    // Update animation frame and send it to the LED matrix
+    // (returns while the frame is on the wire)
+#if TRACE_RECORDER_ENABLED || TELEMETRY_ENABLED
+    uint32_t updateStart = micros();
+#endif
+    animationController.update(ledDisplay, arrowSprite, messageData.direction, nowMs);
+#if TRACE_RECORDER_ENABLED
+    traceRecorder.recordFrame(micros() - updateStart);
+#endif
+#if TELEMETRY_ENABLED
+    telemetry.recordFrame(micros() - updateStart);
+#endif
 
-    // Delay for animation timing (200ms = 5 frames per second)
-    delay(200);
+    // Render interval (16ms = about 60 frames per second with in-between frames);
+    // animation speed comes from the frame durations in the animation assets
+    delay(16);
 }